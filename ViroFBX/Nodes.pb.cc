@@ -17,16 +17,28 @@
 namespace viro {
 class Node_MatrixDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<Node_Matrix> {
 } _Node_Matrix_default_instance_;
+class Node_DualQuaternionDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<Node_DualQuaternion> {
+} _Node_DualQuaternion_default_instance_;
 class Node_Geometry_SourceDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<Node_Geometry_Source> {
 } _Node_Geometry_Source_default_instance_;
+class Node_Geometry_Element_MeshletDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<Node_Geometry_Element_Meshlet> {
+} _Node_Geometry_Element_Meshlet_default_instance_;
+class Node_Geometry_Element_ProgressiveLevelDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<Node_Geometry_Element_ProgressiveLevel> {
+} _Node_Geometry_Element_ProgressiveLevel_default_instance_;
+class Node_Geometry_Element_BonePartitionDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<Node_Geometry_Element_BonePartition> {
+} _Node_Geometry_Element_BonePartition_default_instance_;
 class Node_Geometry_ElementDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<Node_Geometry_Element> {
 } _Node_Geometry_Element_default_instance_;
 class Node_Geometry_Material_VisualDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<Node_Geometry_Material_Visual> {
 } _Node_Geometry_Material_Visual_default_instance_;
 class Node_Geometry_MaterialDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<Node_Geometry_Material> {
 } _Node_Geometry_Material_default_instance_;
+class Node_Geometry_Skin_InfluenceTierDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<Node_Geometry_Skin_InfluenceTier> {
+} _Node_Geometry_Skin_InfluenceTier_default_instance_;
 class Node_Geometry_SkinDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<Node_Geometry_Skin> {
 } _Node_Geometry_Skin_default_instance_;
+class Node_Geometry_LODDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<Node_Geometry_LOD> {
+} _Node_Geometry_LOD_default_instance_;
 class Node_GeometryDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<Node_Geometry> {
 } _Node_Geometry_default_instance_;
 class Node_Skeleton_BoneDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<Node_Skeleton_Bone> {
@@ -45,6 +57,8 @@ class Node_LightDefaultTypeInternal : public ::google::protobuf::internal::Expli
 } _Node_Light_default_instance_;
 class Node_CameraDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<Node_Camera> {
 } _Node_Camera_default_instance_;
+class Node_GeometryInstanceDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<Node_GeometryInstance> {
+} _Node_GeometryInstance_default_instance_;
 class NodeDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<Node> {
 } _Node_default_instance_;
 
@@ -53,11 +67,17 @@ namespace protobuf_Nodes_2eproto {
 
 void TableStruct::Shutdown() {
   _Node_Matrix_default_instance_.Shutdown();
+  _Node_DualQuaternion_default_instance_.Shutdown();
   _Node_Geometry_Source_default_instance_.Shutdown();
+  _Node_Geometry_Element_Meshlet_default_instance_.Shutdown();
+  _Node_Geometry_Element_ProgressiveLevel_default_instance_.Shutdown();
+  _Node_Geometry_Element_BonePartition_default_instance_.Shutdown();
   _Node_Geometry_Element_default_instance_.Shutdown();
   _Node_Geometry_Material_Visual_default_instance_.Shutdown();
   _Node_Geometry_Material_default_instance_.Shutdown();
+  _Node_Geometry_Skin_InfluenceTier_default_instance_.Shutdown();
   _Node_Geometry_Skin_default_instance_.Shutdown();
+  _Node_Geometry_LOD_default_instance_.Shutdown();
   _Node_Geometry_default_instance_.Shutdown();
   _Node_Skeleton_Bone_default_instance_.Shutdown();
   _Node_Skeleton_default_instance_.Shutdown();
@@ -67,6 +87,7 @@ void TableStruct::Shutdown() {
   _Node_KeyframeAnimation_default_instance_.Shutdown();
   _Node_Light_default_instance_.Shutdown();
   _Node_Camera_default_instance_.Shutdown();
+  _Node_GeometryInstance_default_instance_.Shutdown();
   _Node_default_instance_.Shutdown();
 }
 
@@ -75,11 +96,17 @@ void TableStruct::InitDefaultsImpl() {
 
   ::google::protobuf::internal::InitProtobufDefaults();
   _Node_Matrix_default_instance_.DefaultConstruct();
+  _Node_DualQuaternion_default_instance_.DefaultConstruct();
   _Node_Geometry_Source_default_instance_.DefaultConstruct();
+  _Node_Geometry_Element_Meshlet_default_instance_.DefaultConstruct();
+  _Node_Geometry_Element_ProgressiveLevel_default_instance_.DefaultConstruct();
+  _Node_Geometry_Element_BonePartition_default_instance_.DefaultConstruct();
   _Node_Geometry_Element_default_instance_.DefaultConstruct();
   _Node_Geometry_Material_Visual_default_instance_.DefaultConstruct();
   _Node_Geometry_Material_default_instance_.DefaultConstruct();
+  _Node_Geometry_Skin_InfluenceTier_default_instance_.DefaultConstruct();
   _Node_Geometry_Skin_default_instance_.DefaultConstruct();
+  _Node_Geometry_LOD_default_instance_.DefaultConstruct();
   _Node_Geometry_default_instance_.DefaultConstruct();
   _Node_Skeleton_Bone_default_instance_.DefaultConstruct();
   _Node_Skeleton_default_instance_.DefaultConstruct();
@@ -89,6 +116,7 @@ void TableStruct::InitDefaultsImpl() {
   _Node_KeyframeAnimation_default_instance_.DefaultConstruct();
   _Node_Light_default_instance_.DefaultConstruct();
   _Node_Camera_default_instance_.DefaultConstruct();
+  _Node_GeometryInstance_default_instance_.DefaultConstruct();
   _Node_default_instance_.DefaultConstruct();
   _Node_Geometry_Material_default_instance_.get_mutable()->diffuse_ = const_cast< ::viro::Node_Geometry_Material_Visual*>(
       ::viro::Node_Geometry_Material_Visual::internal_default_instance());
@@ -126,6 +154,8 @@ void TableStruct::InitDefaultsImpl() {
       ::viro::Node_Skeleton::internal_default_instance());
   _Node_default_instance_.get_mutable()->camera_ = const_cast< ::viro::Node_Camera*>(
       ::viro::Node_Camera::internal_default_instance());
+  _Node_default_instance_.get_mutable()->geometry_instance_ = const_cast< ::viro::Node_GeometryInstance*>(
+      ::viro::Node_GeometryInstance::internal_default_instance());
 }
 
 void InitDefaults() {
@@ -163,6 +193,7 @@ bool Node_Geometry_Source_Semantic_IsValid(int value) {
     case 6:
     case 7:
     case 8:
+    case 9:
       return true;
     default:
       return false;
@@ -179,10 +210,30 @@ const Node_Geometry_Source_Semantic Node_Geometry_Source::VertexCrease;
 const Node_Geometry_Source_Semantic Node_Geometry_Source::EdgeCrease;
 const Node_Geometry_Source_Semantic Node_Geometry_Source::BoneWeights;
 const Node_Geometry_Source_Semantic Node_Geometry_Source::BoneIndices;
+const Node_Geometry_Source_Semantic Node_Geometry_Source::QTangent;
 const Node_Geometry_Source_Semantic Node_Geometry_Source::Semantic_MIN;
 const Node_Geometry_Source_Semantic Node_Geometry_Source::Semantic_MAX;
 const int Node_Geometry_Source::Semantic_ARRAYSIZE;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+bool Node_Geometry_Source_Normalization_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const Node_Geometry_Source_Normalization Node_Geometry_Source::NotNormalized;
+const Node_Geometry_Source_Normalization Node_Geometry_Source::SNorm;
+const Node_Geometry_Source_Normalization Node_Geometry_Source::UNorm;
+const Node_Geometry_Source_Normalization Node_Geometry_Source::Normalization_MIN;
+const Node_Geometry_Source_Normalization Node_Geometry_Source::Normalization_MAX;
+const int Node_Geometry_Source::Normalization_ARRAYSIZE;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 bool Node_Geometry_Element_Primitive_IsValid(int value) {
   switch (value) {
     case 0:
@@ -333,6 +384,25 @@ const Node_Light_LightType Node_Light::LightType_MAX;
 const int Node_Light::LightType_ARRAYSIZE;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
+bool Node_Geometry_Encoding_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const Node_Geometry_Encoding Node_Geometry::Raw;
+const Node_Geometry_Encoding Node_Geometry::MeshVertex;
+const Node_Geometry_Encoding Node_Geometry::MeshIndex;
+const Node_Geometry_Encoding Node_Geometry::Encoding_MIN;
+const Node_Geometry_Encoding Node_Geometry::Encoding_MAX;
+const int Node_Geometry::Encoding_ARRAYSIZE;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
@@ -551,6 +621,222 @@ Node_Matrix::mutable_value() {
 
 // ===================================================================
 
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int Node_DualQuaternion::kValueFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+Node_DualQuaternion::Node_DualQuaternion()
+  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_Nodes_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:viro.Node.DualQuaternion)
+}
+Node_DualQuaternion::Node_DualQuaternion(const Node_DualQuaternion& from)
+  : ::google::protobuf::MessageLite(),
+      _internal_metadata_(NULL),
+      value_(from.value_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:viro.Node.DualQuaternion)
+}
+
+void Node_DualQuaternion::SharedCtor() {
+  _cached_size_ = 0;
+}
+
+Node_DualQuaternion::~Node_DualQuaternion() {
+  // @@protoc_insertion_point(destructor:viro.Node.DualQuaternion)
+  SharedDtor();
+}
+
+void Node_DualQuaternion::SharedDtor() {
+}
+
+void Node_DualQuaternion::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const Node_DualQuaternion& Node_DualQuaternion::default_instance() {
+  protobuf_Nodes_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+Node_DualQuaternion* Node_DualQuaternion::New(::google::protobuf::Arena* arena) const {
+  Node_DualQuaternion* n = new Node_DualQuaternion;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void Node_DualQuaternion::Clear() {
+// @@protoc_insertion_point(message_clear_start:viro.Node.DualQuaternion)
+  value_.Clear();
+}
+
+bool Node_DualQuaternion::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:viro.Node.DualQuaternion)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // repeated float value = 1;
+      case 1: {
+        if (tag == 10u) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, this->mutable_value())));
+        } else if (tag == 13u) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 1, 10u, input, this->mutable_value())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:viro.Node.DualQuaternion)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:viro.Node.DualQuaternion)
+  return false;
+#undef DO_
+}
+
+void Node_DualQuaternion::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:viro.Node.DualQuaternion)
+  // repeated float value = 1;
+  if (this->value_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(1, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_value_cached_byte_size_);
+    ::google::protobuf::internal::WireFormatLite::WriteFloatArray(
+      this->value().data(), this->value_size(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:viro.Node.DualQuaternion)
+}
+
+size_t Node_DualQuaternion::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:viro.Node.DualQuaternion)
+  size_t total_size = 0;
+
+  // repeated float value = 1;
+  {
+    unsigned int count = this->value_size();
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _value_cached_byte_size_ = cached_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void Node_DualQuaternion::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const Node_DualQuaternion*>(&from));
+}
+
+void Node_DualQuaternion::MergeFrom(const Node_DualQuaternion& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:viro.Node.DualQuaternion)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  value_.MergeFrom(from.value_);
+}
+
+void Node_DualQuaternion::CopyFrom(const Node_DualQuaternion& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:viro.Node.DualQuaternion)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Node_DualQuaternion::IsInitialized() const {
+  return true;
+}
+
+void Node_DualQuaternion::Swap(Node_DualQuaternion* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void Node_DualQuaternion::InternalSwap(Node_DualQuaternion* other) {
+  value_.UnsafeArenaSwap(&other->value_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::std::string Node_DualQuaternion::GetTypeName() const {
+  return "viro.Node.DualQuaternion";
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// Node_DualQuaternion
+
+// repeated float value = 1;
+int Node_DualQuaternion::value_size() const {
+  return value_.size();
+}
+void Node_DualQuaternion::clear_value() {
+  value_.Clear();
+}
+float Node_DualQuaternion::value(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.DualQuaternion.value)
+  return value_.Get(index);
+}
+void Node_DualQuaternion::set_value(int index, float value) {
+  value_.Set(index, value);
+  // @@protoc_insertion_point(field_set:viro.Node.DualQuaternion.value)
+}
+void Node_DualQuaternion::add_value(float value) {
+  value_.Add(value);
+  // @@protoc_insertion_point(field_add:viro.Node.DualQuaternion.value)
+}
+const ::google::protobuf::RepeatedField< float >&
+Node_DualQuaternion::value() const {
+  // @@protoc_insertion_point(field_list:viro.Node.DualQuaternion.value)
+  return value_;
+}
+::google::protobuf::RepeatedField< float >*
+Node_DualQuaternion::mutable_value() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.DualQuaternion.value)
+  return &value_;
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
 const int Node_Geometry_Source::kSemanticFieldNumber;
 const int Node_Geometry_Source::kVertexCountFieldNumber;
@@ -560,6 +846,10 @@ const int Node_Geometry_Source::kBytesPerComponentFieldNumber;
 const int Node_Geometry_Source::kDataOffsetFieldNumber;
 const int Node_Geometry_Source::kDataStrideFieldNumber;
 const int Node_Geometry_Source::kDataFieldNumber;
+const int Node_Geometry_Source::kNormalizationFieldNumber;
+const int Node_Geometry_Source::kDequantizeScaleFieldNumber;
+const int Node_Geometry_Source::kDequantizeOffsetFieldNumber;
+const int Node_Geometry_Source::kDataEncodingFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 Node_Geometry_Source::Node_Geometry_Source()
@@ -573,6 +863,8 @@ Node_Geometry_Source::Node_Geometry_Source()
 Node_Geometry_Source::Node_Geometry_Source(const Node_Geometry_Source& from)
   : ::google::protobuf::MessageLite(),
       _internal_metadata_(NULL),
+      dequantize_scale_(from.dequantize_scale_),
+      dequantize_offset_(from.dequantize_offset_),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
@@ -580,15 +872,17 @@ Node_Geometry_Source::Node_Geometry_Source(const Node_Geometry_Source& from)
     data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
   }
   ::memcpy(&semantic_, &from.semantic_,
-    reinterpret_cast<char*>(&data_stride_) -
-    reinterpret_cast<char*>(&semantic_) + sizeof(data_stride_));
+    reinterpret_cast<char*>(&normalization_) -
+    reinterpret_cast<char*>(&semantic_) + sizeof(normalization_));
+  data_encoding_ = from.data_encoding_;
   // @@protoc_insertion_point(copy_constructor:viro.Node.Geometry.Source)
 }
 
 void Node_Geometry_Source::SharedCtor() {
   data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&semantic_, 0, reinterpret_cast<char*>(&data_stride_) -
-    reinterpret_cast<char*>(&semantic_) + sizeof(data_stride_));
+  ::memset(&semantic_, 0, reinterpret_cast<char*>(&normalization_) -
+    reinterpret_cast<char*>(&semantic_) + sizeof(normalization_));
+  data_encoding_ = 0;
   _cached_size_ = 0;
 }
 
@@ -621,9 +915,12 @@ Node_Geometry_Source* Node_Geometry_Source::New(::google::protobuf::Arena* arena
 
 void Node_Geometry_Source::Clear() {
 // @@protoc_insertion_point(message_clear_start:viro.Node.Geometry.Source)
+  dequantize_scale_.Clear();
+  dequantize_offset_.Clear();
   data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&semantic_, 0, reinterpret_cast<char*>(&data_stride_) -
-    reinterpret_cast<char*>(&semantic_) + sizeof(data_stride_));
+  ::memset(&semantic_, 0, reinterpret_cast<char*>(&normalization_) -
+    reinterpret_cast<char*>(&semantic_) + sizeof(normalization_));
+  data_encoding_ = 0;
 }
 
 bool Node_Geometry_Source::MergePartialFromCodedStream(
@@ -739,6 +1036,66 @@ bool Node_Geometry_Source::MergePartialFromCodedStream(
         break;
       }
 
+      // .viro.Node.Geometry.Source.Normalization normalization = 9;
+      case 9: {
+        if (tag == 72u) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_normalization(static_cast< ::viro::Node_Geometry_Source_Normalization >(value));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated float dequantize_scale = 10;
+      case 10: {
+        if (tag == 82u) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, this->mutable_dequantize_scale())));
+        } else if (tag == 85u) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 1, 82u, input, this->mutable_dequantize_scale())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated float dequantize_offset = 11;
+      case 11: {
+        if (tag == 90u) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, this->mutable_dequantize_offset())));
+        } else if (tag == 93u) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 1, 90u, input, this->mutable_dequantize_offset())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .viro.Node.Geometry.Encoding data_encoding = 12;
+      case 12: {
+        if (tag == 96u) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_data_encoding(static_cast< ::viro::Node_Geometry_Encoding >(value));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0 ||
@@ -805,6 +1162,34 @@ void Node_Geometry_Source::SerializeWithCachedSizes(
       8, this->data(), output);
   }
 
+  // .viro.Node.Geometry.Source.Normalization normalization = 9;
+  if (this->normalization() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      9, this->normalization(), output);
+  }
+
+  // repeated float dequantize_scale = 10;
+  if (this->dequantize_scale_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(10, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_dequantize_scale_cached_byte_size_);
+    ::google::protobuf::internal::WireFormatLite::WriteFloatArray(
+      this->dequantize_scale().data(), this->dequantize_scale_size(), output);
+  }
+
+  // repeated float dequantize_offset = 11;
+  if (this->dequantize_offset_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(11, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_dequantize_offset_cached_byte_size_);
+    ::google::protobuf::internal::WireFormatLite::WriteFloatArray(
+      this->dequantize_offset().data(), this->dequantize_offset_size(), output);
+  }
+
+  // .viro.Node.Geometry.Encoding data_encoding = 12;
+  if (this->data_encoding() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      12, this->data_encoding(), output);
+  }
+
   // @@protoc_insertion_point(serialize_end:viro.Node.Geometry.Source)
 }
 
@@ -865,11 +1250,53 @@ size_t Node_Geometry_Source::ByteSizeLong() const {
         this->data_stride());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  // .viro.Node.Geometry.Source.Normalization normalization = 9;
+  if (this->normalization() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->normalization());
+  }
+
+  // repeated float dequantize_scale = 10;
+  {
+    unsigned int count = this->dequantize_scale_size();
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _dequantize_scale_cached_byte_size_ = cached_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  // repeated float dequantize_offset = 11;
+  {
+    unsigned int count = this->dequantize_offset_size();
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _dequantize_offset_cached_byte_size_ = cached_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  // .viro.Node.Geometry.Encoding data_encoding = 12;
+  if (this->data_encoding() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->data_encoding());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
 }
 
 void Node_Geometry_Source::CheckTypeAndMergeFrom(
@@ -906,6 +1333,14 @@ void Node_Geometry_Source::MergeFrom(const Node_Geometry_Source& from) {
   if (from.data_stride() != 0) {
     set_data_stride(from.data_stride());
   }
+  if (from.normalization() != 0) {
+    set_normalization(from.normalization());
+  }
+  dequantize_scale_.MergeFrom(from.dequantize_scale_);
+  dequantize_offset_.MergeFrom(from.dequantize_offset_);
+  if (from.data_encoding() != 0) {
+    set_data_encoding(from.data_encoding());
+  }
 }
 
 void Node_Geometry_Source::CopyFrom(const Node_Geometry_Source& from) {
@@ -932,6 +1367,10 @@ void Node_Geometry_Source::InternalSwap(Node_Geometry_Source* other) {
   std::swap(bytes_per_component_, other->bytes_per_component_);
   std::swap(data_offset_, other->data_offset_);
   std::swap(data_stride_, other->data_stride_);
+  std::swap(normalization_, other->normalization_);
+  dequantize_scale_.UnsafeArenaSwap(&other->dequantize_scale_);
+  dequantize_offset_.UnsafeArenaSwap(&other->dequantize_offset_);
+  std::swap(data_encoding_, other->data_encoding_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
@@ -1092,136 +1531,280 @@ void Node_Geometry_Source::set_allocated_data(::std::string* data) {
   // @@protoc_insertion_point(field_set_allocated:viro.Node.Geometry.Source.data)
 }
 
+// .viro.Node.Geometry.Source.Normalization normalization = 9;
+void Node_Geometry_Source::clear_normalization() {
+  normalization_ = 0;
+}
+::viro::Node_Geometry_Source_Normalization Node_Geometry_Source::normalization() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Source.normalization)
+  return static_cast< ::viro::Node_Geometry_Source_Normalization >(normalization_);
+}
+void Node_Geometry_Source::set_normalization(::viro::Node_Geometry_Source_Normalization value) {
+
+  normalization_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Source.normalization)
+}
+
+// repeated float dequantize_scale = 10;
+int Node_Geometry_Source::dequantize_scale_size() const {
+  return dequantize_scale_.size();
+}
+void Node_Geometry_Source::clear_dequantize_scale() {
+  dequantize_scale_.Clear();
+}
+float Node_Geometry_Source::dequantize_scale(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Source.dequantize_scale)
+  return dequantize_scale_.Get(index);
+}
+void Node_Geometry_Source::set_dequantize_scale(int index, float value) {
+  dequantize_scale_.Set(index, value);
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Source.dequantize_scale)
+}
+void Node_Geometry_Source::add_dequantize_scale(float value) {
+  dequantize_scale_.Add(value);
+  // @@protoc_insertion_point(field_add:viro.Node.Geometry.Source.dequantize_scale)
+}
+const ::google::protobuf::RepeatedField< float >&
+Node_Geometry_Source::dequantize_scale() const {
+  // @@protoc_insertion_point(field_list:viro.Node.Geometry.Source.dequantize_scale)
+  return dequantize_scale_;
+}
+::google::protobuf::RepeatedField< float >*
+Node_Geometry_Source::mutable_dequantize_scale() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.Geometry.Source.dequantize_scale)
+  return &dequantize_scale_;
+}
+
+// repeated float dequantize_offset = 11;
+int Node_Geometry_Source::dequantize_offset_size() const {
+  return dequantize_offset_.size();
+}
+void Node_Geometry_Source::clear_dequantize_offset() {
+  dequantize_offset_.Clear();
+}
+float Node_Geometry_Source::dequantize_offset(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Source.dequantize_offset)
+  return dequantize_offset_.Get(index);
+}
+void Node_Geometry_Source::set_dequantize_offset(int index, float value) {
+  dequantize_offset_.Set(index, value);
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Source.dequantize_offset)
+}
+void Node_Geometry_Source::add_dequantize_offset(float value) {
+  dequantize_offset_.Add(value);
+  // @@protoc_insertion_point(field_add:viro.Node.Geometry.Source.dequantize_offset)
+}
+const ::google::protobuf::RepeatedField< float >&
+Node_Geometry_Source::dequantize_offset() const {
+  // @@protoc_insertion_point(field_list:viro.Node.Geometry.Source.dequantize_offset)
+  return dequantize_offset_;
+}
+::google::protobuf::RepeatedField< float >*
+Node_Geometry_Source::mutable_dequantize_offset() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.Geometry.Source.dequantize_offset)
+  return &dequantize_offset_;
+}
+
+// .viro.Node.Geometry.Encoding data_encoding = 12;
+void Node_Geometry_Source::clear_data_encoding() {
+  data_encoding_ = 0;
+}
+::viro::Node_Geometry_Encoding Node_Geometry_Source::data_encoding() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Source.data_encoding)
+  return static_cast< ::viro::Node_Geometry_Encoding >(data_encoding_);
+}
+void Node_Geometry_Source::set_data_encoding(::viro::Node_Geometry_Encoding value) {
+
+  data_encoding_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Source.data_encoding)
+}
+
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Node_Geometry_Element::kDataFieldNumber;
-const int Node_Geometry_Element::kPrimitiveFieldNumber;
-const int Node_Geometry_Element::kPrimitiveCountFieldNumber;
-const int Node_Geometry_Element::kBytesPerIndexFieldNumber;
+const int Node_Geometry_Element_Meshlet::kTriangleOffsetFieldNumber;
+const int Node_Geometry_Element_Meshlet::kTriangleCountFieldNumber;
+const int Node_Geometry_Element_Meshlet::kVertexCountFieldNumber;
+const int Node_Geometry_Element_Meshlet::kBoundingSphereFieldNumber;
+const int Node_Geometry_Element_Meshlet::kConeApexFieldNumber;
+const int Node_Geometry_Element_Meshlet::kConeAxisFieldNumber;
+const int Node_Geometry_Element_Meshlet::kConeCutoffFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-Node_Geometry_Element::Node_Geometry_Element()
+Node_Geometry_Element_Meshlet::Node_Geometry_Element_Meshlet()
   : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_Nodes_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:viro.Node.Geometry.Element)
+  // @@protoc_insertion_point(constructor:viro.Node.Geometry.Element.Meshlet)
 }
-Node_Geometry_Element::Node_Geometry_Element(const Node_Geometry_Element& from)
+Node_Geometry_Element_Meshlet::Node_Geometry_Element_Meshlet(const Node_Geometry_Element_Meshlet& from)
   : ::google::protobuf::MessageLite(),
       _internal_metadata_(NULL),
+      bounding_sphere_(from.bounding_sphere_),
+      cone_apex_(from.cone_apex_),
+      cone_axis_(from.cone_axis_),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.data().size() > 0) {
-    data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
-  }
-  ::memcpy(&primitive_, &from.primitive_,
-    reinterpret_cast<char*>(&bytes_per_index_) -
-    reinterpret_cast<char*>(&primitive_) + sizeof(bytes_per_index_));
-  // @@protoc_insertion_point(copy_constructor:viro.Node.Geometry.Element)
+  triangle_offset_ = from.triangle_offset_;
+  triangle_count_ = from.triangle_count_;
+  vertex_count_ = from.vertex_count_;
+  cone_cutoff_ = from.cone_cutoff_;
+  // @@protoc_insertion_point(copy_constructor:viro.Node.Geometry.Element.Meshlet)
 }
 
-void Node_Geometry_Element::SharedCtor() {
-  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&primitive_, 0, reinterpret_cast<char*>(&bytes_per_index_) -
-    reinterpret_cast<char*>(&primitive_) + sizeof(bytes_per_index_));
+void Node_Geometry_Element_Meshlet::SharedCtor() {
+  triangle_offset_ = 0u;
+  triangle_count_ = 0u;
+  vertex_count_ = 0u;
+  cone_cutoff_ = 0;
   _cached_size_ = 0;
 }
 
-Node_Geometry_Element::~Node_Geometry_Element() {
-  // @@protoc_insertion_point(destructor:viro.Node.Geometry.Element)
+Node_Geometry_Element_Meshlet::~Node_Geometry_Element_Meshlet() {
+  // @@protoc_insertion_point(destructor:viro.Node.Geometry.Element.Meshlet)
   SharedDtor();
 }
 
-void Node_Geometry_Element::SharedDtor() {
-  data_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void Node_Geometry_Element_Meshlet::SharedDtor() {
 }
 
-void Node_Geometry_Element::SetCachedSize(int size) const {
+void Node_Geometry_Element_Meshlet::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const Node_Geometry_Element& Node_Geometry_Element::default_instance() {
+const Node_Geometry_Element_Meshlet& Node_Geometry_Element_Meshlet::default_instance() {
   protobuf_Nodes_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-Node_Geometry_Element* Node_Geometry_Element::New(::google::protobuf::Arena* arena) const {
-  Node_Geometry_Element* n = new Node_Geometry_Element;
+Node_Geometry_Element_Meshlet* Node_Geometry_Element_Meshlet::New(::google::protobuf::Arena* arena) const {
+  Node_Geometry_Element_Meshlet* n = new Node_Geometry_Element_Meshlet;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void Node_Geometry_Element::Clear() {
-// @@protoc_insertion_point(message_clear_start:viro.Node.Geometry.Element)
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&primitive_, 0, reinterpret_cast<char*>(&bytes_per_index_) -
-    reinterpret_cast<char*>(&primitive_) + sizeof(bytes_per_index_));
+void Node_Geometry_Element_Meshlet::Clear() {
+// @@protoc_insertion_point(message_clear_start:viro.Node.Geometry.Element.Meshlet)
+  bounding_sphere_.Clear();
+  cone_apex_.Clear();
+  cone_axis_.Clear();
+  triangle_offset_ = 0u;
+  triangle_count_ = 0u;
+  vertex_count_ = 0u;
+  cone_cutoff_ = 0;
 }
 
-bool Node_Geometry_Element::MergePartialFromCodedStream(
+bool Node_Geometry_Element_Meshlet::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:viro.Node.Geometry.Element)
+  // @@protoc_insertion_point(parse_start:viro.Node.Geometry.Element.Meshlet)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // bytes data = 1;
+      // uint32 triangle_offset = 1;
       case 1: {
-        if (tag == 10u) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_data()));
+        if (tag == 8u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &triangle_offset_)));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // .viro.Node.Geometry.Element.Primitive primitive = 2;
+      // uint32 triangle_count = 2;
       case 2: {
         if (tag == 16u) {
-          int value;
+
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_primitive(static_cast< ::viro::Node_Geometry_Element_Primitive >(value));
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &triangle_count_)));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // uint32 primitive_count = 3;
+      // uint32 vertex_count = 3;
       case 3: {
         if (tag == 24u) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
                    ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &primitive_count_)));
+                 input, &vertex_count_)));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // uint32 bytes_per_index = 4;
+      // repeated float bounding_sphere = 4;
       case 4: {
-        if (tag == 32u) {
+        if (tag == 34u) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, this->mutable_bounding_sphere())));
+        } else if (tag == 37u) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 1, 34u, input, this->mutable_bounding_sphere())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated float cone_apex = 5;
+      case 5: {
+        if (tag == 42u) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, this->mutable_cone_apex())));
+        } else if (tag == 45u) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 1, 42u, input, this->mutable_cone_apex())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated float cone_axis = 6;
+      case 6: {
+        if (tag == 50u) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, this->mutable_cone_axis())));
+        } else if (tag == 53u) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 1, 50u, input, this->mutable_cone_axis())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // float cone_cutoff = 7;
+      case 7: {
+        if (tag == 61u) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &bytes_per_index_)));
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &cone_cutoff_)));
         } else {
           goto handle_unusual;
         }
@@ -1241,71 +1824,137 @@ bool Node_Geometry_Element::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:viro.Node.Geometry.Element)
+  // @@protoc_insertion_point(parse_success:viro.Node.Geometry.Element.Meshlet)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:viro.Node.Geometry.Element)
+  // @@protoc_insertion_point(parse_failure:viro.Node.Geometry.Element.Meshlet)
   return false;
 #undef DO_
 }
 
-void Node_Geometry_Element::SerializeWithCachedSizes(
+void Node_Geometry_Element_Meshlet::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:viro.Node.Geometry.Element)
-  // bytes data = 1;
-  if (this->data().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      1, this->data(), output);
+  // @@protoc_insertion_point(serialize_start:viro.Node.Geometry.Element.Meshlet)
+  // uint32 triangle_offset = 1;
+  if (this->triangle_offset() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->triangle_offset(), output);
   }
 
-  // .viro.Node.Geometry.Element.Primitive primitive = 2;
-  if (this->primitive() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      2, this->primitive(), output);
+  // uint32 triangle_count = 2;
+  if (this->triangle_count() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->triangle_count(), output);
   }
 
-  // uint32 primitive_count = 3;
-  if (this->primitive_count() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->primitive_count(), output);
+  // uint32 vertex_count = 3;
+  if (this->vertex_count() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->vertex_count(), output);
   }
 
-  // uint32 bytes_per_index = 4;
-  if (this->bytes_per_index() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->bytes_per_index(), output);
+  // repeated float bounding_sphere = 4;
+  if (this->bounding_sphere_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(4, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_bounding_sphere_cached_byte_size_);
+    ::google::protobuf::internal::WireFormatLite::WriteFloatArray(
+      this->bounding_sphere().data(), this->bounding_sphere_size(), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:viro.Node.Geometry.Element)
+  // repeated float cone_apex = 5;
+  if (this->cone_apex_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(5, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_cone_apex_cached_byte_size_);
+    ::google::protobuf::internal::WireFormatLite::WriteFloatArray(
+      this->cone_apex().data(), this->cone_apex_size(), output);
+  }
+
+  // repeated float cone_axis = 6;
+  if (this->cone_axis_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(6, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_cone_axis_cached_byte_size_);
+    ::google::protobuf::internal::WireFormatLite::WriteFloatArray(
+      this->cone_axis().data(), this->cone_axis_size(), output);
+  }
+
+  // float cone_cutoff = 7;
+  if (this->cone_cutoff() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(7, this->cone_cutoff(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:viro.Node.Geometry.Element.Meshlet)
 }
 
-size_t Node_Geometry_Element::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:viro.Node.Geometry.Element)
+size_t Node_Geometry_Element_Meshlet::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:viro.Node.Geometry.Element.Meshlet)
   size_t total_size = 0;
 
-  // bytes data = 1;
-  if (this->data().size() > 0) {
+  // uint32 triangle_offset = 1;
+  if (this->triangle_offset() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->data());
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->triangle_offset());
   }
 
-  // .viro.Node.Geometry.Element.Primitive primitive = 2;
-  if (this->primitive() != 0) {
+  // uint32 triangle_count = 2;
+  if (this->triangle_count() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->primitive());
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->triangle_count());
   }
 
-  // uint32 primitive_count = 3;
-  if (this->primitive_count() != 0) {
+  // uint32 vertex_count = 3;
+  if (this->vertex_count() != 0) {
     total_size += 1 +
       ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->primitive_count());
+        this->vertex_count());
   }
 
-  // uint32 bytes_per_index = 4;
-  if (this->bytes_per_index() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->bytes_per_index());
+  // repeated float bounding_sphere = 4;
+  {
+    unsigned int count = this->bounding_sphere_size();
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _bounding_sphere_cached_byte_size_ = cached_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  // repeated float cone_apex = 5;
+  {
+    unsigned int count = this->cone_apex_size();
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _cone_apex_cached_byte_size_ = cached_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  // repeated float cone_axis = 6;
+  {
+    unsigned int count = this->cone_axis_size();
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _cone_axis_cached_byte_size_ = cached_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  // float cone_cutoff = 7;
+  if (this->cone_cutoff() != 0) {
+    total_size += 1 + 4;
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -1315,9 +1964,1186 @@ size_t Node_Geometry_Element::ByteSizeLong() const {
   return total_size;
 }
 
-void Node_Geometry_Element::CheckTypeAndMergeFrom(
+void Node_Geometry_Element_Meshlet::CheckTypeAndMergeFrom(
     const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const Node_Geometry_Element*>(&from));
+  MergeFrom(*::google::protobuf::down_cast<const Node_Geometry_Element_Meshlet*>(&from));
+}
+
+void Node_Geometry_Element_Meshlet::MergeFrom(const Node_Geometry_Element_Meshlet& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:viro.Node.Geometry.Element.Meshlet)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.triangle_offset() != 0) {
+    set_triangle_offset(from.triangle_offset());
+  }
+  if (from.triangle_count() != 0) {
+    set_triangle_count(from.triangle_count());
+  }
+  if (from.vertex_count() != 0) {
+    set_vertex_count(from.vertex_count());
+  }
+  bounding_sphere_.MergeFrom(from.bounding_sphere_);
+  cone_apex_.MergeFrom(from.cone_apex_);
+  cone_axis_.MergeFrom(from.cone_axis_);
+  if (from.cone_cutoff() != 0) {
+    set_cone_cutoff(from.cone_cutoff());
+  }
+}
+
+void Node_Geometry_Element_Meshlet::CopyFrom(const Node_Geometry_Element_Meshlet& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:viro.Node.Geometry.Element.Meshlet)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Node_Geometry_Element_Meshlet::IsInitialized() const {
+  return true;
+}
+
+void Node_Geometry_Element_Meshlet::Swap(Node_Geometry_Element_Meshlet* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void Node_Geometry_Element_Meshlet::InternalSwap(Node_Geometry_Element_Meshlet* other) {
+  std::swap(triangle_offset_, other->triangle_offset_);
+  std::swap(triangle_count_, other->triangle_count_);
+  std::swap(vertex_count_, other->vertex_count_);
+  bounding_sphere_.UnsafeArenaSwap(&other->bounding_sphere_);
+  cone_apex_.UnsafeArenaSwap(&other->cone_apex_);
+  cone_axis_.UnsafeArenaSwap(&other->cone_axis_);
+  std::swap(cone_cutoff_, other->cone_cutoff_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::std::string Node_Geometry_Element_Meshlet::GetTypeName() const {
+  return "viro.Node.Geometry.Element.Meshlet";
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// Node_Geometry_Element_Meshlet
+
+// uint32 triangle_offset = 1;
+void Node_Geometry_Element_Meshlet::clear_triangle_offset() {
+  triangle_offset_ = 0u;
+}
+::google::protobuf::uint32 Node_Geometry_Element_Meshlet::triangle_offset() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.Meshlet.triangle_offset)
+  return triangle_offset_;
+}
+void Node_Geometry_Element_Meshlet::set_triangle_offset(::google::protobuf::uint32 value) {
+
+  triangle_offset_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.Meshlet.triangle_offset)
+}
+
+// uint32 triangle_count = 2;
+void Node_Geometry_Element_Meshlet::clear_triangle_count() {
+  triangle_count_ = 0u;
+}
+::google::protobuf::uint32 Node_Geometry_Element_Meshlet::triangle_count() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.Meshlet.triangle_count)
+  return triangle_count_;
+}
+void Node_Geometry_Element_Meshlet::set_triangle_count(::google::protobuf::uint32 value) {
+
+  triangle_count_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.Meshlet.triangle_count)
+}
+
+// uint32 vertex_count = 3;
+void Node_Geometry_Element_Meshlet::clear_vertex_count() {
+  vertex_count_ = 0u;
+}
+::google::protobuf::uint32 Node_Geometry_Element_Meshlet::vertex_count() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.Meshlet.vertex_count)
+  return vertex_count_;
+}
+void Node_Geometry_Element_Meshlet::set_vertex_count(::google::protobuf::uint32 value) {
+
+  vertex_count_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.Meshlet.vertex_count)
+}
+
+// repeated float bounding_sphere = 4;
+int Node_Geometry_Element_Meshlet::bounding_sphere_size() const {
+  return bounding_sphere_.size();
+}
+void Node_Geometry_Element_Meshlet::clear_bounding_sphere() {
+  bounding_sphere_.Clear();
+}
+float Node_Geometry_Element_Meshlet::bounding_sphere(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.Meshlet.bounding_sphere)
+  return bounding_sphere_.Get(index);
+}
+void Node_Geometry_Element_Meshlet::set_bounding_sphere(int index, float value) {
+  bounding_sphere_.Set(index, value);
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.Meshlet.bounding_sphere)
+}
+void Node_Geometry_Element_Meshlet::add_bounding_sphere(float value) {
+  bounding_sphere_.Add(value);
+  // @@protoc_insertion_point(field_add:viro.Node.Geometry.Element.Meshlet.bounding_sphere)
+}
+const ::google::protobuf::RepeatedField< float >&
+Node_Geometry_Element_Meshlet::bounding_sphere() const {
+  // @@protoc_insertion_point(field_list:viro.Node.Geometry.Element.Meshlet.bounding_sphere)
+  return bounding_sphere_;
+}
+::google::protobuf::RepeatedField< float >*
+Node_Geometry_Element_Meshlet::mutable_bounding_sphere() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.Geometry.Element.Meshlet.bounding_sphere)
+  return &bounding_sphere_;
+}
+
+// repeated float cone_apex = 5;
+int Node_Geometry_Element_Meshlet::cone_apex_size() const {
+  return cone_apex_.size();
+}
+void Node_Geometry_Element_Meshlet::clear_cone_apex() {
+  cone_apex_.Clear();
+}
+float Node_Geometry_Element_Meshlet::cone_apex(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.Meshlet.cone_apex)
+  return cone_apex_.Get(index);
+}
+void Node_Geometry_Element_Meshlet::set_cone_apex(int index, float value) {
+  cone_apex_.Set(index, value);
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.Meshlet.cone_apex)
+}
+void Node_Geometry_Element_Meshlet::add_cone_apex(float value) {
+  cone_apex_.Add(value);
+  // @@protoc_insertion_point(field_add:viro.Node.Geometry.Element.Meshlet.cone_apex)
+}
+const ::google::protobuf::RepeatedField< float >&
+Node_Geometry_Element_Meshlet::cone_apex() const {
+  // @@protoc_insertion_point(field_list:viro.Node.Geometry.Element.Meshlet.cone_apex)
+  return cone_apex_;
+}
+::google::protobuf::RepeatedField< float >*
+Node_Geometry_Element_Meshlet::mutable_cone_apex() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.Geometry.Element.Meshlet.cone_apex)
+  return &cone_apex_;
+}
+
+// repeated float cone_axis = 6;
+int Node_Geometry_Element_Meshlet::cone_axis_size() const {
+  return cone_axis_.size();
+}
+void Node_Geometry_Element_Meshlet::clear_cone_axis() {
+  cone_axis_.Clear();
+}
+float Node_Geometry_Element_Meshlet::cone_axis(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.Meshlet.cone_axis)
+  return cone_axis_.Get(index);
+}
+void Node_Geometry_Element_Meshlet::set_cone_axis(int index, float value) {
+  cone_axis_.Set(index, value);
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.Meshlet.cone_axis)
+}
+void Node_Geometry_Element_Meshlet::add_cone_axis(float value) {
+  cone_axis_.Add(value);
+  // @@protoc_insertion_point(field_add:viro.Node.Geometry.Element.Meshlet.cone_axis)
+}
+const ::google::protobuf::RepeatedField< float >&
+Node_Geometry_Element_Meshlet::cone_axis() const {
+  // @@protoc_insertion_point(field_list:viro.Node.Geometry.Element.Meshlet.cone_axis)
+  return cone_axis_;
+}
+::google::protobuf::RepeatedField< float >*
+Node_Geometry_Element_Meshlet::mutable_cone_axis() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.Geometry.Element.Meshlet.cone_axis)
+  return &cone_axis_;
+}
+
+// float cone_cutoff = 7;
+void Node_Geometry_Element_Meshlet::clear_cone_cutoff() {
+  cone_cutoff_ = 0;
+}
+float Node_Geometry_Element_Meshlet::cone_cutoff() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.Meshlet.cone_cutoff)
+  return cone_cutoff_;
+}
+void Node_Geometry_Element_Meshlet::set_cone_cutoff(float value) {
+
+  cone_cutoff_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.Meshlet.cone_cutoff)
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int Node_Geometry_Element_ProgressiveLevel::kVertexCountFieldNumber;
+const int Node_Geometry_Element_ProgressiveLevel::kTriangleCountFieldNumber;
+const int Node_Geometry_Element_ProgressiveLevel::kErrorFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+Node_Geometry_Element_ProgressiveLevel::Node_Geometry_Element_ProgressiveLevel()
+  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_Nodes_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:viro.Node.Geometry.Element.ProgressiveLevel)
+}
+Node_Geometry_Element_ProgressiveLevel::Node_Geometry_Element_ProgressiveLevel(const Node_Geometry_Element_ProgressiveLevel& from)
+  : ::google::protobuf::MessageLite(),
+      _internal_metadata_(NULL),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  vertex_count_ = from.vertex_count_;
+  triangle_count_ = from.triangle_count_;
+  error_ = from.error_;
+  // @@protoc_insertion_point(copy_constructor:viro.Node.Geometry.Element.ProgressiveLevel)
+}
+
+void Node_Geometry_Element_ProgressiveLevel::SharedCtor() {
+  vertex_count_ = 0u;
+  triangle_count_ = 0u;
+  error_ = 0;
+  _cached_size_ = 0;
+}
+
+Node_Geometry_Element_ProgressiveLevel::~Node_Geometry_Element_ProgressiveLevel() {
+  // @@protoc_insertion_point(destructor:viro.Node.Geometry.Element.ProgressiveLevel)
+  SharedDtor();
+}
+
+void Node_Geometry_Element_ProgressiveLevel::SharedDtor() {
+}
+
+void Node_Geometry_Element_ProgressiveLevel::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const Node_Geometry_Element_ProgressiveLevel& Node_Geometry_Element_ProgressiveLevel::default_instance() {
+  protobuf_Nodes_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+Node_Geometry_Element_ProgressiveLevel* Node_Geometry_Element_ProgressiveLevel::New(::google::protobuf::Arena* arena) const {
+  Node_Geometry_Element_ProgressiveLevel* n = new Node_Geometry_Element_ProgressiveLevel;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void Node_Geometry_Element_ProgressiveLevel::Clear() {
+// @@protoc_insertion_point(message_clear_start:viro.Node.Geometry.Element.ProgressiveLevel)
+  vertex_count_ = 0u;
+  triangle_count_ = 0u;
+  error_ = 0;
+}
+
+bool Node_Geometry_Element_ProgressiveLevel::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:viro.Node.Geometry.Element.ProgressiveLevel)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // uint32 vertex_count = 1;
+      case 1: {
+        if (tag == 8u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &vertex_count_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 triangle_count = 2;
+      case 2: {
+        if (tag == 16u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &triangle_count_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // float error = 3;
+      case 3: {
+        if (tag == 29u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &error_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:viro.Node.Geometry.Element.ProgressiveLevel)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:viro.Node.Geometry.Element.ProgressiveLevel)
+  return false;
+#undef DO_
+}
+
+void Node_Geometry_Element_ProgressiveLevel::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:viro.Node.Geometry.Element.ProgressiveLevel)
+  // uint32 vertex_count = 1;
+  if (this->vertex_count() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->vertex_count(), output);
+  }
+
+  // uint32 triangle_count = 2;
+  if (this->triangle_count() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->triangle_count(), output);
+  }
+
+  // float error = 3;
+  if (this->error() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->error(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:viro.Node.Geometry.Element.ProgressiveLevel)
+}
+
+size_t Node_Geometry_Element_ProgressiveLevel::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:viro.Node.Geometry.Element.ProgressiveLevel)
+  size_t total_size = 0;
+
+  // uint32 vertex_count = 1;
+  if (this->vertex_count() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->vertex_count());
+  }
+
+  // uint32 triangle_count = 2;
+  if (this->triangle_count() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->triangle_count());
+  }
+
+  // float error = 3;
+  if (this->error() != 0) {
+    total_size += 1 + 4;
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void Node_Geometry_Element_ProgressiveLevel::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const Node_Geometry_Element_ProgressiveLevel*>(&from));
+}
+
+void Node_Geometry_Element_ProgressiveLevel::MergeFrom(const Node_Geometry_Element_ProgressiveLevel& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:viro.Node.Geometry.Element.ProgressiveLevel)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.vertex_count() != 0) {
+    set_vertex_count(from.vertex_count());
+  }
+  if (from.triangle_count() != 0) {
+    set_triangle_count(from.triangle_count());
+  }
+  if (from.error() != 0) {
+    set_error(from.error());
+  }
+}
+
+void Node_Geometry_Element_ProgressiveLevel::CopyFrom(const Node_Geometry_Element_ProgressiveLevel& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:viro.Node.Geometry.Element.ProgressiveLevel)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Node_Geometry_Element_ProgressiveLevel::IsInitialized() const {
+  return true;
+}
+
+void Node_Geometry_Element_ProgressiveLevel::Swap(Node_Geometry_Element_ProgressiveLevel* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void Node_Geometry_Element_ProgressiveLevel::InternalSwap(Node_Geometry_Element_ProgressiveLevel* other) {
+  std::swap(vertex_count_, other->vertex_count_);
+  std::swap(triangle_count_, other->triangle_count_);
+  std::swap(error_, other->error_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::std::string Node_Geometry_Element_ProgressiveLevel::GetTypeName() const {
+  return "viro.Node.Geometry.Element.ProgressiveLevel";
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// Node_Geometry_Element_ProgressiveLevel
+
+// uint32 vertex_count = 1;
+void Node_Geometry_Element_ProgressiveLevel::clear_vertex_count() {
+  vertex_count_ = 0u;
+}
+::google::protobuf::uint32 Node_Geometry_Element_ProgressiveLevel::vertex_count() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.ProgressiveLevel.vertex_count)
+  return vertex_count_;
+}
+void Node_Geometry_Element_ProgressiveLevel::set_vertex_count(::google::protobuf::uint32 value) {
+
+  vertex_count_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.ProgressiveLevel.vertex_count)
+}
+
+// uint32 triangle_count = 2;
+void Node_Geometry_Element_ProgressiveLevel::clear_triangle_count() {
+  triangle_count_ = 0u;
+}
+::google::protobuf::uint32 Node_Geometry_Element_ProgressiveLevel::triangle_count() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.ProgressiveLevel.triangle_count)
+  return triangle_count_;
+}
+void Node_Geometry_Element_ProgressiveLevel::set_triangle_count(::google::protobuf::uint32 value) {
+
+  triangle_count_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.ProgressiveLevel.triangle_count)
+}
+
+// float error = 3;
+void Node_Geometry_Element_ProgressiveLevel::clear_error() {
+  error_ = 0;
+}
+float Node_Geometry_Element_ProgressiveLevel::error() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.ProgressiveLevel.error)
+  return error_;
+}
+void Node_Geometry_Element_ProgressiveLevel::set_error(float value) {
+
+  error_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.ProgressiveLevel.error)
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int Node_Geometry_Element_BonePartition::kTriangleOffsetFieldNumber;
+const int Node_Geometry_Element_BonePartition::kTriangleCountFieldNumber;
+const int Node_Geometry_Element_BonePartition::kBoneFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+Node_Geometry_Element_BonePartition::Node_Geometry_Element_BonePartition()
+  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_Nodes_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:viro.Node.Geometry.Element.BonePartition)
+}
+Node_Geometry_Element_BonePartition::Node_Geometry_Element_BonePartition(const Node_Geometry_Element_BonePartition& from)
+  : ::google::protobuf::MessageLite(),
+      _internal_metadata_(NULL),
+      bone_(from.bone_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  triangle_offset_ = from.triangle_offset_;
+  triangle_count_ = from.triangle_count_;
+  // @@protoc_insertion_point(copy_constructor:viro.Node.Geometry.Element.BonePartition)
+}
+
+void Node_Geometry_Element_BonePartition::SharedCtor() {
+  triangle_offset_ = 0u;
+  triangle_count_ = 0u;
+  _cached_size_ = 0;
+}
+
+Node_Geometry_Element_BonePartition::~Node_Geometry_Element_BonePartition() {
+  // @@protoc_insertion_point(destructor:viro.Node.Geometry.Element.BonePartition)
+  SharedDtor();
+}
+
+void Node_Geometry_Element_BonePartition::SharedDtor() {
+}
+
+void Node_Geometry_Element_BonePartition::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const Node_Geometry_Element_BonePartition& Node_Geometry_Element_BonePartition::default_instance() {
+  protobuf_Nodes_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+Node_Geometry_Element_BonePartition* Node_Geometry_Element_BonePartition::New(::google::protobuf::Arena* arena) const {
+  Node_Geometry_Element_BonePartition* n = new Node_Geometry_Element_BonePartition;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void Node_Geometry_Element_BonePartition::Clear() {
+// @@protoc_insertion_point(message_clear_start:viro.Node.Geometry.Element.BonePartition)
+  bone_.Clear();
+  triangle_offset_ = 0u;
+  triangle_count_ = 0u;
+}
+
+bool Node_Geometry_Element_BonePartition::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:viro.Node.Geometry.Element.BonePartition)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // uint32 triangle_offset = 1;
+      case 1: {
+        if (tag == 8u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &triangle_offset_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 triangle_count = 2;
+      case 2: {
+        if (tag == 16u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &triangle_count_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated uint32 bone = 3;
+      case 3: {
+        if (tag == 26u) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, this->mutable_bone())));
+        } else if (tag == 24u) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 1, 26u, input, this->mutable_bone())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:viro.Node.Geometry.Element.BonePartition)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:viro.Node.Geometry.Element.BonePartition)
+  return false;
+#undef DO_
+}
+
+void Node_Geometry_Element_BonePartition::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:viro.Node.Geometry.Element.BonePartition)
+  // uint32 triangle_offset = 1;
+  if (this->triangle_offset() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->triangle_offset(), output);
+  }
+
+  // uint32 triangle_count = 2;
+  if (this->triangle_count() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->triangle_count(), output);
+  }
+
+  // repeated uint32 bone = 3;
+  if (this->bone_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(3, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_bone_cached_byte_size_);
+  }
+  for (int i = 0, n = this->bone_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32NoTag(
+      this->bone(i), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:viro.Node.Geometry.Element.BonePartition)
+}
+
+size_t Node_Geometry_Element_BonePartition::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:viro.Node.Geometry.Element.BonePartition)
+  size_t total_size = 0;
+
+  // uint32 triangle_offset = 1;
+  if (this->triangle_offset() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->triangle_offset());
+  }
+
+  // uint32 triangle_count = 2;
+  if (this->triangle_count() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->triangle_count());
+  }
+
+  // repeated uint32 bone = 3;
+  {
+    size_t data_size = ::google::protobuf::internal::WireFormatLite::
+      UInt32Size(this->bone_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _bone_cached_byte_size_ = cached_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void Node_Geometry_Element_BonePartition::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const Node_Geometry_Element_BonePartition*>(&from));
+}
+
+void Node_Geometry_Element_BonePartition::MergeFrom(const Node_Geometry_Element_BonePartition& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:viro.Node.Geometry.Element.BonePartition)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.triangle_offset() != 0) {
+    set_triangle_offset(from.triangle_offset());
+  }
+  if (from.triangle_count() != 0) {
+    set_triangle_count(from.triangle_count());
+  }
+  bone_.MergeFrom(from.bone_);
+}
+
+void Node_Geometry_Element_BonePartition::CopyFrom(const Node_Geometry_Element_BonePartition& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:viro.Node.Geometry.Element.BonePartition)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Node_Geometry_Element_BonePartition::IsInitialized() const {
+  return true;
+}
+
+void Node_Geometry_Element_BonePartition::Swap(Node_Geometry_Element_BonePartition* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void Node_Geometry_Element_BonePartition::InternalSwap(Node_Geometry_Element_BonePartition* other) {
+  std::swap(triangle_offset_, other->triangle_offset_);
+  std::swap(triangle_count_, other->triangle_count_);
+  bone_.UnsafeArenaSwap(&other->bone_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::std::string Node_Geometry_Element_BonePartition::GetTypeName() const {
+  return "viro.Node.Geometry.Element.BonePartition";
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// Node_Geometry_Element_BonePartition
+
+// uint32 triangle_offset = 1;
+void Node_Geometry_Element_BonePartition::clear_triangle_offset() {
+  triangle_offset_ = 0u;
+}
+::google::protobuf::uint32 Node_Geometry_Element_BonePartition::triangle_offset() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.BonePartition.triangle_offset)
+  return triangle_offset_;
+}
+void Node_Geometry_Element_BonePartition::set_triangle_offset(::google::protobuf::uint32 value) {
+
+  triangle_offset_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.BonePartition.triangle_offset)
+}
+
+// uint32 triangle_count = 2;
+void Node_Geometry_Element_BonePartition::clear_triangle_count() {
+  triangle_count_ = 0u;
+}
+::google::protobuf::uint32 Node_Geometry_Element_BonePartition::triangle_count() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.BonePartition.triangle_count)
+  return triangle_count_;
+}
+void Node_Geometry_Element_BonePartition::set_triangle_count(::google::protobuf::uint32 value) {
+
+  triangle_count_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.BonePartition.triangle_count)
+}
+
+// repeated uint32 bone = 3;
+int Node_Geometry_Element_BonePartition::bone_size() const {
+  return bone_.size();
+}
+void Node_Geometry_Element_BonePartition::clear_bone() {
+  bone_.Clear();
+}
+::google::protobuf::uint32 Node_Geometry_Element_BonePartition::bone(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.BonePartition.bone)
+  return bone_.Get(index);
+}
+void Node_Geometry_Element_BonePartition::set_bone(int index, ::google::protobuf::uint32 value) {
+  bone_.Set(index, value);
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.BonePartition.bone)
+}
+void Node_Geometry_Element_BonePartition::add_bone(::google::protobuf::uint32 value) {
+  bone_.Add(value);
+  // @@protoc_insertion_point(field_add:viro.Node.Geometry.Element.BonePartition.bone)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+Node_Geometry_Element_BonePartition::bone() const {
+  // @@protoc_insertion_point(field_list:viro.Node.Geometry.Element.BonePartition.bone)
+  return bone_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+Node_Geometry_Element_BonePartition::mutable_bone() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.Geometry.Element.BonePartition.bone)
+  return &bone_;
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int Node_Geometry_Element::kDataFieldNumber;
+const int Node_Geometry_Element::kPrimitiveFieldNumber;
+const int Node_Geometry_Element::kPrimitiveCountFieldNumber;
+const int Node_Geometry_Element::kBytesPerIndexFieldNumber;
+const int Node_Geometry_Element::kMeshletFieldNumber;
+const int Node_Geometry_Element::kProgressiveLevelFieldNumber;
+const int Node_Geometry_Element::kPrimitiveRestartFieldNumber;
+const int Node_Geometry_Element::kBonePartitionFieldNumber;
+const int Node_Geometry_Element::kDataEncodingFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+Node_Geometry_Element::Node_Geometry_Element()
+  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_Nodes_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:viro.Node.Geometry.Element)
+}
+Node_Geometry_Element::Node_Geometry_Element(const Node_Geometry_Element& from)
+  : ::google::protobuf::MessageLite(),
+      _internal_metadata_(NULL),
+      meshlet_(from.meshlet_),
+      progressive_level_(from.progressive_level_),
+      bone_partition_(from.bone_partition_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.data().size() > 0) {
+    data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
+  }
+  ::memcpy(&primitive_, &from.primitive_,
+    reinterpret_cast<char*>(&bytes_per_index_) -
+    reinterpret_cast<char*>(&primitive_) + sizeof(bytes_per_index_));
+  primitive_restart_ = from.primitive_restart_;
+  data_encoding_ = from.data_encoding_;
+  // @@protoc_insertion_point(copy_constructor:viro.Node.Geometry.Element)
+}
+
+void Node_Geometry_Element::SharedCtor() {
+  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&primitive_, 0, reinterpret_cast<char*>(&bytes_per_index_) -
+    reinterpret_cast<char*>(&primitive_) + sizeof(bytes_per_index_));
+  primitive_restart_ = false;
+  data_encoding_ = 0;
+  _cached_size_ = 0;
+}
+
+Node_Geometry_Element::~Node_Geometry_Element() {
+  // @@protoc_insertion_point(destructor:viro.Node.Geometry.Element)
+  SharedDtor();
+}
+
+void Node_Geometry_Element::SharedDtor() {
+  data_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+void Node_Geometry_Element::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const Node_Geometry_Element& Node_Geometry_Element::default_instance() {
+  protobuf_Nodes_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+Node_Geometry_Element* Node_Geometry_Element::New(::google::protobuf::Arena* arena) const {
+  Node_Geometry_Element* n = new Node_Geometry_Element;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void Node_Geometry_Element::Clear() {
+// @@protoc_insertion_point(message_clear_start:viro.Node.Geometry.Element)
+  meshlet_.Clear();
+  progressive_level_.Clear();
+  bone_partition_.Clear();
+  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&primitive_, 0, reinterpret_cast<char*>(&bytes_per_index_) -
+    reinterpret_cast<char*>(&primitive_) + sizeof(bytes_per_index_));
+  primitive_restart_ = false;
+  data_encoding_ = 0;
+}
+
+bool Node_Geometry_Element::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:viro.Node.Geometry.Element)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // bytes data = 1;
+      case 1: {
+        if (tag == 10u) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_data()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .viro.Node.Geometry.Element.Primitive primitive = 2;
+      case 2: {
+        if (tag == 16u) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_primitive(static_cast< ::viro::Node_Geometry_Element_Primitive >(value));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 primitive_count = 3;
+      case 3: {
+        if (tag == 24u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &primitive_count_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 bytes_per_index = 4;
+      case 4: {
+        if (tag == 32u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &bytes_per_index_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .viro.Node.Geometry.Element.Meshlet meshlet = 5;
+      case 5: {
+        if (tag == 42u) {
+          DO_(input->IncrementRecursionDepth());
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtualNoRecursionDepth(
+                input, add_meshlet()));
+        } else {
+          goto handle_unusual;
+        }
+        input->UnsafeDecrementRecursionDepth();
+        break;
+      }
+
+      // repeated .viro.Node.Geometry.Element.ProgressiveLevel progressive_level = 6;
+      case 6: {
+        if (tag == 50u) {
+          DO_(input->IncrementRecursionDepth());
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtualNoRecursionDepth(
+                input, add_progressive_level()));
+        } else {
+          goto handle_unusual;
+        }
+        input->UnsafeDecrementRecursionDepth();
+        break;
+      }
+
+      // bool primitive_restart = 7;
+      case 7: {
+        if (tag == 56u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &primitive_restart_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .viro.Node.Geometry.Element.BonePartition bone_partition = 8;
+      case 8: {
+        if (tag == 66u) {
+          DO_(input->IncrementRecursionDepth());
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtualNoRecursionDepth(
+                input, add_bone_partition()));
+        } else {
+          goto handle_unusual;
+        }
+        input->UnsafeDecrementRecursionDepth();
+        break;
+      }
+
+      // .viro.Node.Geometry.Encoding data_encoding = 9;
+      case 9: {
+        if (tag == 72u) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_data_encoding(static_cast< ::viro::Node_Geometry_Encoding >(value));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:viro.Node.Geometry.Element)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:viro.Node.Geometry.Element)
+  return false;
+#undef DO_
+}
+
+void Node_Geometry_Element::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:viro.Node.Geometry.Element)
+  // bytes data = 1;
+  if (this->data().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      1, this->data(), output);
+  }
+
+  // .viro.Node.Geometry.Element.Primitive primitive = 2;
+  if (this->primitive() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      2, this->primitive(), output);
+  }
+
+  // uint32 primitive_count = 3;
+  if (this->primitive_count() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->primitive_count(), output);
+  }
+
+  // uint32 bytes_per_index = 4;
+  if (this->bytes_per_index() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->bytes_per_index(), output);
+  }
+
+  // repeated .viro.Node.Geometry.Element.Meshlet meshlet = 5;
+  for (unsigned int i = 0, n = this->meshlet_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      5, this->meshlet(i), output);
+  }
+
+  // repeated .viro.Node.Geometry.Element.ProgressiveLevel progressive_level = 6;
+  for (unsigned int i = 0, n = this->progressive_level_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      6, this->progressive_level(i), output);
+  }
+
+  // bool primitive_restart = 7;
+  if (this->primitive_restart() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(7, this->primitive_restart(), output);
+  }
+
+  // repeated .viro.Node.Geometry.Element.BonePartition bone_partition = 8;
+  for (unsigned int i = 0, n = this->bone_partition_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      8, this->bone_partition(i), output);
+  }
+
+  // .viro.Node.Geometry.Encoding data_encoding = 9;
+  if (this->data_encoding() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      9, this->data_encoding(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:viro.Node.Geometry.Element)
+}
+
+size_t Node_Geometry_Element::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:viro.Node.Geometry.Element)
+  size_t total_size = 0;
+
+  // bytes data = 1;
+  if (this->data().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::BytesSize(
+        this->data());
+  }
+
+  // .viro.Node.Geometry.Element.Primitive primitive = 2;
+  if (this->primitive() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->primitive());
+  }
+
+  // uint32 primitive_count = 3;
+  if (this->primitive_count() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->primitive_count());
+  }
+
+  // uint32 bytes_per_index = 4;
+  if (this->bytes_per_index() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->bytes_per_index());
+  }
+
+  // repeated .viro.Node.Geometry.Element.Meshlet meshlet = 5;
+  {
+    unsigned int count = this->meshlet_size();
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->meshlet(i));
+    }
+  }
+
+  // repeated .viro.Node.Geometry.Element.ProgressiveLevel progressive_level = 6;
+  {
+    unsigned int count = this->progressive_level_size();
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->progressive_level(i));
+    }
+  }
+
+  // bool primitive_restart = 7;
+  if (this->primitive_restart() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // repeated .viro.Node.Geometry.Element.BonePartition bone_partition = 8;
+  {
+    unsigned int count = this->bone_partition_size();
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->bone_partition(i));
+    }
+  }
+
+  // .viro.Node.Geometry.Encoding data_encoding = 9;
+  if (this->data_encoding() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->data_encoding());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void Node_Geometry_Element::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const Node_Geometry_Element*>(&from));
 }
 
 void Node_Geometry_Element::MergeFrom(const Node_Geometry_Element& from) {
@@ -1337,6 +3163,15 @@ void Node_Geometry_Element::MergeFrom(const Node_Geometry_Element& from) {
   if (from.bytes_per_index() != 0) {
     set_bytes_per_index(from.bytes_per_index());
   }
+  meshlet_.MergeFrom(from.meshlet_);
+  progressive_level_.MergeFrom(from.progressive_level_);
+  if (from.primitive_restart() != 0) {
+    set_primitive_restart(from.primitive_restart());
+  }
+  bone_partition_.MergeFrom(from.bone_partition_);
+  if (from.data_encoding() != 0) {
+    set_data_encoding(from.data_encoding());
+  }
 }
 
 void Node_Geometry_Element::CopyFrom(const Node_Geometry_Element& from) {
@@ -1359,6 +3194,11 @@ void Node_Geometry_Element::InternalSwap(Node_Geometry_Element* other) {
   std::swap(primitive_, other->primitive_);
   std::swap(primitive_count_, other->primitive_count_);
   std::swap(bytes_per_index_, other->bytes_per_index_);
+  meshlet_.UnsafeArenaSwap(&other->meshlet_);
+  progressive_level_.UnsafeArenaSwap(&other->progressive_level_);
+  std::swap(primitive_restart_, other->primitive_restart_);
+  bone_partition_.UnsafeArenaSwap(&other->bone_partition_);
+  std::swap(data_encoding_, other->data_encoding_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
@@ -1463,6 +3303,124 @@ void Node_Geometry_Element::set_bytes_per_index(::google::protobuf::uint32 value
   // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.bytes_per_index)
 }
 
+// repeated .viro.Node.Geometry.Element.Meshlet meshlet = 5;
+int Node_Geometry_Element::meshlet_size() const {
+  return meshlet_.size();
+}
+void Node_Geometry_Element::clear_meshlet() {
+  meshlet_.Clear();
+}
+const ::viro::Node_Geometry_Element_Meshlet& Node_Geometry_Element::meshlet(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.meshlet)
+  return meshlet_.Get(index);
+}
+::viro::Node_Geometry_Element_Meshlet* Node_Geometry_Element::mutable_meshlet(int index) {
+  // @@protoc_insertion_point(field_mutable:viro.Node.Geometry.Element.meshlet)
+  return meshlet_.Mutable(index);
+}
+::viro::Node_Geometry_Element_Meshlet* Node_Geometry_Element::add_meshlet() {
+  // @@protoc_insertion_point(field_add:viro.Node.Geometry.Element.meshlet)
+  return meshlet_.Add();
+}
+::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Element_Meshlet >*
+Node_Geometry_Element::mutable_meshlet() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.Geometry.Element.meshlet)
+  return &meshlet_;
+}
+const ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Element_Meshlet >&
+Node_Geometry_Element::meshlet() const {
+  // @@protoc_insertion_point(field_list:viro.Node.Geometry.Element.meshlet)
+  return meshlet_;
+}
+
+// repeated .viro.Node.Geometry.Element.ProgressiveLevel progressive_level = 6;
+int Node_Geometry_Element::progressive_level_size() const {
+  return progressive_level_.size();
+}
+void Node_Geometry_Element::clear_progressive_level() {
+  progressive_level_.Clear();
+}
+const ::viro::Node_Geometry_Element_ProgressiveLevel& Node_Geometry_Element::progressive_level(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.progressive_level)
+  return progressive_level_.Get(index);
+}
+::viro::Node_Geometry_Element_ProgressiveLevel* Node_Geometry_Element::mutable_progressive_level(int index) {
+  // @@protoc_insertion_point(field_mutable:viro.Node.Geometry.Element.progressive_level)
+  return progressive_level_.Mutable(index);
+}
+::viro::Node_Geometry_Element_ProgressiveLevel* Node_Geometry_Element::add_progressive_level() {
+  // @@protoc_insertion_point(field_add:viro.Node.Geometry.Element.progressive_level)
+  return progressive_level_.Add();
+}
+::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Element_ProgressiveLevel >*
+Node_Geometry_Element::mutable_progressive_level() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.Geometry.Element.progressive_level)
+  return &progressive_level_;
+}
+const ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Element_ProgressiveLevel >&
+Node_Geometry_Element::progressive_level() const {
+  // @@protoc_insertion_point(field_list:viro.Node.Geometry.Element.progressive_level)
+  return progressive_level_;
+}
+
+// bool primitive_restart = 7;
+void Node_Geometry_Element::clear_primitive_restart() {
+  primitive_restart_ = false;
+}
+bool Node_Geometry_Element::primitive_restart() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.primitive_restart)
+  return primitive_restart_;
+}
+void Node_Geometry_Element::set_primitive_restart(bool value) {
+
+  primitive_restart_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.primitive_restart)
+}
+
+// repeated .viro.Node.Geometry.Element.BonePartition bone_partition = 8;
+int Node_Geometry_Element::bone_partition_size() const {
+  return bone_partition_.size();
+}
+void Node_Geometry_Element::clear_bone_partition() {
+  bone_partition_.Clear();
+}
+const ::viro::Node_Geometry_Element_BonePartition& Node_Geometry_Element::bone_partition(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.bone_partition)
+  return bone_partition_.Get(index);
+}
+::viro::Node_Geometry_Element_BonePartition* Node_Geometry_Element::mutable_bone_partition(int index) {
+  // @@protoc_insertion_point(field_mutable:viro.Node.Geometry.Element.bone_partition)
+  return bone_partition_.Mutable(index);
+}
+::viro::Node_Geometry_Element_BonePartition* Node_Geometry_Element::add_bone_partition() {
+  // @@protoc_insertion_point(field_add:viro.Node.Geometry.Element.bone_partition)
+  return bone_partition_.Add();
+}
+::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Element_BonePartition >*
+Node_Geometry_Element::mutable_bone_partition() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.Geometry.Element.bone_partition)
+  return &bone_partition_;
+}
+const ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Element_BonePartition >&
+Node_Geometry_Element::bone_partition() const {
+  // @@protoc_insertion_point(field_list:viro.Node.Geometry.Element.bone_partition)
+  return bone_partition_;
+}
+
+// .viro.Node.Geometry.Encoding data_encoding = 9;
+void Node_Geometry_Element::clear_data_encoding() {
+  data_encoding_ = 0;
+}
+::viro::Node_Geometry_Encoding Node_Geometry_Element::data_encoding() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.data_encoding)
+  return static_cast< ::viro::Node_Geometry_Encoding >(data_encoding_);
+}
+void Node_Geometry_Element::set_data_encoding(::viro::Node_Geometry_Encoding value) {
+
+  data_encoding_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.data_encoding)
+}
+
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
@@ -3481,11 +5439,296 @@ void Node_Geometry_Material::set_allocated_ao(::viro::Node_Geometry_Material_Vis
 
 // ===================================================================
 
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int Node_Geometry_Skin_InfluenceTier::kInfluencesFieldNumber;
+const int Node_Geometry_Skin_InfluenceTier::kVertexOffsetFieldNumber;
+const int Node_Geometry_Skin_InfluenceTier::kVertexCountFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+Node_Geometry_Skin_InfluenceTier::Node_Geometry_Skin_InfluenceTier()
+  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_Nodes_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:viro.Node.Geometry.Skin.InfluenceTier)
+}
+Node_Geometry_Skin_InfluenceTier::Node_Geometry_Skin_InfluenceTier(const Node_Geometry_Skin_InfluenceTier& from)
+  : ::google::protobuf::MessageLite(),
+      _internal_metadata_(NULL),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  influences_ = from.influences_;
+  vertex_offset_ = from.vertex_offset_;
+  vertex_count_ = from.vertex_count_;
+  // @@protoc_insertion_point(copy_constructor:viro.Node.Geometry.Skin.InfluenceTier)
+}
+
+void Node_Geometry_Skin_InfluenceTier::SharedCtor() {
+  influences_ = 0u;
+  vertex_offset_ = 0u;
+  vertex_count_ = 0u;
+  _cached_size_ = 0;
+}
+
+Node_Geometry_Skin_InfluenceTier::~Node_Geometry_Skin_InfluenceTier() {
+  // @@protoc_insertion_point(destructor:viro.Node.Geometry.Skin.InfluenceTier)
+  SharedDtor();
+}
+
+void Node_Geometry_Skin_InfluenceTier::SharedDtor() {
+}
+
+void Node_Geometry_Skin_InfluenceTier::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const Node_Geometry_Skin_InfluenceTier& Node_Geometry_Skin_InfluenceTier::default_instance() {
+  protobuf_Nodes_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+Node_Geometry_Skin_InfluenceTier* Node_Geometry_Skin_InfluenceTier::New(::google::protobuf::Arena* arena) const {
+  Node_Geometry_Skin_InfluenceTier* n = new Node_Geometry_Skin_InfluenceTier;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void Node_Geometry_Skin_InfluenceTier::Clear() {
+// @@protoc_insertion_point(message_clear_start:viro.Node.Geometry.Skin.InfluenceTier)
+  influences_ = 0u;
+  vertex_offset_ = 0u;
+  vertex_count_ = 0u;
+}
+
+bool Node_Geometry_Skin_InfluenceTier::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:viro.Node.Geometry.Skin.InfluenceTier)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // uint32 influences = 1;
+      case 1: {
+        if (tag == 8u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &influences_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 vertex_offset = 2;
+      case 2: {
+        if (tag == 16u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &vertex_offset_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 vertex_count = 3;
+      case 3: {
+        if (tag == 24u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &vertex_count_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:viro.Node.Geometry.Skin.InfluenceTier)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:viro.Node.Geometry.Skin.InfluenceTier)
+  return false;
+#undef DO_
+}
+
+void Node_Geometry_Skin_InfluenceTier::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:viro.Node.Geometry.Skin.InfluenceTier)
+  // uint32 influences = 1;
+  if (this->influences() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->influences(), output);
+  }
+
+  // uint32 vertex_offset = 2;
+  if (this->vertex_offset() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->vertex_offset(), output);
+  }
+
+  // uint32 vertex_count = 3;
+  if (this->vertex_count() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->vertex_count(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:viro.Node.Geometry.Skin.InfluenceTier)
+}
+
+size_t Node_Geometry_Skin_InfluenceTier::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:viro.Node.Geometry.Skin.InfluenceTier)
+  size_t total_size = 0;
+
+  // uint32 influences = 1;
+  if (this->influences() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->influences());
+  }
+
+  // uint32 vertex_offset = 2;
+  if (this->vertex_offset() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->vertex_offset());
+  }
+
+  // uint32 vertex_count = 3;
+  if (this->vertex_count() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->vertex_count());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void Node_Geometry_Skin_InfluenceTier::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const Node_Geometry_Skin_InfluenceTier*>(&from));
+}
+
+void Node_Geometry_Skin_InfluenceTier::MergeFrom(const Node_Geometry_Skin_InfluenceTier& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:viro.Node.Geometry.Skin.InfluenceTier)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.influences() != 0) {
+    set_influences(from.influences());
+  }
+  if (from.vertex_offset() != 0) {
+    set_vertex_offset(from.vertex_offset());
+  }
+  if (from.vertex_count() != 0) {
+    set_vertex_count(from.vertex_count());
+  }
+}
+
+void Node_Geometry_Skin_InfluenceTier::CopyFrom(const Node_Geometry_Skin_InfluenceTier& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:viro.Node.Geometry.Skin.InfluenceTier)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Node_Geometry_Skin_InfluenceTier::IsInitialized() const {
+  return true;
+}
+
+void Node_Geometry_Skin_InfluenceTier::Swap(Node_Geometry_Skin_InfluenceTier* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void Node_Geometry_Skin_InfluenceTier::InternalSwap(Node_Geometry_Skin_InfluenceTier* other) {
+  std::swap(influences_, other->influences_);
+  std::swap(vertex_offset_, other->vertex_offset_);
+  std::swap(vertex_count_, other->vertex_count_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::std::string Node_Geometry_Skin_InfluenceTier::GetTypeName() const {
+  return "viro.Node.Geometry.Skin.InfluenceTier";
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// Node_Geometry_Skin_InfluenceTier
+
+// uint32 influences = 1;
+void Node_Geometry_Skin_InfluenceTier::clear_influences() {
+  influences_ = 0u;
+}
+::google::protobuf::uint32 Node_Geometry_Skin_InfluenceTier::influences() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Skin.InfluenceTier.influences)
+  return influences_;
+}
+void Node_Geometry_Skin_InfluenceTier::set_influences(::google::protobuf::uint32 value) {
+
+  influences_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Skin.InfluenceTier.influences)
+}
+
+// uint32 vertex_offset = 2;
+void Node_Geometry_Skin_InfluenceTier::clear_vertex_offset() {
+  vertex_offset_ = 0u;
+}
+::google::protobuf::uint32 Node_Geometry_Skin_InfluenceTier::vertex_offset() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Skin.InfluenceTier.vertex_offset)
+  return vertex_offset_;
+}
+void Node_Geometry_Skin_InfluenceTier::set_vertex_offset(::google::protobuf::uint32 value) {
+
+  vertex_offset_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Skin.InfluenceTier.vertex_offset)
+}
+
+// uint32 vertex_count = 3;
+void Node_Geometry_Skin_InfluenceTier::clear_vertex_count() {
+  vertex_count_ = 0u;
+}
+::google::protobuf::uint32 Node_Geometry_Skin_InfluenceTier::vertex_count() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Skin.InfluenceTier.vertex_count)
+  return vertex_count_;
+}
+void Node_Geometry_Skin_InfluenceTier::set_vertex_count(::google::protobuf::uint32 value) {
+
+  vertex_count_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Skin.InfluenceTier.vertex_count)
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
 const int Node_Geometry_Skin::kGeometryBindTransformFieldNumber;
 const int Node_Geometry_Skin::kBindTransformFieldNumber;
 const int Node_Geometry_Skin::kBoneIndicesFieldNumber;
 const int Node_Geometry_Skin::kBoneWeightsFieldNumber;
+const int Node_Geometry_Skin::kInfluenceTierFieldNumber;
+const int Node_Geometry_Skin::kBindDualQuaternionFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 Node_Geometry_Skin::Node_Geometry_Skin()
@@ -3500,6 +5743,8 @@ Node_Geometry_Skin::Node_Geometry_Skin(const Node_Geometry_Skin& from)
   : ::google::protobuf::MessageLite(),
       _internal_metadata_(NULL),
       bind_transform_(from.bind_transform_),
+      influence_tier_(from.influence_tier_),
+      bind_dual_quaternion_(from.bind_dual_quaternion_),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.has_geometry_bind_transform()) {
@@ -3564,6 +5809,8 @@ Node_Geometry_Skin* Node_Geometry_Skin::New(::google::protobuf::Arena* arena) co
 void Node_Geometry_Skin::Clear() {
 // @@protoc_insertion_point(message_clear_start:viro.Node.Geometry.Skin)
   bind_transform_.Clear();
+  influence_tier_.Clear();
+  bind_dual_quaternion_.Clear();
   if (GetArenaNoVirtual() == NULL && geometry_bind_transform_ != NULL) {
     delete geometry_bind_transform_;
   }
@@ -3634,6 +5881,32 @@ bool Node_Geometry_Skin::MergePartialFromCodedStream(
         break;
       }
 
+      // repeated .viro.Node.Geometry.Skin.InfluenceTier influence_tier = 5;
+      case 5: {
+        if (tag == 42u) {
+          DO_(input->IncrementRecursionDepth());
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtualNoRecursionDepth(
+                input, add_influence_tier()));
+        } else {
+          goto handle_unusual;
+        }
+        input->UnsafeDecrementRecursionDepth();
+        break;
+      }
+
+      // repeated .viro.Node.DualQuaternion bind_dual_quaternion = 6;
+      case 6: {
+        if (tag == 50u) {
+          DO_(input->IncrementRecursionDepth());
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtualNoRecursionDepth(
+                input, add_bind_dual_quaternion()));
+        } else {
+          goto handle_unusual;
+        }
+        input->UnsafeDecrementRecursionDepth();
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0 ||
@@ -3679,7 +5952,19 @@ void Node_Geometry_Skin::SerializeWithCachedSizes(
   // .viro.Node.Geometry.Source bone_weights = 4;
   if (this->has_bone_weights()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      4, *this->bone_weights_, output);
+      4, *this->bone_weights_, output);
+  }
+
+  // repeated .viro.Node.Geometry.Skin.InfluenceTier influence_tier = 5;
+  for (unsigned int i = 0, n = this->influence_tier_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      5, this->influence_tier(i), output);
+  }
+
+  // repeated .viro.Node.DualQuaternion bind_dual_quaternion = 6;
+  for (unsigned int i = 0, n = this->bind_dual_quaternion_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      6, this->bind_dual_quaternion(i), output);
   }
 
   // @@protoc_insertion_point(serialize_end:viro.Node.Geometry.Skin)
@@ -3721,6 +6006,28 @@ size_t Node_Geometry_Skin::ByteSizeLong() const {
         *this->bone_weights_);
   }
 
+  // repeated .viro.Node.Geometry.Skin.InfluenceTier influence_tier = 5;
+  {
+    unsigned int count = this->influence_tier_size();
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->influence_tier(i));
+    }
+  }
+
+  // repeated .viro.Node.DualQuaternion bind_dual_quaternion = 6;
+  {
+    unsigned int count = this->bind_dual_quaternion_size();
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->bind_dual_quaternion(i));
+    }
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -3747,6 +6054,8 @@ void Node_Geometry_Skin::MergeFrom(const Node_Geometry_Skin& from) {
   if (from.has_bone_weights()) {
     mutable_bone_weights()->::viro::Node_Geometry_Source::MergeFrom(from.bone_weights());
   }
+  influence_tier_.MergeFrom(from.influence_tier_);
+  bind_dual_quaternion_.MergeFrom(from.bind_dual_quaternion_);
 }
 
 void Node_Geometry_Skin::CopyFrom(const Node_Geometry_Skin& from) {
@@ -3769,6 +6078,8 @@ void Node_Geometry_Skin::InternalSwap(Node_Geometry_Skin* other) {
   std::swap(geometry_bind_transform_, other->geometry_bind_transform_);
   std::swap(bone_indices_, other->bone_indices_);
   std::swap(bone_weights_, other->bone_weights_);
+  influence_tier_.UnsafeArenaSwap(&other->influence_tier_);
+  bind_dual_quaternion_.UnsafeArenaSwap(&other->bind_dual_quaternion_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
@@ -3842,88 +6153,445 @@ Node_Geometry_Skin::mutable_bind_transform() {
   // @@protoc_insertion_point(field_mutable_list:viro.Node.Geometry.Skin.bind_transform)
   return &bind_transform_;
 }
-const ::google::protobuf::RepeatedPtrField< ::viro::Node_Matrix >&
-Node_Geometry_Skin::bind_transform() const {
-  // @@protoc_insertion_point(field_list:viro.Node.Geometry.Skin.bind_transform)
-  return bind_transform_;
+const ::google::protobuf::RepeatedPtrField< ::viro::Node_Matrix >&
+Node_Geometry_Skin::bind_transform() const {
+  // @@protoc_insertion_point(field_list:viro.Node.Geometry.Skin.bind_transform)
+  return bind_transform_;
+}
+
+// .viro.Node.Geometry.Source bone_indices = 3;
+bool Node_Geometry_Skin::has_bone_indices() const {
+  return this != internal_default_instance() && bone_indices_ != NULL;
+}
+void Node_Geometry_Skin::clear_bone_indices() {
+  if (GetArenaNoVirtual() == NULL && bone_indices_ != NULL) delete bone_indices_;
+  bone_indices_ = NULL;
+}
+const ::viro::Node_Geometry_Source& Node_Geometry_Skin::bone_indices() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Skin.bone_indices)
+  return bone_indices_ != NULL ? *bone_indices_
+                         : *::viro::Node_Geometry_Source::internal_default_instance();
+}
+::viro::Node_Geometry_Source* Node_Geometry_Skin::mutable_bone_indices() {
+
+  if (bone_indices_ == NULL) {
+    bone_indices_ = new ::viro::Node_Geometry_Source;
+  }
+  // @@protoc_insertion_point(field_mutable:viro.Node.Geometry.Skin.bone_indices)
+  return bone_indices_;
+}
+::viro::Node_Geometry_Source* Node_Geometry_Skin::release_bone_indices() {
+  // @@protoc_insertion_point(field_release:viro.Node.Geometry.Skin.bone_indices)
+
+  ::viro::Node_Geometry_Source* temp = bone_indices_;
+  bone_indices_ = NULL;
+  return temp;
+}
+void Node_Geometry_Skin::set_allocated_bone_indices(::viro::Node_Geometry_Source* bone_indices) {
+  delete bone_indices_;
+  bone_indices_ = bone_indices;
+  if (bone_indices) {
+
+  } else {
+
+  }
+  // @@protoc_insertion_point(field_set_allocated:viro.Node.Geometry.Skin.bone_indices)
+}
+
+// .viro.Node.Geometry.Source bone_weights = 4;
+bool Node_Geometry_Skin::has_bone_weights() const {
+  return this != internal_default_instance() && bone_weights_ != NULL;
+}
+void Node_Geometry_Skin::clear_bone_weights() {
+  if (GetArenaNoVirtual() == NULL && bone_weights_ != NULL) delete bone_weights_;
+  bone_weights_ = NULL;
+}
+const ::viro::Node_Geometry_Source& Node_Geometry_Skin::bone_weights() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Skin.bone_weights)
+  return bone_weights_ != NULL ? *bone_weights_
+                         : *::viro::Node_Geometry_Source::internal_default_instance();
+}
+::viro::Node_Geometry_Source* Node_Geometry_Skin::mutable_bone_weights() {
+
+  if (bone_weights_ == NULL) {
+    bone_weights_ = new ::viro::Node_Geometry_Source;
+  }
+  // @@protoc_insertion_point(field_mutable:viro.Node.Geometry.Skin.bone_weights)
+  return bone_weights_;
+}
+::viro::Node_Geometry_Source* Node_Geometry_Skin::release_bone_weights() {
+  // @@protoc_insertion_point(field_release:viro.Node.Geometry.Skin.bone_weights)
+
+  ::viro::Node_Geometry_Source* temp = bone_weights_;
+  bone_weights_ = NULL;
+  return temp;
+}
+void Node_Geometry_Skin::set_allocated_bone_weights(::viro::Node_Geometry_Source* bone_weights) {
+  delete bone_weights_;
+  bone_weights_ = bone_weights;
+  if (bone_weights) {
+
+  } else {
+
+  }
+  // @@protoc_insertion_point(field_set_allocated:viro.Node.Geometry.Skin.bone_weights)
+}
+
+// repeated .viro.Node.Geometry.Skin.InfluenceTier influence_tier = 5;
+int Node_Geometry_Skin::influence_tier_size() const {
+  return influence_tier_.size();
+}
+void Node_Geometry_Skin::clear_influence_tier() {
+  influence_tier_.Clear();
+}
+const ::viro::Node_Geometry_Skin_InfluenceTier& Node_Geometry_Skin::influence_tier(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Skin.influence_tier)
+  return influence_tier_.Get(index);
+}
+::viro::Node_Geometry_Skin_InfluenceTier* Node_Geometry_Skin::mutable_influence_tier(int index) {
+  // @@protoc_insertion_point(field_mutable:viro.Node.Geometry.Skin.influence_tier)
+  return influence_tier_.Mutable(index);
+}
+::viro::Node_Geometry_Skin_InfluenceTier* Node_Geometry_Skin::add_influence_tier() {
+  // @@protoc_insertion_point(field_add:viro.Node.Geometry.Skin.influence_tier)
+  return influence_tier_.Add();
+}
+::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Skin_InfluenceTier >*
+Node_Geometry_Skin::mutable_influence_tier() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.Geometry.Skin.influence_tier)
+  return &influence_tier_;
+}
+const ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Skin_InfluenceTier >&
+Node_Geometry_Skin::influence_tier() const {
+  // @@protoc_insertion_point(field_list:viro.Node.Geometry.Skin.influence_tier)
+  return influence_tier_;
+}
+
+// repeated .viro.Node.DualQuaternion bind_dual_quaternion = 6;
+int Node_Geometry_Skin::bind_dual_quaternion_size() const {
+  return bind_dual_quaternion_.size();
+}
+void Node_Geometry_Skin::clear_bind_dual_quaternion() {
+  bind_dual_quaternion_.Clear();
+}
+const ::viro::Node_DualQuaternion& Node_Geometry_Skin::bind_dual_quaternion(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Skin.bind_dual_quaternion)
+  return bind_dual_quaternion_.Get(index);
+}
+::viro::Node_DualQuaternion* Node_Geometry_Skin::mutable_bind_dual_quaternion(int index) {
+  // @@protoc_insertion_point(field_mutable:viro.Node.Geometry.Skin.bind_dual_quaternion)
+  return bind_dual_quaternion_.Mutable(index);
+}
+::viro::Node_DualQuaternion* Node_Geometry_Skin::add_bind_dual_quaternion() {
+  // @@protoc_insertion_point(field_add:viro.Node.Geometry.Skin.bind_dual_quaternion)
+  return bind_dual_quaternion_.Add();
+}
+::google::protobuf::RepeatedPtrField< ::viro::Node_DualQuaternion >*
+Node_Geometry_Skin::mutable_bind_dual_quaternion() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.Geometry.Skin.bind_dual_quaternion)
+  return &bind_dual_quaternion_;
+}
+const ::google::protobuf::RepeatedPtrField< ::viro::Node_DualQuaternion >&
+Node_Geometry_Skin::bind_dual_quaternion() const {
+  // @@protoc_insertion_point(field_list:viro.Node.Geometry.Skin.bind_dual_quaternion)
+  return bind_dual_quaternion_;
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int Node_Geometry_LOD::kElementFieldNumber;
+const int Node_Geometry_LOD::kScreenSizeFieldNumber;
+const int Node_Geometry_LOD::kErrorFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+Node_Geometry_LOD::Node_Geometry_LOD()
+  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_Nodes_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:viro.Node.Geometry.LOD)
+}
+Node_Geometry_LOD::Node_Geometry_LOD(const Node_Geometry_LOD& from)
+  : ::google::protobuf::MessageLite(),
+      _internal_metadata_(NULL),
+      element_(from.element_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  screen_size_ = from.screen_size_;
+  error_ = from.error_;
+  // @@protoc_insertion_point(copy_constructor:viro.Node.Geometry.LOD)
+}
+
+void Node_Geometry_LOD::SharedCtor() {
+  screen_size_ = 0;
+  error_ = 0;
+  _cached_size_ = 0;
+}
+
+Node_Geometry_LOD::~Node_Geometry_LOD() {
+  // @@protoc_insertion_point(destructor:viro.Node.Geometry.LOD)
+  SharedDtor();
+}
+
+void Node_Geometry_LOD::SharedDtor() {
+}
+
+void Node_Geometry_LOD::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const Node_Geometry_LOD& Node_Geometry_LOD::default_instance() {
+  protobuf_Nodes_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+Node_Geometry_LOD* Node_Geometry_LOD::New(::google::protobuf::Arena* arena) const {
+  Node_Geometry_LOD* n = new Node_Geometry_LOD;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void Node_Geometry_LOD::Clear() {
+// @@protoc_insertion_point(message_clear_start:viro.Node.Geometry.LOD)
+  element_.Clear();
+  screen_size_ = 0;
+  error_ = 0;
+}
+
+bool Node_Geometry_LOD::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:viro.Node.Geometry.LOD)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // repeated .viro.Node.Geometry.Element element = 1;
+      case 1: {
+        if (tag == 10u) {
+          DO_(input->IncrementRecursionDepth());
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtualNoRecursionDepth(
+                input, add_element()));
+        } else {
+          goto handle_unusual;
+        }
+        input->UnsafeDecrementRecursionDepth();
+        break;
+      }
+
+      // float screen_size = 2;
+      case 2: {
+        if (tag == 21u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &screen_size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // float error = 3;
+      case 3: {
+        if (tag == 29u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &error_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:viro.Node.Geometry.LOD)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:viro.Node.Geometry.LOD)
+  return false;
+#undef DO_
+}
+
+void Node_Geometry_LOD::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:viro.Node.Geometry.LOD)
+  // repeated .viro.Node.Geometry.Element element = 1;
+  for (unsigned int i = 0, n = this->element_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      1, this->element(i), output);
+  }
+
+  // float screen_size = 2;
+  if (this->screen_size() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->screen_size(), output);
+  }
+
+  // float error = 3;
+  if (this->error() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->error(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:viro.Node.Geometry.LOD)
+}
+
+size_t Node_Geometry_LOD::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:viro.Node.Geometry.LOD)
+  size_t total_size = 0;
+
+  // repeated .viro.Node.Geometry.Element element = 1;
+  {
+    unsigned int count = this->element_size();
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->element(i));
+    }
+  }
+
+  // float screen_size = 2;
+  if (this->screen_size() != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float error = 3;
+  if (this->error() != 0) {
+    total_size += 1 + 4;
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void Node_Geometry_LOD::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const Node_Geometry_LOD*>(&from));
 }
 
-// .viro.Node.Geometry.Source bone_indices = 3;
-bool Node_Geometry_Skin::has_bone_indices() const {
-  return this != internal_default_instance() && bone_indices_ != NULL;
+void Node_Geometry_LOD::MergeFrom(const Node_Geometry_LOD& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:viro.Node.Geometry.LOD)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  element_.MergeFrom(from.element_);
+  if (from.screen_size() != 0) {
+    set_screen_size(from.screen_size());
+  }
+  if (from.error() != 0) {
+    set_error(from.error());
+  }
 }
-void Node_Geometry_Skin::clear_bone_indices() {
-  if (GetArenaNoVirtual() == NULL && bone_indices_ != NULL) delete bone_indices_;
-  bone_indices_ = NULL;
+
+void Node_Geometry_LOD::CopyFrom(const Node_Geometry_LOD& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:viro.Node.Geometry.LOD)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
-const ::viro::Node_Geometry_Source& Node_Geometry_Skin::bone_indices() const {
-  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Skin.bone_indices)
-  return bone_indices_ != NULL ? *bone_indices_
-                         : *::viro::Node_Geometry_Source::internal_default_instance();
+
+bool Node_Geometry_LOD::IsInitialized() const {
+  return true;
 }
-::viro::Node_Geometry_Source* Node_Geometry_Skin::mutable_bone_indices() {
 
-  if (bone_indices_ == NULL) {
-    bone_indices_ = new ::viro::Node_Geometry_Source;
-  }
-  // @@protoc_insertion_point(field_mutable:viro.Node.Geometry.Skin.bone_indices)
-  return bone_indices_;
+void Node_Geometry_LOD::Swap(Node_Geometry_LOD* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void Node_Geometry_LOD::InternalSwap(Node_Geometry_LOD* other) {
+  element_.UnsafeArenaSwap(&other->element_);
+  std::swap(screen_size_, other->screen_size_);
+  std::swap(error_, other->error_);
+  std::swap(_cached_size_, other->_cached_size_);
 }
-::viro::Node_Geometry_Source* Node_Geometry_Skin::release_bone_indices() {
-  // @@protoc_insertion_point(field_release:viro.Node.Geometry.Skin.bone_indices)
 
-  ::viro::Node_Geometry_Source* temp = bone_indices_;
-  bone_indices_ = NULL;
-  return temp;
+::std::string Node_Geometry_LOD::GetTypeName() const {
+  return "viro.Node.Geometry.LOD";
 }
-void Node_Geometry_Skin::set_allocated_bone_indices(::viro::Node_Geometry_Source* bone_indices) {
-  delete bone_indices_;
-  bone_indices_ = bone_indices;
-  if (bone_indices) {
 
-  } else {
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// Node_Geometry_LOD
 
-  }
-  // @@protoc_insertion_point(field_set_allocated:viro.Node.Geometry.Skin.bone_indices)
+// repeated .viro.Node.Geometry.Element element = 1;
+int Node_Geometry_LOD::element_size() const {
+  return element_.size();
 }
-
-// .viro.Node.Geometry.Source bone_weights = 4;
-bool Node_Geometry_Skin::has_bone_weights() const {
-  return this != internal_default_instance() && bone_weights_ != NULL;
+void Node_Geometry_LOD::clear_element() {
+  element_.Clear();
 }
-void Node_Geometry_Skin::clear_bone_weights() {
-  if (GetArenaNoVirtual() == NULL && bone_weights_ != NULL) delete bone_weights_;
-  bone_weights_ = NULL;
+const ::viro::Node_Geometry_Element& Node_Geometry_LOD::element(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.LOD.element)
+  return element_.Get(index);
 }
-const ::viro::Node_Geometry_Source& Node_Geometry_Skin::bone_weights() const {
-  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Skin.bone_weights)
-  return bone_weights_ != NULL ? *bone_weights_
-                         : *::viro::Node_Geometry_Source::internal_default_instance();
+::viro::Node_Geometry_Element* Node_Geometry_LOD::mutable_element(int index) {
+  // @@protoc_insertion_point(field_mutable:viro.Node.Geometry.LOD.element)
+  return element_.Mutable(index);
+}
+::viro::Node_Geometry_Element* Node_Geometry_LOD::add_element() {
+  // @@protoc_insertion_point(field_add:viro.Node.Geometry.LOD.element)
+  return element_.Add();
+}
+::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Element >*
+Node_Geometry_LOD::mutable_element() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.Geometry.LOD.element)
+  return &element_;
+}
+const ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Element >&
+Node_Geometry_LOD::element() const {
+  // @@protoc_insertion_point(field_list:viro.Node.Geometry.LOD.element)
+  return element_;
 }
-::viro::Node_Geometry_Source* Node_Geometry_Skin::mutable_bone_weights() {
 
-  if (bone_weights_ == NULL) {
-    bone_weights_ = new ::viro::Node_Geometry_Source;
-  }
-  // @@protoc_insertion_point(field_mutable:viro.Node.Geometry.Skin.bone_weights)
-  return bone_weights_;
+// float screen_size = 2;
+void Node_Geometry_LOD::clear_screen_size() {
+  screen_size_ = 0;
 }
-::viro::Node_Geometry_Source* Node_Geometry_Skin::release_bone_weights() {
-  // @@protoc_insertion_point(field_release:viro.Node.Geometry.Skin.bone_weights)
+float Node_Geometry_LOD::screen_size() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.LOD.screen_size)
+  return screen_size_;
+}
+void Node_Geometry_LOD::set_screen_size(float value) {
 
-  ::viro::Node_Geometry_Source* temp = bone_weights_;
-  bone_weights_ = NULL;
-  return temp;
+  screen_size_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.LOD.screen_size)
 }
-void Node_Geometry_Skin::set_allocated_bone_weights(::viro::Node_Geometry_Source* bone_weights) {
-  delete bone_weights_;
-  bone_weights_ = bone_weights;
-  if (bone_weights) {
 
-  } else {
+// float error = 3;
+void Node_Geometry_LOD::clear_error() {
+  error_ = 0;
+}
+float Node_Geometry_LOD::error() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.LOD.error)
+  return error_;
+}
+void Node_Geometry_LOD::set_error(float value) {
 
-  }
-  // @@protoc_insertion_point(field_set_allocated:viro.Node.Geometry.Skin.bone_weights)
+  error_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.LOD.error)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -3937,6 +6605,9 @@ const int Node_Geometry::kSourceFieldNumber;
 const int Node_Geometry::kElementFieldNumber;
 const int Node_Geometry::kMaterialFieldNumber;
 const int Node_Geometry::kSkinFieldNumber;
+const int Node_Geometry::kLodFieldNumber;
+const int Node_Geometry::kProgressiveParentFieldNumber;
+const int Node_Geometry::kDataEncodingFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 Node_Geometry::Node_Geometry()
@@ -3953,6 +6624,8 @@ Node_Geometry::Node_Geometry(const Node_Geometry& from)
       source_(from.source_),
       element_(from.element_),
       material_(from.material_),
+      lod_(from.lod_),
+      progressive_parent_(from.progressive_parent_),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
@@ -3968,6 +6641,7 @@ Node_Geometry::Node_Geometry(const Node_Geometry& from)
   } else {
     skin_ = NULL;
   }
+  data_encoding_ = from.data_encoding_;
   // @@protoc_insertion_point(copy_constructor:viro.Node.Geometry)
 }
 
@@ -3975,6 +6649,7 @@ void Node_Geometry::SharedCtor() {
   name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   skin_ = NULL;
+  data_encoding_ = 0;
   _cached_size_ = 0;
 }
 
@@ -4014,12 +6689,15 @@ void Node_Geometry::Clear() {
   source_.Clear();
   element_.Clear();
   material_.Clear();
+  lod_.Clear();
+  progressive_parent_.Clear();
   name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (GetArenaNoVirtual() == NULL && skin_ != NULL) {
     delete skin_;
   }
   skin_ = NULL;
+  data_encoding_ = 0;
 }
 
 bool Node_Geometry::MergePartialFromCodedStream(
@@ -4108,6 +6786,49 @@ bool Node_Geometry::MergePartialFromCodedStream(
         break;
       }
 
+      // repeated .viro.Node.Geometry.LOD lod = 7;
+      case 7: {
+        if (tag == 58u) {
+          DO_(input->IncrementRecursionDepth());
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtualNoRecursionDepth(
+                input, add_lod()));
+        } else {
+          goto handle_unusual;
+        }
+        input->UnsafeDecrementRecursionDepth();
+        break;
+      }
+
+      // repeated uint32 progressive_parent = 8;
+      case 8: {
+        if (tag == 66u) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, this->mutable_progressive_parent())));
+        } else if (tag == 64u) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 1, 66u, input, this->mutable_progressive_parent())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .viro.Node.Geometry.Encoding data_encoding = 9;
+      case 9: {
+        if (tag == 72u) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_data_encoding(static_cast< ::viro::Node_Geometry_Encoding >(value));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0 ||
@@ -4172,6 +6893,28 @@ void Node_Geometry::SerializeWithCachedSizes(
       6, *this->skin_, output);
   }
 
+  // repeated .viro.Node.Geometry.LOD lod = 7;
+  for (unsigned int i = 0, n = this->lod_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      7, this->lod(i), output);
+  }
+
+  // repeated uint32 progressive_parent = 8;
+  if (this->progressive_parent_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(8, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_progressive_parent_cached_byte_size_);
+  }
+  for (int i = 0, n = this->progressive_parent_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32NoTag(
+      this->progressive_parent(i), output);
+  }
+
+  // .viro.Node.Geometry.Encoding data_encoding = 9;
+  if (this->data_encoding() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      9, this->data_encoding(), output);
+  }
+
   // @@protoc_insertion_point(serialize_end:viro.Node.Geometry)
 }
 
@@ -4233,6 +6976,38 @@ size_t Node_Geometry::ByteSizeLong() const {
         *this->skin_);
   }
 
+  // repeated .viro.Node.Geometry.LOD lod = 7;
+  {
+    unsigned int count = this->lod_size();
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->lod(i));
+    }
+  }
+
+  // repeated uint32 progressive_parent = 8;
+  {
+    size_t data_size = ::google::protobuf::internal::WireFormatLite::
+      UInt32Size(this->progressive_parent_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _progressive_parent_cached_byte_size_ = cached_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  // .viro.Node.Geometry.Encoding data_encoding = 9;
+  if (this->data_encoding() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->data_encoding());
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -4263,6 +7038,11 @@ void Node_Geometry::MergeFrom(const Node_Geometry& from) {
   if (from.has_skin()) {
     mutable_skin()->::viro::Node_Geometry_Skin::MergeFrom(from.skin());
   }
+  lod_.MergeFrom(from.lod_);
+  progressive_parent_.MergeFrom(from.progressive_parent_);
+  if (from.data_encoding() != 0) {
+    set_data_encoding(from.data_encoding());
+  }
 }
 
 void Node_Geometry::CopyFrom(const Node_Geometry& from) {
@@ -4287,6 +7067,9 @@ void Node_Geometry::InternalSwap(Node_Geometry* other) {
   name_.Swap(&other->name_);
   data_.Swap(&other->data_);
   std::swap(skin_, other->skin_);
+  lod_.UnsafeArenaSwap(&other->lod_);
+  progressive_parent_.UnsafeArenaSwap(&other->progressive_parent_);
+  std::swap(data_encoding_, other->data_encoding_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
@@ -4530,6 +7313,80 @@ void Node_Geometry::set_allocated_skin(::viro::Node_Geometry_Skin* skin) {
   // @@protoc_insertion_point(field_set_allocated:viro.Node.Geometry.skin)
 }
 
+// repeated .viro.Node.Geometry.LOD lod = 7;
+int Node_Geometry::lod_size() const {
+  return lod_.size();
+}
+void Node_Geometry::clear_lod() {
+  lod_.Clear();
+}
+const ::viro::Node_Geometry_LOD& Node_Geometry::lod(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.lod)
+  return lod_.Get(index);
+}
+::viro::Node_Geometry_LOD* Node_Geometry::mutable_lod(int index) {
+  // @@protoc_insertion_point(field_mutable:viro.Node.Geometry.lod)
+  return lod_.Mutable(index);
+}
+::viro::Node_Geometry_LOD* Node_Geometry::add_lod() {
+  // @@protoc_insertion_point(field_add:viro.Node.Geometry.lod)
+  return lod_.Add();
+}
+::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_LOD >*
+Node_Geometry::mutable_lod() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.Geometry.lod)
+  return &lod_;
+}
+const ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_LOD >&
+Node_Geometry::lod() const {
+  // @@protoc_insertion_point(field_list:viro.Node.Geometry.lod)
+  return lod_;
+}
+
+// repeated uint32 progressive_parent = 8;
+int Node_Geometry::progressive_parent_size() const {
+  return progressive_parent_.size();
+}
+void Node_Geometry::clear_progressive_parent() {
+  progressive_parent_.Clear();
+}
+::google::protobuf::uint32 Node_Geometry::progressive_parent(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.progressive_parent)
+  return progressive_parent_.Get(index);
+}
+void Node_Geometry::set_progressive_parent(int index, ::google::protobuf::uint32 value) {
+  progressive_parent_.Set(index, value);
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.progressive_parent)
+}
+void Node_Geometry::add_progressive_parent(::google::protobuf::uint32 value) {
+  progressive_parent_.Add(value);
+  // @@protoc_insertion_point(field_add:viro.Node.Geometry.progressive_parent)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+Node_Geometry::progressive_parent() const {
+  // @@protoc_insertion_point(field_list:viro.Node.Geometry.progressive_parent)
+  return progressive_parent_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+Node_Geometry::mutable_progressive_parent() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.Geometry.progressive_parent)
+  return &progressive_parent_;
+}
+
+// .viro.Node.Geometry.Encoding data_encoding = 9;
+void Node_Geometry::clear_data_encoding() {
+  data_encoding_ = 0;
+}
+::viro::Node_Geometry_Encoding Node_Geometry::data_encoding() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.data_encoding)
+  return static_cast< ::viro::Node_Geometry_Encoding >(data_encoding_);
+}
+void Node_Geometry::set_data_encoding(::viro::Node_Geometry_Encoding value) {
+
+  data_encoding_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.data_encoding)
+}
+
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
@@ -5193,6 +8050,8 @@ const int Node_SkeletalAnimation_Frame::kTimeFieldNumber;
 const int Node_SkeletalAnimation_Frame::kBoneIndexFieldNumber;
 const int Node_SkeletalAnimation_Frame::kTransformFieldNumber;
 const int Node_SkeletalAnimation_Frame::kLocalTransformFieldNumber;
+const int Node_SkeletalAnimation_Frame::kDualQuaternionFieldNumber;
+const int Node_SkeletalAnimation_Frame::kLocalDualQuaternionFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 Node_SkeletalAnimation_Frame::Node_SkeletalAnimation_Frame()
@@ -5209,6 +8068,8 @@ Node_SkeletalAnimation_Frame::Node_SkeletalAnimation_Frame(const Node_SkeletalAn
       bone_index_(from.bone_index_),
       transform_(from.transform_),
       local_transform_(from.local_transform_),
+      dual_quaternion_(from.dual_quaternion_),
+      local_dual_quaternion_(from.local_dual_quaternion_),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   time_ = from.time_;
@@ -5251,6 +8112,8 @@ void Node_SkeletalAnimation_Frame::Clear() {
   bone_index_.Clear();
   transform_.Clear();
   local_transform_.Clear();
+  dual_quaternion_.Clear();
+  local_dual_quaternion_.Clear();
   time_ = 0;
 }
 
@@ -5319,6 +8182,32 @@ bool Node_SkeletalAnimation_Frame::MergePartialFromCodedStream(
         break;
       }
 
+      // repeated .viro.Node.DualQuaternion dual_quaternion = 5;
+      case 5: {
+        if (tag == 42u) {
+          DO_(input->IncrementRecursionDepth());
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtualNoRecursionDepth(
+                input, add_dual_quaternion()));
+        } else {
+          goto handle_unusual;
+        }
+        input->UnsafeDecrementRecursionDepth();
+        break;
+      }
+
+      // repeated .viro.Node.DualQuaternion local_dual_quaternion = 6;
+      case 6: {
+        if (tag == 50u) {
+          DO_(input->IncrementRecursionDepth());
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtualNoRecursionDepth(
+                input, add_local_dual_quaternion()));
+        } else {
+          goto handle_unusual;
+        }
+        input->UnsafeDecrementRecursionDepth();
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0 ||
@@ -5370,6 +8259,18 @@ void Node_SkeletalAnimation_Frame::SerializeWithCachedSizes(
       4, this->local_transform(i), output);
   }
 
+  // repeated .viro.Node.DualQuaternion dual_quaternion = 5;
+  for (unsigned int i = 0, n = this->dual_quaternion_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      5, this->dual_quaternion(i), output);
+  }
+
+  // repeated .viro.Node.DualQuaternion local_dual_quaternion = 6;
+  for (unsigned int i = 0, n = this->local_dual_quaternion_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      6, this->local_dual_quaternion(i), output);
+  }
+
   // @@protoc_insertion_point(serialize_end:viro.Node.SkeletalAnimation.Frame)
 }
 
@@ -5419,6 +8320,28 @@ size_t Node_SkeletalAnimation_Frame::ByteSizeLong() const {
     total_size += 1 + 4;
   }
 
+  // repeated .viro.Node.DualQuaternion dual_quaternion = 5;
+  {
+    unsigned int count = this->dual_quaternion_size();
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->dual_quaternion(i));
+    }
+  }
+
+  // repeated .viro.Node.DualQuaternion local_dual_quaternion = 6;
+  {
+    unsigned int count = this->local_dual_quaternion_size();
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->local_dual_quaternion(i));
+    }
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -5441,6 +8364,8 @@ void Node_SkeletalAnimation_Frame::MergeFrom(const Node_SkeletalAnimation_Frame&
   if (from.time() != 0) {
     set_time(from.time());
   }
+  dual_quaternion_.MergeFrom(from.dual_quaternion_);
+  local_dual_quaternion_.MergeFrom(from.local_dual_quaternion_);
 }
 
 void Node_SkeletalAnimation_Frame::CopyFrom(const Node_SkeletalAnimation_Frame& from) {
@@ -5463,6 +8388,8 @@ void Node_SkeletalAnimation_Frame::InternalSwap(Node_SkeletalAnimation_Frame* ot
   transform_.UnsafeArenaSwap(&other->transform_);
   local_transform_.UnsafeArenaSwap(&other->local_transform_);
   std::swap(time_, other->time_);
+  dual_quaternion_.UnsafeArenaSwap(&other->dual_quaternion_);
+  local_dual_quaternion_.UnsafeArenaSwap(&other->local_dual_quaternion_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
@@ -5562,19 +8489,79 @@ const ::viro::Node_Matrix& Node_SkeletalAnimation_Frame::local_transform(int ind
   // @@protoc_insertion_point(field_mutable:viro.Node.SkeletalAnimation.Frame.local_transform)
   return local_transform_.Mutable(index);
 }
-::viro::Node_Matrix* Node_SkeletalAnimation_Frame::add_local_transform() {
-  // @@protoc_insertion_point(field_add:viro.Node.SkeletalAnimation.Frame.local_transform)
-  return local_transform_.Add();
+::viro::Node_Matrix* Node_SkeletalAnimation_Frame::add_local_transform() {
+  // @@protoc_insertion_point(field_add:viro.Node.SkeletalAnimation.Frame.local_transform)
+  return local_transform_.Add();
+}
+::google::protobuf::RepeatedPtrField< ::viro::Node_Matrix >*
+Node_SkeletalAnimation_Frame::mutable_local_transform() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.SkeletalAnimation.Frame.local_transform)
+  return &local_transform_;
+}
+const ::google::protobuf::RepeatedPtrField< ::viro::Node_Matrix >&
+Node_SkeletalAnimation_Frame::local_transform() const {
+  // @@protoc_insertion_point(field_list:viro.Node.SkeletalAnimation.Frame.local_transform)
+  return local_transform_;
+}
+
+// repeated .viro.Node.DualQuaternion dual_quaternion = 5;
+int Node_SkeletalAnimation_Frame::dual_quaternion_size() const {
+  return dual_quaternion_.size();
+}
+void Node_SkeletalAnimation_Frame::clear_dual_quaternion() {
+  dual_quaternion_.Clear();
+}
+const ::viro::Node_DualQuaternion& Node_SkeletalAnimation_Frame::dual_quaternion(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.SkeletalAnimation.Frame.dual_quaternion)
+  return dual_quaternion_.Get(index);
+}
+::viro::Node_DualQuaternion* Node_SkeletalAnimation_Frame::mutable_dual_quaternion(int index) {
+  // @@protoc_insertion_point(field_mutable:viro.Node.SkeletalAnimation.Frame.dual_quaternion)
+  return dual_quaternion_.Mutable(index);
+}
+::viro::Node_DualQuaternion* Node_SkeletalAnimation_Frame::add_dual_quaternion() {
+  // @@protoc_insertion_point(field_add:viro.Node.SkeletalAnimation.Frame.dual_quaternion)
+  return dual_quaternion_.Add();
+}
+::google::protobuf::RepeatedPtrField< ::viro::Node_DualQuaternion >*
+Node_SkeletalAnimation_Frame::mutable_dual_quaternion() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.SkeletalAnimation.Frame.dual_quaternion)
+  return &dual_quaternion_;
+}
+const ::google::protobuf::RepeatedPtrField< ::viro::Node_DualQuaternion >&
+Node_SkeletalAnimation_Frame::dual_quaternion() const {
+  // @@protoc_insertion_point(field_list:viro.Node.SkeletalAnimation.Frame.dual_quaternion)
+  return dual_quaternion_;
+}
+
+// repeated .viro.Node.DualQuaternion local_dual_quaternion = 6;
+int Node_SkeletalAnimation_Frame::local_dual_quaternion_size() const {
+  return local_dual_quaternion_.size();
+}
+void Node_SkeletalAnimation_Frame::clear_local_dual_quaternion() {
+  local_dual_quaternion_.Clear();
+}
+const ::viro::Node_DualQuaternion& Node_SkeletalAnimation_Frame::local_dual_quaternion(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.SkeletalAnimation.Frame.local_dual_quaternion)
+  return local_dual_quaternion_.Get(index);
+}
+::viro::Node_DualQuaternion* Node_SkeletalAnimation_Frame::mutable_local_dual_quaternion(int index) {
+  // @@protoc_insertion_point(field_mutable:viro.Node.SkeletalAnimation.Frame.local_dual_quaternion)
+  return local_dual_quaternion_.Mutable(index);
 }
-::google::protobuf::RepeatedPtrField< ::viro::Node_Matrix >*
-Node_SkeletalAnimation_Frame::mutable_local_transform() {
-  // @@protoc_insertion_point(field_mutable_list:viro.Node.SkeletalAnimation.Frame.local_transform)
-  return &local_transform_;
+::viro::Node_DualQuaternion* Node_SkeletalAnimation_Frame::add_local_dual_quaternion() {
+  // @@protoc_insertion_point(field_add:viro.Node.SkeletalAnimation.Frame.local_dual_quaternion)
+  return local_dual_quaternion_.Add();
 }
-const ::google::protobuf::RepeatedPtrField< ::viro::Node_Matrix >&
-Node_SkeletalAnimation_Frame::local_transform() const {
-  // @@protoc_insertion_point(field_list:viro.Node.SkeletalAnimation.Frame.local_transform)
-  return local_transform_;
+::google::protobuf::RepeatedPtrField< ::viro::Node_DualQuaternion >*
+Node_SkeletalAnimation_Frame::mutable_local_dual_quaternion() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.SkeletalAnimation.Frame.local_dual_quaternion)
+  return &local_dual_quaternion_;
+}
+const ::google::protobuf::RepeatedPtrField< ::viro::Node_DualQuaternion >&
+Node_SkeletalAnimation_Frame::local_dual_quaternion() const {
+  // @@protoc_insertion_point(field_list:viro.Node.SkeletalAnimation.Frame.local_dual_quaternion)
+  return local_dual_quaternion_;
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -7761,6 +10748,260 @@ Node_Camera::mutable_position() {
 
 // ===================================================================
 
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int Node_GeometryInstance::kIndexFieldNumber;
+const int Node_GeometryInstance::kTransformFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+Node_GeometryInstance::Node_GeometryInstance()
+  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_Nodes_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:viro.Node.GeometryInstance)
+}
+Node_GeometryInstance::Node_GeometryInstance(const Node_GeometryInstance& from)
+  : ::google::protobuf::MessageLite(),
+      _internal_metadata_(NULL),
+      transform_(from.transform_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  index_ = from.index_;
+  // @@protoc_insertion_point(copy_constructor:viro.Node.GeometryInstance)
+}
+
+void Node_GeometryInstance::SharedCtor() {
+  index_ = 0u;
+  _cached_size_ = 0;
+}
+
+Node_GeometryInstance::~Node_GeometryInstance() {
+  // @@protoc_insertion_point(destructor:viro.Node.GeometryInstance)
+  SharedDtor();
+}
+
+void Node_GeometryInstance::SharedDtor() {
+}
+
+void Node_GeometryInstance::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const Node_GeometryInstance& Node_GeometryInstance::default_instance() {
+  protobuf_Nodes_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+Node_GeometryInstance* Node_GeometryInstance::New(::google::protobuf::Arena* arena) const {
+  Node_GeometryInstance* n = new Node_GeometryInstance;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void Node_GeometryInstance::Clear() {
+// @@protoc_insertion_point(message_clear_start:viro.Node.GeometryInstance)
+  transform_.Clear();
+  index_ = 0u;
+}
+
+bool Node_GeometryInstance::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:viro.Node.GeometryInstance)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // uint32 index = 1;
+      case 1: {
+        if (tag == 8u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &index_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .viro.Node.Matrix transform = 2;
+      case 2: {
+        if (tag == 18u) {
+          DO_(input->IncrementRecursionDepth());
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtualNoRecursionDepth(
+                input, add_transform()));
+        } else {
+          goto handle_unusual;
+        }
+        input->UnsafeDecrementRecursionDepth();
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:viro.Node.GeometryInstance)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:viro.Node.GeometryInstance)
+  return false;
+#undef DO_
+}
+
+void Node_GeometryInstance::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:viro.Node.GeometryInstance)
+  // uint32 index = 1;
+  if (this->index() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->index(), output);
+  }
+
+  // repeated .viro.Node.Matrix transform = 2;
+  for (unsigned int i = 0, n = this->transform_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      2, this->transform(i), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:viro.Node.GeometryInstance)
+}
+
+size_t Node_GeometryInstance::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:viro.Node.GeometryInstance)
+  size_t total_size = 0;
+
+  // uint32 index = 1;
+  if (this->index() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->index());
+  }
+
+  // repeated .viro.Node.Matrix transform = 2;
+  {
+    unsigned int count = this->transform_size();
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->transform(i));
+    }
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void Node_GeometryInstance::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const Node_GeometryInstance*>(&from));
+}
+
+void Node_GeometryInstance::MergeFrom(const Node_GeometryInstance& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:viro.Node.GeometryInstance)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.index() != 0) {
+    set_index(from.index());
+  }
+  transform_.MergeFrom(from.transform_);
+}
+
+void Node_GeometryInstance::CopyFrom(const Node_GeometryInstance& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:viro.Node.GeometryInstance)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Node_GeometryInstance::IsInitialized() const {
+  return true;
+}
+
+void Node_GeometryInstance::Swap(Node_GeometryInstance* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void Node_GeometryInstance::InternalSwap(Node_GeometryInstance* other) {
+  std::swap(index_, other->index_);
+  transform_.UnsafeArenaSwap(&other->transform_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::std::string Node_GeometryInstance::GetTypeName() const {
+  return "viro.Node.GeometryInstance";
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// Node_GeometryInstance
+
+// uint32 index = 1;
+void Node_GeometryInstance::clear_index() {
+  index_ = 0u;
+}
+::google::protobuf::uint32 Node_GeometryInstance::index() const {
+  // @@protoc_insertion_point(field_get:viro.Node.GeometryInstance.index)
+  return index_;
+}
+void Node_GeometryInstance::set_index(::google::protobuf::uint32 value) {
+
+  index_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.GeometryInstance.index)
+}
+
+// repeated .viro.Node.Matrix transform = 2;
+int Node_GeometryInstance::transform_size() const {
+  return transform_.size();
+}
+void Node_GeometryInstance::clear_transform() {
+  transform_.Clear();
+}
+const ::viro::Node_Matrix& Node_GeometryInstance::transform(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.GeometryInstance.transform)
+  return transform_.Get(index);
+}
+::viro::Node_Matrix* Node_GeometryInstance::mutable_transform(int index) {
+  // @@protoc_insertion_point(field_mutable:viro.Node.GeometryInstance.transform)
+  return transform_.Mutable(index);
+}
+::viro::Node_Matrix* Node_GeometryInstance::add_transform() {
+  // @@protoc_insertion_point(field_add:viro.Node.GeometryInstance.transform)
+  return transform_.Add();
+}
+::google::protobuf::RepeatedPtrField< ::viro::Node_Matrix >*
+Node_GeometryInstance::mutable_transform() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.GeometryInstance.transform)
+  return &transform_;
+}
+const ::google::protobuf::RepeatedPtrField< ::viro::Node_Matrix >&
+Node_GeometryInstance::transform() const {
+  // @@protoc_insertion_point(field_list:viro.Node.GeometryInstance.transform)
+  return transform_;
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
 const int Node::kNameFieldNumber;
 const int Node::kPositionFieldNumber;
@@ -7775,6 +11016,8 @@ const int Node::kKeyframeAnimationFieldNumber;
 const int Node::kLightFieldNumber;
 const int Node::kCameraFieldNumber;
 const int Node::kSubnodeFieldNumber;
+const int Node::kSharedGeometryFieldNumber;
+const int Node::kGeometryInstanceFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 Node::Node()
@@ -7795,6 +11038,7 @@ Node::Node(const Node& from)
       keyframe_animation_(from.keyframe_animation_),
       light_(from.light_),
       subnode_(from.subnode_),
+      shared_geometry_(from.shared_geometry_),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
@@ -7819,6 +11063,11 @@ Node::Node(const Node& from)
   ::memcpy(&rendering_order_, &from.rendering_order_,
     reinterpret_cast<char*>(&opacity_) -
     reinterpret_cast<char*>(&rendering_order_) + sizeof(opacity_));
+  if (from.has_geometry_instance()) {
+    geometry_instance_ = new ::viro::Node_GeometryInstance(*from.geometry_instance_);
+  } else {
+    geometry_instance_ = NULL;
+  }
   // @@protoc_insertion_point(copy_constructor:viro.Node)
 }
 
@@ -7826,6 +11075,7 @@ void Node::SharedCtor() {
   name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(&geometry_, 0, reinterpret_cast<char*>(&opacity_) -
     reinterpret_cast<char*>(&geometry_) + sizeof(opacity_));
+  geometry_instance_ = NULL;
   _cached_size_ = 0;
 }
 
@@ -7845,6 +11095,9 @@ void Node::SharedDtor() {
   if (this != internal_default_instance()) {
     delete camera_;
   }
+  if (this != internal_default_instance()) {
+    delete geometry_instance_;
+  }
 }
 
 void Node::SetCachedSize(int size) const {
@@ -7874,6 +11127,7 @@ void Node::Clear() {
   keyframe_animation_.Clear();
   light_.Clear();
   subnode_.Clear();
+  shared_geometry_.Clear();
   name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (GetArenaNoVirtual() == NULL && geometry_ != NULL) {
     delete geometry_;
@@ -7889,6 +11143,10 @@ void Node::Clear() {
   camera_ = NULL;
   ::memset(&rendering_order_, 0, reinterpret_cast<char*>(&opacity_) -
     reinterpret_cast<char*>(&rendering_order_) + sizeof(opacity_));
+  if (GetArenaNoVirtual() == NULL && geometry_instance_ != NULL) {
+    delete geometry_instance_;
+  }
+  geometry_instance_ = NULL;
 }
 
 bool Node::MergePartialFromCodedStream(
@@ -8075,6 +11333,30 @@ bool Node::MergePartialFromCodedStream(
         break;
       }
 
+      // repeated .viro.Node.Geometry shared_geometry = 14;
+      case 14: {
+        if (tag == 114u) {
+          DO_(input->IncrementRecursionDepth());
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtualNoRecursionDepth(
+                input, add_shared_geometry()));
+        } else {
+          goto handle_unusual;
+        }
+        input->UnsafeDecrementRecursionDepth();
+        break;
+      }
+
+      // .viro.Node.GeometryInstance geometry_instance = 15;
+      case 15: {
+        if (tag == 122u) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_geometry_instance()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0 ||
@@ -8185,6 +11467,18 @@ void Node::SerializeWithCachedSizes(
       13, this->subnode(i), output);
   }
 
+  // repeated .viro.Node.Geometry shared_geometry = 14;
+  for (unsigned int i = 0, n = this->shared_geometry_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      14, this->shared_geometry(i), output);
+  }
+
+  // .viro.Node.GeometryInstance geometry_instance = 15;
+  if (this->has_geometry_instance()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      15, *this->geometry_instance_, output);
+  }
+
   // @@protoc_insertion_point(serialize_end:viro.Node)
 }
 
@@ -8321,6 +11615,24 @@ size_t Node::ByteSizeLong() const {
     total_size += 1 + 4;
   }
 
+  // repeated .viro.Node.Geometry shared_geometry = 14;
+  {
+    unsigned int count = this->shared_geometry_size();
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->shared_geometry(i));
+    }
+  }
+
+  // .viro.Node.GeometryInstance geometry_instance = 15;
+  if (this->has_geometry_instance()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->geometry_instance_);
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -8363,6 +11675,10 @@ void Node::MergeFrom(const Node& from) {
   if (from.opacity() != 0) {
     set_opacity(from.opacity());
   }
+  shared_geometry_.MergeFrom(from.shared_geometry_);
+  if (from.has_geometry_instance()) {
+    mutable_geometry_instance()->::viro::Node_GeometryInstance::MergeFrom(from.geometry_instance());
+  }
 }
 
 void Node::CopyFrom(const Node& from) {
@@ -8394,6 +11710,8 @@ void Node::InternalSwap(Node* other) {
   std::swap(camera_, other->camera_);
   std::swap(rendering_order_, other->rendering_order_);
   std::swap(opacity_, other->opacity_);
+  shared_geometry_.UnsafeArenaSwap(&other->shared_geometry_);
+  std::swap(geometry_instance_, other->geometry_instance_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
@@ -8811,6 +12129,75 @@ Node::subnode() const {
   return subnode_;
 }
 
+// repeated .viro.Node.Geometry shared_geometry = 14;
+int Node::shared_geometry_size() const {
+  return shared_geometry_.size();
+}
+void Node::clear_shared_geometry() {
+  shared_geometry_.Clear();
+}
+const ::viro::Node_Geometry& Node::shared_geometry(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.shared_geometry)
+  return shared_geometry_.Get(index);
+}
+::viro::Node_Geometry* Node::mutable_shared_geometry(int index) {
+  // @@protoc_insertion_point(field_mutable:viro.Node.shared_geometry)
+  return shared_geometry_.Mutable(index);
+}
+::viro::Node_Geometry* Node::add_shared_geometry() {
+  // @@protoc_insertion_point(field_add:viro.Node.shared_geometry)
+  return shared_geometry_.Add();
+}
+::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry >*
+Node::mutable_shared_geometry() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.shared_geometry)
+  return &shared_geometry_;
+}
+const ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry >&
+Node::shared_geometry() const {
+  // @@protoc_insertion_point(field_list:viro.Node.shared_geometry)
+  return shared_geometry_;
+}
+
+// .viro.Node.GeometryInstance geometry_instance = 15;
+bool Node::has_geometry_instance() const {
+  return this != internal_default_instance() && geometry_instance_ != NULL;
+}
+void Node::clear_geometry_instance() {
+  if (GetArenaNoVirtual() == NULL && geometry_instance_ != NULL) delete geometry_instance_;
+  geometry_instance_ = NULL;
+}
+const ::viro::Node_GeometryInstance& Node::geometry_instance() const {
+  // @@protoc_insertion_point(field_get:viro.Node.geometry_instance)
+  return geometry_instance_ != NULL ? *geometry_instance_
+                         : *::viro::Node_GeometryInstance::internal_default_instance();
+}
+::viro::Node_GeometryInstance* Node::mutable_geometry_instance() {
+
+  if (geometry_instance_ == NULL) {
+    geometry_instance_ = new ::viro::Node_GeometryInstance;
+  }
+  // @@protoc_insertion_point(field_mutable:viro.Node.geometry_instance)
+  return geometry_instance_;
+}
+::viro::Node_GeometryInstance* Node::release_geometry_instance() {
+  // @@protoc_insertion_point(field_release:viro.Node.geometry_instance)
+
+  ::viro::Node_GeometryInstance* temp = geometry_instance_;
+  geometry_instance_ = NULL;
+  return temp;
+}
+void Node::set_allocated_geometry_instance(::viro::Node_GeometryInstance* geometry_instance) {
+  delete geometry_instance_;
+  geometry_instance_ = geometry_instance;
+  if (geometry_instance) {
+
+  } else {
+
+  }
+  // @@protoc_insertion_point(field_set_allocated:viro.Node.geometry_instance)
+}
+
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // @@protoc_insertion_point(namespace_scope)
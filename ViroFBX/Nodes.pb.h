@@ -36,12 +36,30 @@ extern NodeDefaultTypeInternal _Node_default_instance_;
 class Node_Camera;
 class Node_CameraDefaultTypeInternal;
 extern Node_CameraDefaultTypeInternal _Node_Camera_default_instance_;
+class Node_DualQuaternion;
+class Node_DualQuaternionDefaultTypeInternal;
+extern Node_DualQuaternionDefaultTypeInternal _Node_DualQuaternion_default_instance_;
 class Node_Geometry;
 class Node_GeometryDefaultTypeInternal;
 extern Node_GeometryDefaultTypeInternal _Node_Geometry_default_instance_;
+class Node_GeometryInstance;
+class Node_GeometryInstanceDefaultTypeInternal;
+extern Node_GeometryInstanceDefaultTypeInternal _Node_GeometryInstance_default_instance_;
 class Node_Geometry_Element;
 class Node_Geometry_ElementDefaultTypeInternal;
 extern Node_Geometry_ElementDefaultTypeInternal _Node_Geometry_Element_default_instance_;
+class Node_Geometry_Element_BonePartition;
+class Node_Geometry_Element_BonePartitionDefaultTypeInternal;
+extern Node_Geometry_Element_BonePartitionDefaultTypeInternal _Node_Geometry_Element_BonePartition_default_instance_;
+class Node_Geometry_Element_Meshlet;
+class Node_Geometry_Element_MeshletDefaultTypeInternal;
+extern Node_Geometry_Element_MeshletDefaultTypeInternal _Node_Geometry_Element_Meshlet_default_instance_;
+class Node_Geometry_Element_ProgressiveLevel;
+class Node_Geometry_Element_ProgressiveLevelDefaultTypeInternal;
+extern Node_Geometry_Element_ProgressiveLevelDefaultTypeInternal _Node_Geometry_Element_ProgressiveLevel_default_instance_;
+class Node_Geometry_LOD;
+class Node_Geometry_LODDefaultTypeInternal;
+extern Node_Geometry_LODDefaultTypeInternal _Node_Geometry_LOD_default_instance_;
 class Node_Geometry_Material;
 class Node_Geometry_MaterialDefaultTypeInternal;
 extern Node_Geometry_MaterialDefaultTypeInternal _Node_Geometry_Material_default_instance_;
@@ -51,6 +69,9 @@ extern Node_Geometry_Material_VisualDefaultTypeInternal _Node_Geometry_Material_
 class Node_Geometry_Skin;
 class Node_Geometry_SkinDefaultTypeInternal;
 extern Node_Geometry_SkinDefaultTypeInternal _Node_Geometry_Skin_default_instance_;
+class Node_Geometry_Skin_InfluenceTier;
+class Node_Geometry_Skin_InfluenceTierDefaultTypeInternal;
+extern Node_Geometry_Skin_InfluenceTierDefaultTypeInternal _Node_Geometry_Skin_InfluenceTier_default_instance_;
 class Node_Geometry_Source;
 class Node_Geometry_SourceDefaultTypeInternal;
 extern Node_Geometry_SourceDefaultTypeInternal _Node_Geometry_Source_default_instance_;
@@ -103,14 +124,27 @@ enum Node_Geometry_Source_Semantic {
   Node_Geometry_Source_Semantic_EdgeCrease = 6,
   Node_Geometry_Source_Semantic_BoneWeights = 7,
   Node_Geometry_Source_Semantic_BoneIndices = 8,
+  Node_Geometry_Source_Semantic_QTangent = 9,
   Node_Geometry_Source_Semantic_Node_Geometry_Source_Semantic_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
   Node_Geometry_Source_Semantic_Node_Geometry_Source_Semantic_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
 };
 bool Node_Geometry_Source_Semantic_IsValid(int value);
 const Node_Geometry_Source_Semantic Node_Geometry_Source_Semantic_Semantic_MIN = Node_Geometry_Source_Semantic_Vertex;
-const Node_Geometry_Source_Semantic Node_Geometry_Source_Semantic_Semantic_MAX = Node_Geometry_Source_Semantic_BoneIndices;
+const Node_Geometry_Source_Semantic Node_Geometry_Source_Semantic_Semantic_MAX = Node_Geometry_Source_Semantic_QTangent;
 const int Node_Geometry_Source_Semantic_Semantic_ARRAYSIZE = Node_Geometry_Source_Semantic_Semantic_MAX + 1;
 
+enum Node_Geometry_Source_Normalization {
+  Node_Geometry_Source_Normalization_NotNormalized = 0,
+  Node_Geometry_Source_Normalization_SNorm = 1,
+  Node_Geometry_Source_Normalization_UNorm = 2,
+  Node_Geometry_Source_Normalization_Node_Geometry_Source_Normalization_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
+  Node_Geometry_Source_Normalization_Node_Geometry_Source_Normalization_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+};
+bool Node_Geometry_Source_Normalization_IsValid(int value);
+const Node_Geometry_Source_Normalization Node_Geometry_Source_Normalization_Normalization_MIN = Node_Geometry_Source_Normalization_NotNormalized;
+const Node_Geometry_Source_Normalization Node_Geometry_Source_Normalization_Normalization_MAX = Node_Geometry_Source_Normalization_UNorm;
+const int Node_Geometry_Source_Normalization_Normalization_ARRAYSIZE = Node_Geometry_Source_Normalization_Normalization_MAX + 1;
+
 enum Node_Geometry_Element_Primitive {
   Node_Geometry_Element_Primitive_Triangle = 0,
   Node_Geometry_Element_Primitive_TriangleStrip = 1,
@@ -190,6 +224,18 @@ const Node_Geometry_Material_BlendMode Node_Geometry_Material_BlendMode_BlendMod
 const Node_Geometry_Material_BlendMode Node_Geometry_Material_BlendMode_BlendMode_MAX = Node_Geometry_Material_BlendMode_Replace;
 const int Node_Geometry_Material_BlendMode_BlendMode_ARRAYSIZE = Node_Geometry_Material_BlendMode_BlendMode_MAX + 1;
 
+enum Node_Geometry_Encoding {
+  Node_Geometry_Encoding_Raw = 0,
+  Node_Geometry_Encoding_MeshVertex = 1,
+  Node_Geometry_Encoding_MeshIndex = 2,
+  Node_Geometry_Encoding_Node_Geometry_Encoding_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
+  Node_Geometry_Encoding_Node_Geometry_Encoding_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+};
+bool Node_Geometry_Encoding_IsValid(int value);
+const Node_Geometry_Encoding Node_Geometry_Encoding_Encoding_MIN = Node_Geometry_Encoding_Raw;
+const Node_Geometry_Encoding Node_Geometry_Encoding_Encoding_MAX = Node_Geometry_Encoding_MeshIndex;
+const int Node_Geometry_Encoding_Encoding_ARRAYSIZE = Node_Geometry_Encoding_Encoding_MAX + 1;
+
 enum Node_Light_LightType {
   Node_Light_LightType_Ambient = 0,
   Node_Light_LightType_Directional = 1,
@@ -288,6 +334,89 @@ class Node_Matrix : public ::google::protobuf::MessageLite /* @@protoc_insertion
 };
 // -------------------------------------------------------------------
 
+class Node_DualQuaternion : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:viro.Node.DualQuaternion) */ {
+ public:
+  Node_DualQuaternion();
+  virtual ~Node_DualQuaternion();
+
+  Node_DualQuaternion(const Node_DualQuaternion& from);
+
+  inline Node_DualQuaternion& operator=(const Node_DualQuaternion& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  static const Node_DualQuaternion& default_instance();
+
+  static inline const Node_DualQuaternion* internal_default_instance() {
+    return reinterpret_cast<const Node_DualQuaternion*>(
+               &_Node_DualQuaternion_default_instance_);
+  }
+
+  void Swap(Node_DualQuaternion* other);
+
+  // implements Message ----------------------------------------------
+
+  inline Node_DualQuaternion* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  Node_DualQuaternion* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
+    PROTOBUF_FINAL;
+  void CopyFrom(const Node_DualQuaternion& from);
+  void MergeFrom(const Node_DualQuaternion& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  void DiscardUnknownFields();
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(Node_DualQuaternion* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::std::string GetTypeName() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated float value = 1;
+  int value_size() const;
+  void clear_value();
+  static const int kValueFieldNumber = 1;
+  float value(int index) const;
+  void set_value(int index, float value);
+  void add_value(float value);
+  const ::google::protobuf::RepeatedField< float >&
+      value() const;
+  ::google::protobuf::RepeatedField< float >*
+      mutable_value();
+
+  // @@protoc_insertion_point(class_scope:viro.Node.DualQuaternion)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::google::protobuf::RepeatedField< float > value_;
+  mutable int _value_cached_byte_size_;
+  mutable int _cached_size_;
+  friend struct  protobuf_Nodes_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
 class Node_Geometry_Source : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:viro.Node.Geometry.Source) */ {
  public:
   Node_Geometry_Source();
@@ -365,6 +494,8 @@ class Node_Geometry_Source : public ::google::protobuf::MessageLite /* @@protoc_
     Node_Geometry_Source_Semantic_BoneWeights;
   static const Semantic BoneIndices =
     Node_Geometry_Source_Semantic_BoneIndices;
+  static const Semantic QTangent =
+    Node_Geometry_Source_Semantic_QTangent;
   static inline bool Semantic_IsValid(int value) {
     return Node_Geometry_Source_Semantic_IsValid(value);
   }
@@ -375,6 +506,23 @@ class Node_Geometry_Source : public ::google::protobuf::MessageLite /* @@protoc_
   static const int Semantic_ARRAYSIZE =
     Node_Geometry_Source_Semantic_Semantic_ARRAYSIZE;
 
+  typedef Node_Geometry_Source_Normalization Normalization;
+  static const Normalization NotNormalized =
+    Node_Geometry_Source_Normalization_NotNormalized;
+  static const Normalization SNorm =
+    Node_Geometry_Source_Normalization_SNorm;
+  static const Normalization UNorm =
+    Node_Geometry_Source_Normalization_UNorm;
+  static inline bool Normalization_IsValid(int value) {
+    return Node_Geometry_Source_Normalization_IsValid(value);
+  }
+  static const Normalization Normalization_MIN =
+    Node_Geometry_Source_Normalization_Normalization_MIN;
+  static const Normalization Normalization_MAX =
+    Node_Geometry_Source_Normalization_Normalization_MAX;
+  static const int Normalization_ARRAYSIZE =
+    Node_Geometry_Source_Normalization_Normalization_ARRAYSIZE;
+
   // accessors -------------------------------------------------------
 
   // bytes data = 8;
@@ -433,6 +581,42 @@ class Node_Geometry_Source : public ::google::protobuf::MessageLite /* @@protoc_
   ::google::protobuf::uint32 data_stride() const;
   void set_data_stride(::google::protobuf::uint32 value);
 
+  // .viro.Node.Geometry.Source.Normalization normalization = 9;
+  void clear_normalization();
+  static const int kNormalizationFieldNumber = 9;
+  ::viro::Node_Geometry_Source_Normalization normalization() const;
+  void set_normalization(::viro::Node_Geometry_Source_Normalization value);
+
+  // repeated float dequantize_scale = 10;
+  int dequantize_scale_size() const;
+  void clear_dequantize_scale();
+  static const int kDequantizeScaleFieldNumber = 10;
+  float dequantize_scale(int index) const;
+  void set_dequantize_scale(int index, float value);
+  void add_dequantize_scale(float value);
+  const ::google::protobuf::RepeatedField< float >&
+      dequantize_scale() const;
+  ::google::protobuf::RepeatedField< float >*
+      mutable_dequantize_scale();
+
+  // repeated float dequantize_offset = 11;
+  int dequantize_offset_size() const;
+  void clear_dequantize_offset();
+  static const int kDequantizeOffsetFieldNumber = 11;
+  float dequantize_offset(int index) const;
+  void set_dequantize_offset(int index, float value);
+  void add_dequantize_offset(float value);
+  const ::google::protobuf::RepeatedField< float >&
+      dequantize_offset() const;
+  ::google::protobuf::RepeatedField< float >*
+      mutable_dequantize_offset();
+
+  // .viro.Node.Geometry.Encoding data_encoding = 12;
+  void clear_data_encoding();
+  static const int kDataEncodingFieldNumber = 12;
+  ::viro::Node_Geometry_Encoding data_encoding() const;
+  void set_data_encoding(::viro::Node_Geometry_Encoding value);
+
   // @@protoc_insertion_point(class_scope:viro.Node.Geometry.Source)
  private:
 
@@ -445,6 +629,338 @@ class Node_Geometry_Source : public ::google::protobuf::MessageLite /* @@protoc_
   ::google::protobuf::uint32 bytes_per_component_;
   ::google::protobuf::uint32 data_offset_;
   ::google::protobuf::uint32 data_stride_;
+  int normalization_;
+  ::google::protobuf::RepeatedField< float > dequantize_scale_;
+  mutable int _dequantize_scale_cached_byte_size_;
+  ::google::protobuf::RepeatedField< float > dequantize_offset_;
+  mutable int _dequantize_offset_cached_byte_size_;
+  int data_encoding_;
+  mutable int _cached_size_;
+  friend struct  protobuf_Nodes_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class Node_Geometry_Element_Meshlet : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:viro.Node.Geometry.Element.Meshlet) */ {
+ public:
+  Node_Geometry_Element_Meshlet();
+  virtual ~Node_Geometry_Element_Meshlet();
+
+  Node_Geometry_Element_Meshlet(const Node_Geometry_Element_Meshlet& from);
+
+  inline Node_Geometry_Element_Meshlet& operator=(const Node_Geometry_Element_Meshlet& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  static const Node_Geometry_Element_Meshlet& default_instance();
+
+  static inline const Node_Geometry_Element_Meshlet* internal_default_instance() {
+    return reinterpret_cast<const Node_Geometry_Element_Meshlet*>(
+               &_Node_Geometry_Element_Meshlet_default_instance_);
+  }
+
+  void Swap(Node_Geometry_Element_Meshlet* other);
+
+  // implements Message ----------------------------------------------
+
+  inline Node_Geometry_Element_Meshlet* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  Node_Geometry_Element_Meshlet* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
+    PROTOBUF_FINAL;
+  void CopyFrom(const Node_Geometry_Element_Meshlet& from);
+  void MergeFrom(const Node_Geometry_Element_Meshlet& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  void DiscardUnknownFields();
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(Node_Geometry_Element_Meshlet* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::std::string GetTypeName() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // uint32 triangle_offset = 1;
+  void clear_triangle_offset();
+  static const int kTriangleOffsetFieldNumber = 1;
+  ::google::protobuf::uint32 triangle_offset() const;
+  void set_triangle_offset(::google::protobuf::uint32 value);
+
+  // uint32 triangle_count = 2;
+  void clear_triangle_count();
+  static const int kTriangleCountFieldNumber = 2;
+  ::google::protobuf::uint32 triangle_count() const;
+  void set_triangle_count(::google::protobuf::uint32 value);
+
+  // uint32 vertex_count = 3;
+  void clear_vertex_count();
+  static const int kVertexCountFieldNumber = 3;
+  ::google::protobuf::uint32 vertex_count() const;
+  void set_vertex_count(::google::protobuf::uint32 value);
+
+  // repeated float bounding_sphere = 4;
+  int bounding_sphere_size() const;
+  void clear_bounding_sphere();
+  static const int kBoundingSphereFieldNumber = 4;
+  float bounding_sphere(int index) const;
+  void set_bounding_sphere(int index, float value);
+  void add_bounding_sphere(float value);
+  const ::google::protobuf::RepeatedField< float >&
+      bounding_sphere() const;
+  ::google::protobuf::RepeatedField< float >*
+      mutable_bounding_sphere();
+
+  // repeated float cone_apex = 5;
+  int cone_apex_size() const;
+  void clear_cone_apex();
+  static const int kConeApexFieldNumber = 5;
+  float cone_apex(int index) const;
+  void set_cone_apex(int index, float value);
+  void add_cone_apex(float value);
+  const ::google::protobuf::RepeatedField< float >&
+      cone_apex() const;
+  ::google::protobuf::RepeatedField< float >*
+      mutable_cone_apex();
+
+  // repeated float cone_axis = 6;
+  int cone_axis_size() const;
+  void clear_cone_axis();
+  static const int kConeAxisFieldNumber = 6;
+  float cone_axis(int index) const;
+  void set_cone_axis(int index, float value);
+  void add_cone_axis(float value);
+  const ::google::protobuf::RepeatedField< float >&
+      cone_axis() const;
+  ::google::protobuf::RepeatedField< float >*
+      mutable_cone_axis();
+
+  // float cone_cutoff = 7;
+  void clear_cone_cutoff();
+  static const int kConeCutoffFieldNumber = 7;
+  float cone_cutoff() const;
+  void set_cone_cutoff(float value);
+
+  // @@protoc_insertion_point(class_scope:viro.Node.Geometry.Element.Meshlet)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::google::protobuf::uint32 triangle_offset_;
+  ::google::protobuf::uint32 triangle_count_;
+  ::google::protobuf::uint32 vertex_count_;
+  ::google::protobuf::RepeatedField< float > bounding_sphere_;
+  mutable int _bounding_sphere_cached_byte_size_;
+  ::google::protobuf::RepeatedField< float > cone_apex_;
+  mutable int _cone_apex_cached_byte_size_;
+  ::google::protobuf::RepeatedField< float > cone_axis_;
+  mutable int _cone_axis_cached_byte_size_;
+  float cone_cutoff_;
+  mutable int _cached_size_;
+  friend struct  protobuf_Nodes_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class Node_Geometry_Element_ProgressiveLevel : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:viro.Node.Geometry.Element.ProgressiveLevel) */ {
+ public:
+  Node_Geometry_Element_ProgressiveLevel();
+  virtual ~Node_Geometry_Element_ProgressiveLevel();
+
+  Node_Geometry_Element_ProgressiveLevel(const Node_Geometry_Element_ProgressiveLevel& from);
+
+  inline Node_Geometry_Element_ProgressiveLevel& operator=(const Node_Geometry_Element_ProgressiveLevel& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  static const Node_Geometry_Element_ProgressiveLevel& default_instance();
+
+  static inline const Node_Geometry_Element_ProgressiveLevel* internal_default_instance() {
+    return reinterpret_cast<const Node_Geometry_Element_ProgressiveLevel*>(
+               &_Node_Geometry_Element_ProgressiveLevel_default_instance_);
+  }
+
+  void Swap(Node_Geometry_Element_ProgressiveLevel* other);
+
+  // implements Message ----------------------------------------------
+
+  inline Node_Geometry_Element_ProgressiveLevel* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  Node_Geometry_Element_ProgressiveLevel* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
+    PROTOBUF_FINAL;
+  void CopyFrom(const Node_Geometry_Element_ProgressiveLevel& from);
+  void MergeFrom(const Node_Geometry_Element_ProgressiveLevel& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  void DiscardUnknownFields();
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(Node_Geometry_Element_ProgressiveLevel* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::std::string GetTypeName() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // uint32 vertex_count = 1;
+  void clear_vertex_count();
+  static const int kVertexCountFieldNumber = 1;
+  ::google::protobuf::uint32 vertex_count() const;
+  void set_vertex_count(::google::protobuf::uint32 value);
+
+  // uint32 triangle_count = 2;
+  void clear_triangle_count();
+  static const int kTriangleCountFieldNumber = 2;
+  ::google::protobuf::uint32 triangle_count() const;
+  void set_triangle_count(::google::protobuf::uint32 value);
+
+  // float error = 3;
+  void clear_error();
+  static const int kErrorFieldNumber = 3;
+  float error() const;
+  void set_error(float value);
+
+  // @@protoc_insertion_point(class_scope:viro.Node.Geometry.Element.ProgressiveLevel)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::google::protobuf::uint32 vertex_count_;
+  ::google::protobuf::uint32 triangle_count_;
+  float error_;
+  mutable int _cached_size_;
+  friend struct  protobuf_Nodes_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class Node_Geometry_Element_BonePartition : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:viro.Node.Geometry.Element.BonePartition) */ {
+ public:
+  Node_Geometry_Element_BonePartition();
+  virtual ~Node_Geometry_Element_BonePartition();
+
+  Node_Geometry_Element_BonePartition(const Node_Geometry_Element_BonePartition& from);
+
+  inline Node_Geometry_Element_BonePartition& operator=(const Node_Geometry_Element_BonePartition& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  static const Node_Geometry_Element_BonePartition& default_instance();
+
+  static inline const Node_Geometry_Element_BonePartition* internal_default_instance() {
+    return reinterpret_cast<const Node_Geometry_Element_BonePartition*>(
+               &_Node_Geometry_Element_BonePartition_default_instance_);
+  }
+
+  void Swap(Node_Geometry_Element_BonePartition* other);
+
+  // implements Message ----------------------------------------------
+
+  inline Node_Geometry_Element_BonePartition* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  Node_Geometry_Element_BonePartition* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
+    PROTOBUF_FINAL;
+  void CopyFrom(const Node_Geometry_Element_BonePartition& from);
+  void MergeFrom(const Node_Geometry_Element_BonePartition& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  void DiscardUnknownFields();
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(Node_Geometry_Element_BonePartition* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::std::string GetTypeName() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // uint32 triangle_offset = 1;
+  void clear_triangle_offset();
+  static const int kTriangleOffsetFieldNumber = 1;
+  ::google::protobuf::uint32 triangle_offset() const;
+  void set_triangle_offset(::google::protobuf::uint32 value);
+
+  // uint32 triangle_count = 2;
+  void clear_triangle_count();
+  static const int kTriangleCountFieldNumber = 2;
+  ::google::protobuf::uint32 triangle_count() const;
+  void set_triangle_count(::google::protobuf::uint32 value);
+
+  // repeated uint32 bone = 3;
+  int bone_size() const;
+  void clear_bone();
+  static const int kBoneFieldNumber = 3;
+  ::google::protobuf::uint32 bone(int index) const;
+  void set_bone(int index, ::google::protobuf::uint32 value);
+  void add_bone(::google::protobuf::uint32 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+      bone() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+      mutable_bone();
+
+  // @@protoc_insertion_point(class_scope:viro.Node.Geometry.Element.BonePartition)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::google::protobuf::uint32 triangle_offset_;
+  ::google::protobuf::uint32 triangle_count_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > bone_;
+  mutable int _bone_cached_byte_size_;
   mutable int _cached_size_;
   friend struct  protobuf_Nodes_2eproto::TableStruct;
 };
@@ -508,6 +1024,10 @@ class Node_Geometry_Element : public ::google::protobuf::MessageLite /* @@protoc
 
   // nested types ----------------------------------------------------
 
+  typedef Node_Geometry_Element_Meshlet Meshlet;
+  typedef Node_Geometry_Element_ProgressiveLevel ProgressiveLevel;
+  typedef Node_Geometry_Element_BonePartition BonePartition;
+
   typedef Node_Geometry_Element_Primitive Primitive;
   static const Primitive Triangle =
     Node_Geometry_Element_Primitive_Triangle;
@@ -561,6 +1081,54 @@ class Node_Geometry_Element : public ::google::protobuf::MessageLite /* @@protoc
   ::google::protobuf::uint32 bytes_per_index() const;
   void set_bytes_per_index(::google::protobuf::uint32 value);
 
+  // repeated .viro.Node.Geometry.Element.Meshlet meshlet = 5;
+  int meshlet_size() const;
+  void clear_meshlet();
+  static const int kMeshletFieldNumber = 5;
+  const ::viro::Node_Geometry_Element_Meshlet& meshlet(int index) const;
+  ::viro::Node_Geometry_Element_Meshlet* mutable_meshlet(int index);
+  ::viro::Node_Geometry_Element_Meshlet* add_meshlet();
+  ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Element_Meshlet >*
+      mutable_meshlet();
+  const ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Element_Meshlet >&
+      meshlet() const;
+
+  // repeated .viro.Node.Geometry.Element.ProgressiveLevel progressive_level = 6;
+  int progressive_level_size() const;
+  void clear_progressive_level();
+  static const int kProgressiveLevelFieldNumber = 6;
+  const ::viro::Node_Geometry_Element_ProgressiveLevel& progressive_level(int index) const;
+  ::viro::Node_Geometry_Element_ProgressiveLevel* mutable_progressive_level(int index);
+  ::viro::Node_Geometry_Element_ProgressiveLevel* add_progressive_level();
+  ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Element_ProgressiveLevel >*
+      mutable_progressive_level();
+  const ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Element_ProgressiveLevel >&
+      progressive_level() const;
+
+  // bool primitive_restart = 7;
+  void clear_primitive_restart();
+  static const int kPrimitiveRestartFieldNumber = 7;
+  bool primitive_restart() const;
+  void set_primitive_restart(bool value);
+
+  // repeated .viro.Node.Geometry.Element.BonePartition bone_partition = 8;
+  int bone_partition_size() const;
+  void clear_bone_partition();
+  static const int kBonePartitionFieldNumber = 8;
+  const ::viro::Node_Geometry_Element_BonePartition& bone_partition(int index) const;
+  ::viro::Node_Geometry_Element_BonePartition* mutable_bone_partition(int index);
+  ::viro::Node_Geometry_Element_BonePartition* add_bone_partition();
+  ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Element_BonePartition >*
+      mutable_bone_partition();
+  const ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Element_BonePartition >&
+      bone_partition() const;
+
+  // .viro.Node.Geometry.Encoding data_encoding = 9;
+  void clear_data_encoding();
+  static const int kDataEncodingFieldNumber = 9;
+  ::viro::Node_Geometry_Encoding data_encoding() const;
+  void set_data_encoding(::viro::Node_Geometry_Encoding value);
+
   // @@protoc_insertion_point(class_scope:viro.Node.Geometry.Element)
  private:
 
@@ -569,6 +1137,11 @@ class Node_Geometry_Element : public ::google::protobuf::MessageLite /* @@protoc
   int primitive_;
   ::google::protobuf::uint32 primitive_count_;
   ::google::protobuf::uint32 bytes_per_index_;
+  ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Element_Meshlet > meshlet_;
+  ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Element_ProgressiveLevel > progressive_level_;
+  bool primitive_restart_;
+  ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Element_BonePartition > bone_partition_;
+  int data_encoding_;
   mutable int _cached_size_;
   friend struct  protobuf_Nodes_2eproto::TableStruct;
 };
@@ -1064,6 +1637,96 @@ class Node_Geometry_Material : public ::google::protobuf::MessageLite /* @@proto
 };
 // -------------------------------------------------------------------
 
+class Node_Geometry_Skin_InfluenceTier : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:viro.Node.Geometry.Skin.InfluenceTier) */ {
+ public:
+  Node_Geometry_Skin_InfluenceTier();
+  virtual ~Node_Geometry_Skin_InfluenceTier();
+
+  Node_Geometry_Skin_InfluenceTier(const Node_Geometry_Skin_InfluenceTier& from);
+
+  inline Node_Geometry_Skin_InfluenceTier& operator=(const Node_Geometry_Skin_InfluenceTier& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  static const Node_Geometry_Skin_InfluenceTier& default_instance();
+
+  static inline const Node_Geometry_Skin_InfluenceTier* internal_default_instance() {
+    return reinterpret_cast<const Node_Geometry_Skin_InfluenceTier*>(
+               &_Node_Geometry_Skin_InfluenceTier_default_instance_);
+  }
+
+  void Swap(Node_Geometry_Skin_InfluenceTier* other);
+
+  // implements Message ----------------------------------------------
+
+  inline Node_Geometry_Skin_InfluenceTier* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  Node_Geometry_Skin_InfluenceTier* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
+    PROTOBUF_FINAL;
+  void CopyFrom(const Node_Geometry_Skin_InfluenceTier& from);
+  void MergeFrom(const Node_Geometry_Skin_InfluenceTier& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  void DiscardUnknownFields();
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(Node_Geometry_Skin_InfluenceTier* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::std::string GetTypeName() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // uint32 influences = 1;
+  void clear_influences();
+  static const int kInfluencesFieldNumber = 1;
+  ::google::protobuf::uint32 influences() const;
+  void set_influences(::google::protobuf::uint32 value);
+
+  // uint32 vertex_offset = 2;
+  void clear_vertex_offset();
+  static const int kVertexOffsetFieldNumber = 2;
+  ::google::protobuf::uint32 vertex_offset() const;
+  void set_vertex_offset(::google::protobuf::uint32 value);
+
+  // uint32 vertex_count = 3;
+  void clear_vertex_count();
+  static const int kVertexCountFieldNumber = 3;
+  ::google::protobuf::uint32 vertex_count() const;
+  void set_vertex_count(::google::protobuf::uint32 value);
+
+  // @@protoc_insertion_point(class_scope:viro.Node.Geometry.Skin.InfluenceTier)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::google::protobuf::uint32 influences_;
+  ::google::protobuf::uint32 vertex_offset_;
+  ::google::protobuf::uint32 vertex_count_;
+  mutable int _cached_size_;
+  friend struct  protobuf_Nodes_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
 class Node_Geometry_Skin : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:viro.Node.Geometry.Skin) */ {
  public:
   Node_Geometry_Skin();
@@ -1122,6 +1785,8 @@ class Node_Geometry_Skin : public ::google::protobuf::MessageLite /* @@protoc_in
 
   // nested types ----------------------------------------------------
 
+  typedef Node_Geometry_Skin_InfluenceTier InfluenceTier;
+
   // accessors -------------------------------------------------------
 
   // repeated .viro.Node.Matrix bind_transform = 2;
@@ -1163,14 +1828,136 @@ class Node_Geometry_Skin : public ::google::protobuf::MessageLite /* @@protoc_in
   ::viro::Node_Geometry_Source* release_bone_weights();
   void set_allocated_bone_weights(::viro::Node_Geometry_Source* bone_weights);
 
-  // @@protoc_insertion_point(class_scope:viro.Node.Geometry.Skin)
+  // repeated .viro.Node.Geometry.Skin.InfluenceTier influence_tier = 5;
+  int influence_tier_size() const;
+  void clear_influence_tier();
+  static const int kInfluenceTierFieldNumber = 5;
+  const ::viro::Node_Geometry_Skin_InfluenceTier& influence_tier(int index) const;
+  ::viro::Node_Geometry_Skin_InfluenceTier* mutable_influence_tier(int index);
+  ::viro::Node_Geometry_Skin_InfluenceTier* add_influence_tier();
+  ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Skin_InfluenceTier >*
+      mutable_influence_tier();
+  const ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Skin_InfluenceTier >&
+      influence_tier() const;
+
+  // repeated .viro.Node.DualQuaternion bind_dual_quaternion = 6;
+  int bind_dual_quaternion_size() const;
+  void clear_bind_dual_quaternion();
+  static const int kBindDualQuaternionFieldNumber = 6;
+  const ::viro::Node_DualQuaternion& bind_dual_quaternion(int index) const;
+  ::viro::Node_DualQuaternion* mutable_bind_dual_quaternion(int index);
+  ::viro::Node_DualQuaternion* add_bind_dual_quaternion();
+  ::google::protobuf::RepeatedPtrField< ::viro::Node_DualQuaternion >*
+      mutable_bind_dual_quaternion();
+  const ::google::protobuf::RepeatedPtrField< ::viro::Node_DualQuaternion >&
+      bind_dual_quaternion() const;
+
+  // @@protoc_insertion_point(class_scope:viro.Node.Geometry.Skin)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::google::protobuf::RepeatedPtrField< ::viro::Node_Matrix > bind_transform_;
+  ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Skin_InfluenceTier > influence_tier_;
+  ::google::protobuf::RepeatedPtrField< ::viro::Node_DualQuaternion > bind_dual_quaternion_;
+  ::viro::Node_Matrix* geometry_bind_transform_;
+  ::viro::Node_Geometry_Source* bone_indices_;
+  ::viro::Node_Geometry_Source* bone_weights_;
+  mutable int _cached_size_;
+  friend struct  protobuf_Nodes_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class Node_Geometry_LOD : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:viro.Node.Geometry.LOD) */ {
+ public:
+  Node_Geometry_LOD();
+  virtual ~Node_Geometry_LOD();
+
+  Node_Geometry_LOD(const Node_Geometry_LOD& from);
+
+  inline Node_Geometry_LOD& operator=(const Node_Geometry_LOD& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  static const Node_Geometry_LOD& default_instance();
+
+  static inline const Node_Geometry_LOD* internal_default_instance() {
+    return reinterpret_cast<const Node_Geometry_LOD*>(
+               &_Node_Geometry_LOD_default_instance_);
+  }
+
+  void Swap(Node_Geometry_LOD* other);
+
+  // implements Message ----------------------------------------------
+
+  inline Node_Geometry_LOD* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  Node_Geometry_LOD* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
+    PROTOBUF_FINAL;
+  void CopyFrom(const Node_Geometry_LOD& from);
+  void MergeFrom(const Node_Geometry_LOD& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  void DiscardUnknownFields();
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(Node_Geometry_LOD* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::std::string GetTypeName() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated .viro.Node.Geometry.Element element = 1;
+  int element_size() const;
+  void clear_element();
+  static const int kElementFieldNumber = 1;
+  const ::viro::Node_Geometry_Element& element(int index) const;
+  ::viro::Node_Geometry_Element* mutable_element(int index);
+  ::viro::Node_Geometry_Element* add_element();
+  ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Element >*
+      mutable_element();
+  const ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Element >&
+      element() const;
+
+  // float screen_size = 2;
+  void clear_screen_size();
+  static const int kScreenSizeFieldNumber = 2;
+  float screen_size() const;
+  void set_screen_size(float value);
+
+  // float error = 3;
+  void clear_error();
+  static const int kErrorFieldNumber = 3;
+  float error() const;
+  void set_error(float value);
+
+  // @@protoc_insertion_point(class_scope:viro.Node.Geometry.LOD)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::viro::Node_Matrix > bind_transform_;
-  ::viro::Node_Matrix* geometry_bind_transform_;
-  ::viro::Node_Geometry_Source* bone_indices_;
-  ::viro::Node_Geometry_Source* bone_weights_;
+  ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Element > element_;
+  float screen_size_;
+  float error_;
   mutable int _cached_size_;
   friend struct  protobuf_Nodes_2eproto::TableStruct;
 };
@@ -1238,6 +2025,24 @@ class Node_Geometry : public ::google::protobuf::MessageLite /* @@protoc_inserti
   typedef Node_Geometry_Element Element;
   typedef Node_Geometry_Material Material;
   typedef Node_Geometry_Skin Skin;
+  typedef Node_Geometry_LOD LOD;
+
+  typedef Node_Geometry_Encoding Encoding;
+  static const Encoding Raw =
+    Node_Geometry_Encoding_Raw;
+  static const Encoding MeshVertex =
+    Node_Geometry_Encoding_MeshVertex;
+  static const Encoding MeshIndex =
+    Node_Geometry_Encoding_MeshIndex;
+  static inline bool Encoding_IsValid(int value) {
+    return Node_Geometry_Encoding_IsValid(value);
+  }
+  static const Encoding Encoding_MIN =
+    Node_Geometry_Encoding_Encoding_MIN;
+  static const Encoding Encoding_MAX =
+    Node_Geometry_Encoding_Encoding_MAX;
+  static const int Encoding_ARRAYSIZE =
+    Node_Geometry_Encoding_Encoding_ARRAYSIZE;
 
   // accessors -------------------------------------------------------
 
@@ -1314,6 +2119,36 @@ class Node_Geometry : public ::google::protobuf::MessageLite /* @@protoc_inserti
   ::viro::Node_Geometry_Skin* release_skin();
   void set_allocated_skin(::viro::Node_Geometry_Skin* skin);
 
+  // repeated .viro.Node.Geometry.LOD lod = 7;
+  int lod_size() const;
+  void clear_lod();
+  static const int kLodFieldNumber = 7;
+  const ::viro::Node_Geometry_LOD& lod(int index) const;
+  ::viro::Node_Geometry_LOD* mutable_lod(int index);
+  ::viro::Node_Geometry_LOD* add_lod();
+  ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_LOD >*
+      mutable_lod();
+  const ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_LOD >&
+      lod() const;
+
+  // repeated uint32 progressive_parent = 8;
+  int progressive_parent_size() const;
+  void clear_progressive_parent();
+  static const int kProgressiveParentFieldNumber = 8;
+  ::google::protobuf::uint32 progressive_parent(int index) const;
+  void set_progressive_parent(int index, ::google::protobuf::uint32 value);
+  void add_progressive_parent(::google::protobuf::uint32 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+      progressive_parent() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+      mutable_progressive_parent();
+
+  // .viro.Node.Geometry.Encoding data_encoding = 9;
+  void clear_data_encoding();
+  static const int kDataEncodingFieldNumber = 9;
+  ::viro::Node_Geometry_Encoding data_encoding() const;
+  void set_data_encoding(::viro::Node_Geometry_Encoding value);
+
   // @@protoc_insertion_point(class_scope:viro.Node.Geometry)
  private:
 
@@ -1324,6 +2159,10 @@ class Node_Geometry : public ::google::protobuf::MessageLite /* @@protoc_inserti
   ::google::protobuf::internal::ArenaStringPtr name_;
   ::google::protobuf::internal::ArenaStringPtr data_;
   ::viro::Node_Geometry_Skin* skin_;
+  ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_LOD > lod_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > progressive_parent_;
+  mutable int _progressive_parent_cached_byte_size_;
+  int data_encoding_;
   mutable int _cached_size_;
   friend struct  protobuf_Nodes_2eproto::TableStruct;
 };
@@ -1626,6 +2465,30 @@ class Node_SkeletalAnimation_Frame : public ::google::protobuf::MessageLite /* @
   float time() const;
   void set_time(float value);
 
+  // repeated .viro.Node.DualQuaternion dual_quaternion = 5;
+  int dual_quaternion_size() const;
+  void clear_dual_quaternion();
+  static const int kDualQuaternionFieldNumber = 5;
+  const ::viro::Node_DualQuaternion& dual_quaternion(int index) const;
+  ::viro::Node_DualQuaternion* mutable_dual_quaternion(int index);
+  ::viro::Node_DualQuaternion* add_dual_quaternion();
+  ::google::protobuf::RepeatedPtrField< ::viro::Node_DualQuaternion >*
+      mutable_dual_quaternion();
+  const ::google::protobuf::RepeatedPtrField< ::viro::Node_DualQuaternion >&
+      dual_quaternion() const;
+
+  // repeated .viro.Node.DualQuaternion local_dual_quaternion = 6;
+  int local_dual_quaternion_size() const;
+  void clear_local_dual_quaternion();
+  static const int kLocalDualQuaternionFieldNumber = 6;
+  const ::viro::Node_DualQuaternion& local_dual_quaternion(int index) const;
+  ::viro::Node_DualQuaternion* mutable_local_dual_quaternion(int index);
+  ::viro::Node_DualQuaternion* add_local_dual_quaternion();
+  ::google::protobuf::RepeatedPtrField< ::viro::Node_DualQuaternion >*
+      mutable_local_dual_quaternion();
+  const ::google::protobuf::RepeatedPtrField< ::viro::Node_DualQuaternion >&
+      local_dual_quaternion() const;
+
   // @@protoc_insertion_point(class_scope:viro.Node.SkeletalAnimation.Frame)
  private:
 
@@ -1635,6 +2498,8 @@ class Node_SkeletalAnimation_Frame : public ::google::protobuf::MessageLite /* @
   ::google::protobuf::RepeatedPtrField< ::viro::Node_Matrix > transform_;
   ::google::protobuf::RepeatedPtrField< ::viro::Node_Matrix > local_transform_;
   float time_;
+  ::google::protobuf::RepeatedPtrField< ::viro::Node_DualQuaternion > dual_quaternion_;
+  ::google::protobuf::RepeatedPtrField< ::viro::Node_DualQuaternion > local_dual_quaternion_;
   mutable int _cached_size_;
   friend struct  protobuf_Nodes_2eproto::TableStruct;
 };
@@ -2261,6 +3126,95 @@ class Node_Camera : public ::google::protobuf::MessageLite /* @@protoc_insertion
 };
 // -------------------------------------------------------------------
 
+class Node_GeometryInstance : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:viro.Node.GeometryInstance) */ {
+ public:
+  Node_GeometryInstance();
+  virtual ~Node_GeometryInstance();
+
+  Node_GeometryInstance(const Node_GeometryInstance& from);
+
+  inline Node_GeometryInstance& operator=(const Node_GeometryInstance& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  static const Node_GeometryInstance& default_instance();
+
+  static inline const Node_GeometryInstance* internal_default_instance() {
+    return reinterpret_cast<const Node_GeometryInstance*>(
+               &_Node_GeometryInstance_default_instance_);
+  }
+
+  void Swap(Node_GeometryInstance* other);
+
+  // implements Message ----------------------------------------------
+
+  inline Node_GeometryInstance* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  Node_GeometryInstance* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
+    PROTOBUF_FINAL;
+  void CopyFrom(const Node_GeometryInstance& from);
+  void MergeFrom(const Node_GeometryInstance& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  void DiscardUnknownFields();
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(Node_GeometryInstance* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::std::string GetTypeName() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // uint32 index = 1;
+  void clear_index();
+  static const int kIndexFieldNumber = 1;
+  ::google::protobuf::uint32 index() const;
+  void set_index(::google::protobuf::uint32 value);
+
+  // repeated .viro.Node.Matrix transform = 2;
+  int transform_size() const;
+  void clear_transform();
+  static const int kTransformFieldNumber = 2;
+  const ::viro::Node_Matrix& transform(int index) const;
+  ::viro::Node_Matrix* mutable_transform(int index);
+  ::viro::Node_Matrix* add_transform();
+  ::google::protobuf::RepeatedPtrField< ::viro::Node_Matrix >*
+      mutable_transform();
+  const ::google::protobuf::RepeatedPtrField< ::viro::Node_Matrix >&
+      transform() const;
+
+  // @@protoc_insertion_point(class_scope:viro.Node.GeometryInstance)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::google::protobuf::uint32 index_;
+  ::google::protobuf::RepeatedPtrField< ::viro::Node_Matrix > transform_;
+  mutable int _cached_size_;
+  friend struct  protobuf_Nodes_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
 class Node : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:viro.Node) */ {
  public:
   Node();
@@ -2326,6 +3280,8 @@ class Node : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(
   typedef Node_KeyframeAnimation KeyframeAnimation;
   typedef Node_Light Light;
   typedef Node_Camera Camera;
+  typedef Node_GeometryInstance GeometryInstance;
+  typedef Node_DualQuaternion DualQuaternion;
 
   // accessors -------------------------------------------------------
 
@@ -2466,6 +3422,27 @@ class Node : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(
   float opacity() const;
   void set_opacity(float value);
 
+  // repeated .viro.Node.Geometry shared_geometry = 14;
+  int shared_geometry_size() const;
+  void clear_shared_geometry();
+  static const int kSharedGeometryFieldNumber = 14;
+  const ::viro::Node_Geometry& shared_geometry(int index) const;
+  ::viro::Node_Geometry* mutable_shared_geometry(int index);
+  ::viro::Node_Geometry* add_shared_geometry();
+  ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry >*
+      mutable_shared_geometry();
+  const ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry >&
+      shared_geometry() const;
+
+  // .viro.Node.GeometryInstance geometry_instance = 15;
+  bool has_geometry_instance() const;
+  void clear_geometry_instance();
+  static const int kGeometryInstanceFieldNumber = 15;
+  const ::viro::Node_GeometryInstance& geometry_instance() const;
+  ::viro::Node_GeometryInstance* mutable_geometry_instance();
+  ::viro::Node_GeometryInstance* release_geometry_instance();
+  void set_allocated_geometry_instance(::viro::Node_GeometryInstance* geometry_instance);
+
   // @@protoc_insertion_point(class_scope:viro.Node)
  private:
 
@@ -2481,6 +3458,8 @@ class Node : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(
   ::google::protobuf::RepeatedPtrField< ::viro::Node_Light > light_;
   ::google::protobuf::RepeatedPtrField< ::viro::Node > subnode_;
   ::google::protobuf::internal::ArenaStringPtr name_;
+  ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry > shared_geometry_;
+  ::viro::Node_GeometryInstance* geometry_instance_;
   ::viro::Node_Geometry* geometry_;
   ::viro::Node_Skeleton* skeleton_;
   ::viro::Node_Camera* camera_;
@@ -2529,6 +3508,40 @@ Node_Matrix::mutable_value() {
 
 // -------------------------------------------------------------------
 
+// Node_DualQuaternion
+
+// repeated float value = 1;
+inline int Node_DualQuaternion::value_size() const {
+  return value_.size();
+}
+inline void Node_DualQuaternion::clear_value() {
+  value_.Clear();
+}
+inline float Node_DualQuaternion::value(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.DualQuaternion.value)
+  return value_.Get(index);
+}
+inline void Node_DualQuaternion::set_value(int index, float value) {
+  value_.Set(index, value);
+  // @@protoc_insertion_point(field_set:viro.Node.DualQuaternion.value)
+}
+inline void Node_DualQuaternion::add_value(float value) {
+  value_.Add(value);
+  // @@protoc_insertion_point(field_add:viro.Node.DualQuaternion.value)
+}
+inline const ::google::protobuf::RepeatedField< float >&
+Node_DualQuaternion::value() const {
+  // @@protoc_insertion_point(field_list:viro.Node.DualQuaternion.value)
+  return value_;
+}
+inline ::google::protobuf::RepeatedField< float >*
+Node_DualQuaternion::mutable_value() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.DualQuaternion.value)
+  return &value_;
+}
+
+// -------------------------------------------------------------------
+
 // Node_Geometry_Source
 
 // .viro.Node.Geometry.Source.Semantic semantic = 1;
@@ -2609,76 +3622,422 @@ inline ::google::protobuf::uint32 Node_Geometry_Source::data_offset() const {
   // @@protoc_insertion_point(field_get:viro.Node.Geometry.Source.data_offset)
   return data_offset_;
 }
-inline void Node_Geometry_Source::set_data_offset(::google::protobuf::uint32 value) {
+inline void Node_Geometry_Source::set_data_offset(::google::protobuf::uint32 value) {
+
+  data_offset_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Source.data_offset)
+}
+
+// uint32 data_stride = 7;
+inline void Node_Geometry_Source::clear_data_stride() {
+  data_stride_ = 0u;
+}
+inline ::google::protobuf::uint32 Node_Geometry_Source::data_stride() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Source.data_stride)
+  return data_stride_;
+}
+inline void Node_Geometry_Source::set_data_stride(::google::protobuf::uint32 value) {
+
+  data_stride_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Source.data_stride)
+}
+
+// bytes data = 8;
+inline void Node_Geometry_Source::clear_data() {
+  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& Node_Geometry_Source::data() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Source.data)
+  return data_.GetNoArena();
+}
+inline void Node_Geometry_Source::set_data(const ::std::string& value) {
+
+  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Source.data)
+}
+#if LANG_CXX11
+inline void Node_Geometry_Source::set_data(::std::string&& value) {
+
+  data_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:viro.Node.Geometry.Source.data)
+}
+#endif
+inline void Node_Geometry_Source::set_data(const char* value) {
+
+  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:viro.Node.Geometry.Source.data)
+}
+inline void Node_Geometry_Source::set_data(const void* value, size_t size) {
+
+  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:viro.Node.Geometry.Source.data)
+}
+inline ::std::string* Node_Geometry_Source::mutable_data() {
+
+  // @@protoc_insertion_point(field_mutable:viro.Node.Geometry.Source.data)
+  return data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* Node_Geometry_Source::release_data() {
+  // @@protoc_insertion_point(field_release:viro.Node.Geometry.Source.data)
+
+  return data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void Node_Geometry_Source::set_allocated_data(::std::string* data) {
+  if (data != NULL) {
+
+  } else {
+
+  }
+  data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), data);
+  // @@protoc_insertion_point(field_set_allocated:viro.Node.Geometry.Source.data)
+}
+
+// .viro.Node.Geometry.Source.Normalization normalization = 9;
+inline void Node_Geometry_Source::clear_normalization() {
+  normalization_ = 0;
+}
+inline ::viro::Node_Geometry_Source_Normalization Node_Geometry_Source::normalization() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Source.normalization)
+  return static_cast< ::viro::Node_Geometry_Source_Normalization >(normalization_);
+}
+inline void Node_Geometry_Source::set_normalization(::viro::Node_Geometry_Source_Normalization value) {
+
+  normalization_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Source.normalization)
+}
+
+// repeated float dequantize_scale = 10;
+inline int Node_Geometry_Source::dequantize_scale_size() const {
+  return dequantize_scale_.size();
+}
+inline void Node_Geometry_Source::clear_dequantize_scale() {
+  dequantize_scale_.Clear();
+}
+inline float Node_Geometry_Source::dequantize_scale(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Source.dequantize_scale)
+  return dequantize_scale_.Get(index);
+}
+inline void Node_Geometry_Source::set_dequantize_scale(int index, float value) {
+  dequantize_scale_.Set(index, value);
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Source.dequantize_scale)
+}
+inline void Node_Geometry_Source::add_dequantize_scale(float value) {
+  dequantize_scale_.Add(value);
+  // @@protoc_insertion_point(field_add:viro.Node.Geometry.Source.dequantize_scale)
+}
+inline const ::google::protobuf::RepeatedField< float >&
+Node_Geometry_Source::dequantize_scale() const {
+  // @@protoc_insertion_point(field_list:viro.Node.Geometry.Source.dequantize_scale)
+  return dequantize_scale_;
+}
+inline ::google::protobuf::RepeatedField< float >*
+Node_Geometry_Source::mutable_dequantize_scale() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.Geometry.Source.dequantize_scale)
+  return &dequantize_scale_;
+}
+
+// repeated float dequantize_offset = 11;
+inline int Node_Geometry_Source::dequantize_offset_size() const {
+  return dequantize_offset_.size();
+}
+inline void Node_Geometry_Source::clear_dequantize_offset() {
+  dequantize_offset_.Clear();
+}
+inline float Node_Geometry_Source::dequantize_offset(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Source.dequantize_offset)
+  return dequantize_offset_.Get(index);
+}
+inline void Node_Geometry_Source::set_dequantize_offset(int index, float value) {
+  dequantize_offset_.Set(index, value);
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Source.dequantize_offset)
+}
+inline void Node_Geometry_Source::add_dequantize_offset(float value) {
+  dequantize_offset_.Add(value);
+  // @@protoc_insertion_point(field_add:viro.Node.Geometry.Source.dequantize_offset)
+}
+inline const ::google::protobuf::RepeatedField< float >&
+Node_Geometry_Source::dequantize_offset() const {
+  // @@protoc_insertion_point(field_list:viro.Node.Geometry.Source.dequantize_offset)
+  return dequantize_offset_;
+}
+inline ::google::protobuf::RepeatedField< float >*
+Node_Geometry_Source::mutable_dequantize_offset() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.Geometry.Source.dequantize_offset)
+  return &dequantize_offset_;
+}
+
+// .viro.Node.Geometry.Encoding data_encoding = 12;
+inline void Node_Geometry_Source::clear_data_encoding() {
+  data_encoding_ = 0;
+}
+inline ::viro::Node_Geometry_Encoding Node_Geometry_Source::data_encoding() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Source.data_encoding)
+  return static_cast< ::viro::Node_Geometry_Encoding >(data_encoding_);
+}
+inline void Node_Geometry_Source::set_data_encoding(::viro::Node_Geometry_Encoding value) {
+
+  data_encoding_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Source.data_encoding)
+}
+
+// -------------------------------------------------------------------
+
+// Node_Geometry_Element_Meshlet
+
+// uint32 triangle_offset = 1;
+inline void Node_Geometry_Element_Meshlet::clear_triangle_offset() {
+  triangle_offset_ = 0u;
+}
+inline ::google::protobuf::uint32 Node_Geometry_Element_Meshlet::triangle_offset() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.Meshlet.triangle_offset)
+  return triangle_offset_;
+}
+inline void Node_Geometry_Element_Meshlet::set_triangle_offset(::google::protobuf::uint32 value) {
+
+  triangle_offset_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.Meshlet.triangle_offset)
+}
+
+// uint32 triangle_count = 2;
+inline void Node_Geometry_Element_Meshlet::clear_triangle_count() {
+  triangle_count_ = 0u;
+}
+inline ::google::protobuf::uint32 Node_Geometry_Element_Meshlet::triangle_count() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.Meshlet.triangle_count)
+  return triangle_count_;
+}
+inline void Node_Geometry_Element_Meshlet::set_triangle_count(::google::protobuf::uint32 value) {
+
+  triangle_count_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.Meshlet.triangle_count)
+}
+
+// uint32 vertex_count = 3;
+inline void Node_Geometry_Element_Meshlet::clear_vertex_count() {
+  vertex_count_ = 0u;
+}
+inline ::google::protobuf::uint32 Node_Geometry_Element_Meshlet::vertex_count() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.Meshlet.vertex_count)
+  return vertex_count_;
+}
+inline void Node_Geometry_Element_Meshlet::set_vertex_count(::google::protobuf::uint32 value) {
+
+  vertex_count_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.Meshlet.vertex_count)
+}
+
+// repeated float bounding_sphere = 4;
+inline int Node_Geometry_Element_Meshlet::bounding_sphere_size() const {
+  return bounding_sphere_.size();
+}
+inline void Node_Geometry_Element_Meshlet::clear_bounding_sphere() {
+  bounding_sphere_.Clear();
+}
+inline float Node_Geometry_Element_Meshlet::bounding_sphere(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.Meshlet.bounding_sphere)
+  return bounding_sphere_.Get(index);
+}
+inline void Node_Geometry_Element_Meshlet::set_bounding_sphere(int index, float value) {
+  bounding_sphere_.Set(index, value);
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.Meshlet.bounding_sphere)
+}
+inline void Node_Geometry_Element_Meshlet::add_bounding_sphere(float value) {
+  bounding_sphere_.Add(value);
+  // @@protoc_insertion_point(field_add:viro.Node.Geometry.Element.Meshlet.bounding_sphere)
+}
+inline const ::google::protobuf::RepeatedField< float >&
+Node_Geometry_Element_Meshlet::bounding_sphere() const {
+  // @@protoc_insertion_point(field_list:viro.Node.Geometry.Element.Meshlet.bounding_sphere)
+  return bounding_sphere_;
+}
+inline ::google::protobuf::RepeatedField< float >*
+Node_Geometry_Element_Meshlet::mutable_bounding_sphere() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.Geometry.Element.Meshlet.bounding_sphere)
+  return &bounding_sphere_;
+}
+
+// repeated float cone_apex = 5;
+inline int Node_Geometry_Element_Meshlet::cone_apex_size() const {
+  return cone_apex_.size();
+}
+inline void Node_Geometry_Element_Meshlet::clear_cone_apex() {
+  cone_apex_.Clear();
+}
+inline float Node_Geometry_Element_Meshlet::cone_apex(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.Meshlet.cone_apex)
+  return cone_apex_.Get(index);
+}
+inline void Node_Geometry_Element_Meshlet::set_cone_apex(int index, float value) {
+  cone_apex_.Set(index, value);
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.Meshlet.cone_apex)
+}
+inline void Node_Geometry_Element_Meshlet::add_cone_apex(float value) {
+  cone_apex_.Add(value);
+  // @@protoc_insertion_point(field_add:viro.Node.Geometry.Element.Meshlet.cone_apex)
+}
+inline const ::google::protobuf::RepeatedField< float >&
+Node_Geometry_Element_Meshlet::cone_apex() const {
+  // @@protoc_insertion_point(field_list:viro.Node.Geometry.Element.Meshlet.cone_apex)
+  return cone_apex_;
+}
+inline ::google::protobuf::RepeatedField< float >*
+Node_Geometry_Element_Meshlet::mutable_cone_apex() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.Geometry.Element.Meshlet.cone_apex)
+  return &cone_apex_;
+}
+
+// repeated float cone_axis = 6;
+inline int Node_Geometry_Element_Meshlet::cone_axis_size() const {
+  return cone_axis_.size();
+}
+inline void Node_Geometry_Element_Meshlet::clear_cone_axis() {
+  cone_axis_.Clear();
+}
+inline float Node_Geometry_Element_Meshlet::cone_axis(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.Meshlet.cone_axis)
+  return cone_axis_.Get(index);
+}
+inline void Node_Geometry_Element_Meshlet::set_cone_axis(int index, float value) {
+  cone_axis_.Set(index, value);
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.Meshlet.cone_axis)
+}
+inline void Node_Geometry_Element_Meshlet::add_cone_axis(float value) {
+  cone_axis_.Add(value);
+  // @@protoc_insertion_point(field_add:viro.Node.Geometry.Element.Meshlet.cone_axis)
+}
+inline const ::google::protobuf::RepeatedField< float >&
+Node_Geometry_Element_Meshlet::cone_axis() const {
+  // @@protoc_insertion_point(field_list:viro.Node.Geometry.Element.Meshlet.cone_axis)
+  return cone_axis_;
+}
+inline ::google::protobuf::RepeatedField< float >*
+Node_Geometry_Element_Meshlet::mutable_cone_axis() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.Geometry.Element.Meshlet.cone_axis)
+  return &cone_axis_;
+}
+
+// float cone_cutoff = 7;
+inline void Node_Geometry_Element_Meshlet::clear_cone_cutoff() {
+  cone_cutoff_ = 0;
+}
+inline float Node_Geometry_Element_Meshlet::cone_cutoff() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.Meshlet.cone_cutoff)
+  return cone_cutoff_;
+}
+inline void Node_Geometry_Element_Meshlet::set_cone_cutoff(float value) {
 
-  data_offset_ = value;
-  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Source.data_offset)
+  cone_cutoff_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.Meshlet.cone_cutoff)
 }
 
-// uint32 data_stride = 7;
-inline void Node_Geometry_Source::clear_data_stride() {
-  data_stride_ = 0u;
+// -------------------------------------------------------------------
+
+// Node_Geometry_Element_ProgressiveLevel
+
+// uint32 vertex_count = 1;
+inline void Node_Geometry_Element_ProgressiveLevel::clear_vertex_count() {
+  vertex_count_ = 0u;
 }
-inline ::google::protobuf::uint32 Node_Geometry_Source::data_stride() const {
-  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Source.data_stride)
-  return data_stride_;
+inline ::google::protobuf::uint32 Node_Geometry_Element_ProgressiveLevel::vertex_count() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.ProgressiveLevel.vertex_count)
+  return vertex_count_;
 }
-inline void Node_Geometry_Source::set_data_stride(::google::protobuf::uint32 value) {
+inline void Node_Geometry_Element_ProgressiveLevel::set_vertex_count(::google::protobuf::uint32 value) {
 
-  data_stride_ = value;
-  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Source.data_stride)
+  vertex_count_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.ProgressiveLevel.vertex_count)
 }
 
-// bytes data = 8;
-inline void Node_Geometry_Source::clear_data() {
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// uint32 triangle_count = 2;
+inline void Node_Geometry_Element_ProgressiveLevel::clear_triangle_count() {
+  triangle_count_ = 0u;
 }
-inline const ::std::string& Node_Geometry_Source::data() const {
-  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Source.data)
-  return data_.GetNoArena();
+inline ::google::protobuf::uint32 Node_Geometry_Element_ProgressiveLevel::triangle_count() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.ProgressiveLevel.triangle_count)
+  return triangle_count_;
 }
-inline void Node_Geometry_Source::set_data(const ::std::string& value) {
+inline void Node_Geometry_Element_ProgressiveLevel::set_triangle_count(::google::protobuf::uint32 value) {
 
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Source.data)
+  triangle_count_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.ProgressiveLevel.triangle_count)
 }
-#if LANG_CXX11
-inline void Node_Geometry_Source::set_data(::std::string&& value) {
 
-  data_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:viro.Node.Geometry.Source.data)
+// float error = 3;
+inline void Node_Geometry_Element_ProgressiveLevel::clear_error() {
+  error_ = 0;
 }
-#endif
-inline void Node_Geometry_Source::set_data(const char* value) {
+inline float Node_Geometry_Element_ProgressiveLevel::error() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.ProgressiveLevel.error)
+  return error_;
+}
+inline void Node_Geometry_Element_ProgressiveLevel::set_error(float value) {
 
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:viro.Node.Geometry.Source.data)
+  error_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.ProgressiveLevel.error)
 }
-inline void Node_Geometry_Source::set_data(const void* value, size_t size) {
 
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:viro.Node.Geometry.Source.data)
+// -------------------------------------------------------------------
+
+// Node_Geometry_Element_BonePartition
+
+// uint32 triangle_offset = 1;
+inline void Node_Geometry_Element_BonePartition::clear_triangle_offset() {
+  triangle_offset_ = 0u;
 }
-inline ::std::string* Node_Geometry_Source::mutable_data() {
+inline ::google::protobuf::uint32 Node_Geometry_Element_BonePartition::triangle_offset() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.BonePartition.triangle_offset)
+  return triangle_offset_;
+}
+inline void Node_Geometry_Element_BonePartition::set_triangle_offset(::google::protobuf::uint32 value) {
 
-  // @@protoc_insertion_point(field_mutable:viro.Node.Geometry.Source.data)
-  return data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  triangle_offset_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.BonePartition.triangle_offset)
 }
-inline ::std::string* Node_Geometry_Source::release_data() {
-  // @@protoc_insertion_point(field_release:viro.Node.Geometry.Source.data)
 
-  return data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// uint32 triangle_count = 2;
+inline void Node_Geometry_Element_BonePartition::clear_triangle_count() {
+  triangle_count_ = 0u;
 }
-inline void Node_Geometry_Source::set_allocated_data(::std::string* data) {
-  if (data != NULL) {
+inline ::google::protobuf::uint32 Node_Geometry_Element_BonePartition::triangle_count() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.BonePartition.triangle_count)
+  return triangle_count_;
+}
+inline void Node_Geometry_Element_BonePartition::set_triangle_count(::google::protobuf::uint32 value) {
 
-  } else {
+  triangle_count_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.BonePartition.triangle_count)
+}
 
-  }
-  data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), data);
-  // @@protoc_insertion_point(field_set_allocated:viro.Node.Geometry.Source.data)
+// repeated uint32 bone = 3;
+inline int Node_Geometry_Element_BonePartition::bone_size() const {
+  return bone_.size();
+}
+inline void Node_Geometry_Element_BonePartition::clear_bone() {
+  bone_.Clear();
+}
+inline ::google::protobuf::uint32 Node_Geometry_Element_BonePartition::bone(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.BonePartition.bone)
+  return bone_.Get(index);
+}
+inline void Node_Geometry_Element_BonePartition::set_bone(int index, ::google::protobuf::uint32 value) {
+  bone_.Set(index, value);
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.BonePartition.bone)
+}
+inline void Node_Geometry_Element_BonePartition::add_bone(::google::protobuf::uint32 value) {
+  bone_.Add(value);
+  // @@protoc_insertion_point(field_add:viro.Node.Geometry.Element.BonePartition.bone)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+Node_Geometry_Element_BonePartition::bone() const {
+  // @@protoc_insertion_point(field_list:viro.Node.Geometry.Element.BonePartition.bone)
+  return bone_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+Node_Geometry_Element_BonePartition::mutable_bone() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.Geometry.Element.BonePartition.bone)
+  return &bone_;
 }
 
 // -------------------------------------------------------------------
@@ -2779,6 +4138,124 @@ inline void Node_Geometry_Element::set_bytes_per_index(::google::protobuf::uint3
   // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.bytes_per_index)
 }
 
+// repeated .viro.Node.Geometry.Element.Meshlet meshlet = 5;
+inline int Node_Geometry_Element::meshlet_size() const {
+  return meshlet_.size();
+}
+inline void Node_Geometry_Element::clear_meshlet() {
+  meshlet_.Clear();
+}
+inline const ::viro::Node_Geometry_Element_Meshlet& Node_Geometry_Element::meshlet(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.meshlet)
+  return meshlet_.Get(index);
+}
+inline ::viro::Node_Geometry_Element_Meshlet* Node_Geometry_Element::mutable_meshlet(int index) {
+  // @@protoc_insertion_point(field_mutable:viro.Node.Geometry.Element.meshlet)
+  return meshlet_.Mutable(index);
+}
+inline ::viro::Node_Geometry_Element_Meshlet* Node_Geometry_Element::add_meshlet() {
+  // @@protoc_insertion_point(field_add:viro.Node.Geometry.Element.meshlet)
+  return meshlet_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Element_Meshlet >*
+Node_Geometry_Element::mutable_meshlet() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.Geometry.Element.meshlet)
+  return &meshlet_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Element_Meshlet >&
+Node_Geometry_Element::meshlet() const {
+  // @@protoc_insertion_point(field_list:viro.Node.Geometry.Element.meshlet)
+  return meshlet_;
+}
+
+// repeated .viro.Node.Geometry.Element.ProgressiveLevel progressive_level = 6;
+inline int Node_Geometry_Element::progressive_level_size() const {
+  return progressive_level_.size();
+}
+inline void Node_Geometry_Element::clear_progressive_level() {
+  progressive_level_.Clear();
+}
+inline const ::viro::Node_Geometry_Element_ProgressiveLevel& Node_Geometry_Element::progressive_level(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.progressive_level)
+  return progressive_level_.Get(index);
+}
+inline ::viro::Node_Geometry_Element_ProgressiveLevel* Node_Geometry_Element::mutable_progressive_level(int index) {
+  // @@protoc_insertion_point(field_mutable:viro.Node.Geometry.Element.progressive_level)
+  return progressive_level_.Mutable(index);
+}
+inline ::viro::Node_Geometry_Element_ProgressiveLevel* Node_Geometry_Element::add_progressive_level() {
+  // @@protoc_insertion_point(field_add:viro.Node.Geometry.Element.progressive_level)
+  return progressive_level_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Element_ProgressiveLevel >*
+Node_Geometry_Element::mutable_progressive_level() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.Geometry.Element.progressive_level)
+  return &progressive_level_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Element_ProgressiveLevel >&
+Node_Geometry_Element::progressive_level() const {
+  // @@protoc_insertion_point(field_list:viro.Node.Geometry.Element.progressive_level)
+  return progressive_level_;
+}
+
+// bool primitive_restart = 7;
+inline void Node_Geometry_Element::clear_primitive_restart() {
+  primitive_restart_ = false;
+}
+inline bool Node_Geometry_Element::primitive_restart() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.primitive_restart)
+  return primitive_restart_;
+}
+inline void Node_Geometry_Element::set_primitive_restart(bool value) {
+
+  primitive_restart_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.primitive_restart)
+}
+
+// repeated .viro.Node.Geometry.Element.BonePartition bone_partition = 8;
+inline int Node_Geometry_Element::bone_partition_size() const {
+  return bone_partition_.size();
+}
+inline void Node_Geometry_Element::clear_bone_partition() {
+  bone_partition_.Clear();
+}
+inline const ::viro::Node_Geometry_Element_BonePartition& Node_Geometry_Element::bone_partition(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.bone_partition)
+  return bone_partition_.Get(index);
+}
+inline ::viro::Node_Geometry_Element_BonePartition* Node_Geometry_Element::mutable_bone_partition(int index) {
+  // @@protoc_insertion_point(field_mutable:viro.Node.Geometry.Element.bone_partition)
+  return bone_partition_.Mutable(index);
+}
+inline ::viro::Node_Geometry_Element_BonePartition* Node_Geometry_Element::add_bone_partition() {
+  // @@protoc_insertion_point(field_add:viro.Node.Geometry.Element.bone_partition)
+  return bone_partition_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Element_BonePartition >*
+Node_Geometry_Element::mutable_bone_partition() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.Geometry.Element.bone_partition)
+  return &bone_partition_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Element_BonePartition >&
+Node_Geometry_Element::bone_partition() const {
+  // @@protoc_insertion_point(field_list:viro.Node.Geometry.Element.bone_partition)
+  return bone_partition_;
+}
+
+// .viro.Node.Geometry.Encoding data_encoding = 9;
+inline void Node_Geometry_Element::clear_data_encoding() {
+  data_encoding_ = 0;
+}
+inline ::viro::Node_Geometry_Encoding Node_Geometry_Element::data_encoding() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Element.data_encoding)
+  return static_cast< ::viro::Node_Geometry_Encoding >(data_encoding_);
+}
+inline void Node_Geometry_Element::set_data_encoding(::viro::Node_Geometry_Encoding value) {
+
+  data_encoding_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Element.data_encoding)
+}
+
 // -------------------------------------------------------------------
 
 // Node_Geometry_Material_Visual
@@ -3514,6 +4991,52 @@ inline void Node_Geometry_Material::set_allocated_ao(::viro::Node_Geometry_Mater
 
 // -------------------------------------------------------------------
 
+// Node_Geometry_Skin_InfluenceTier
+
+// uint32 influences = 1;
+inline void Node_Geometry_Skin_InfluenceTier::clear_influences() {
+  influences_ = 0u;
+}
+inline ::google::protobuf::uint32 Node_Geometry_Skin_InfluenceTier::influences() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Skin.InfluenceTier.influences)
+  return influences_;
+}
+inline void Node_Geometry_Skin_InfluenceTier::set_influences(::google::protobuf::uint32 value) {
+
+  influences_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Skin.InfluenceTier.influences)
+}
+
+// uint32 vertex_offset = 2;
+inline void Node_Geometry_Skin_InfluenceTier::clear_vertex_offset() {
+  vertex_offset_ = 0u;
+}
+inline ::google::protobuf::uint32 Node_Geometry_Skin_InfluenceTier::vertex_offset() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Skin.InfluenceTier.vertex_offset)
+  return vertex_offset_;
+}
+inline void Node_Geometry_Skin_InfluenceTier::set_vertex_offset(::google::protobuf::uint32 value) {
+
+  vertex_offset_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Skin.InfluenceTier.vertex_offset)
+}
+
+// uint32 vertex_count = 3;
+inline void Node_Geometry_Skin_InfluenceTier::clear_vertex_count() {
+  vertex_count_ = 0u;
+}
+inline ::google::protobuf::uint32 Node_Geometry_Skin_InfluenceTier::vertex_count() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Skin.InfluenceTier.vertex_count)
+  return vertex_count_;
+}
+inline void Node_Geometry_Skin_InfluenceTier::set_vertex_count(::google::protobuf::uint32 value) {
+
+  vertex_count_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.Skin.InfluenceTier.vertex_count)
+}
+
+// -------------------------------------------------------------------
+
 // Node_Geometry_Skin
 
 // .viro.Node.Matrix geometry_bind_transform = 1;
@@ -3663,6 +5186,128 @@ inline void Node_Geometry_Skin::set_allocated_bone_weights(::viro::Node_Geometry
   // @@protoc_insertion_point(field_set_allocated:viro.Node.Geometry.Skin.bone_weights)
 }
 
+// repeated .viro.Node.Geometry.Skin.InfluenceTier influence_tier = 5;
+inline int Node_Geometry_Skin::influence_tier_size() const {
+  return influence_tier_.size();
+}
+inline void Node_Geometry_Skin::clear_influence_tier() {
+  influence_tier_.Clear();
+}
+inline const ::viro::Node_Geometry_Skin_InfluenceTier& Node_Geometry_Skin::influence_tier(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Skin.influence_tier)
+  return influence_tier_.Get(index);
+}
+inline ::viro::Node_Geometry_Skin_InfluenceTier* Node_Geometry_Skin::mutable_influence_tier(int index) {
+  // @@protoc_insertion_point(field_mutable:viro.Node.Geometry.Skin.influence_tier)
+  return influence_tier_.Mutable(index);
+}
+inline ::viro::Node_Geometry_Skin_InfluenceTier* Node_Geometry_Skin::add_influence_tier() {
+  // @@protoc_insertion_point(field_add:viro.Node.Geometry.Skin.influence_tier)
+  return influence_tier_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Skin_InfluenceTier >*
+Node_Geometry_Skin::mutable_influence_tier() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.Geometry.Skin.influence_tier)
+  return &influence_tier_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Skin_InfluenceTier >&
+Node_Geometry_Skin::influence_tier() const {
+  // @@protoc_insertion_point(field_list:viro.Node.Geometry.Skin.influence_tier)
+  return influence_tier_;
+}
+
+// repeated .viro.Node.DualQuaternion bind_dual_quaternion = 6;
+inline int Node_Geometry_Skin::bind_dual_quaternion_size() const {
+  return bind_dual_quaternion_.size();
+}
+inline void Node_Geometry_Skin::clear_bind_dual_quaternion() {
+  bind_dual_quaternion_.Clear();
+}
+inline const ::viro::Node_DualQuaternion& Node_Geometry_Skin::bind_dual_quaternion(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.Skin.bind_dual_quaternion)
+  return bind_dual_quaternion_.Get(index);
+}
+inline ::viro::Node_DualQuaternion* Node_Geometry_Skin::mutable_bind_dual_quaternion(int index) {
+  // @@protoc_insertion_point(field_mutable:viro.Node.Geometry.Skin.bind_dual_quaternion)
+  return bind_dual_quaternion_.Mutable(index);
+}
+inline ::viro::Node_DualQuaternion* Node_Geometry_Skin::add_bind_dual_quaternion() {
+  // @@protoc_insertion_point(field_add:viro.Node.Geometry.Skin.bind_dual_quaternion)
+  return bind_dual_quaternion_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::viro::Node_DualQuaternion >*
+Node_Geometry_Skin::mutable_bind_dual_quaternion() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.Geometry.Skin.bind_dual_quaternion)
+  return &bind_dual_quaternion_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::viro::Node_DualQuaternion >&
+Node_Geometry_Skin::bind_dual_quaternion() const {
+  // @@protoc_insertion_point(field_list:viro.Node.Geometry.Skin.bind_dual_quaternion)
+  return bind_dual_quaternion_;
+}
+
+// -------------------------------------------------------------------
+
+// Node_Geometry_LOD
+
+// repeated .viro.Node.Geometry.Element element = 1;
+inline int Node_Geometry_LOD::element_size() const {
+  return element_.size();
+}
+inline void Node_Geometry_LOD::clear_element() {
+  element_.Clear();
+}
+inline const ::viro::Node_Geometry_Element& Node_Geometry_LOD::element(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.LOD.element)
+  return element_.Get(index);
+}
+inline ::viro::Node_Geometry_Element* Node_Geometry_LOD::mutable_element(int index) {
+  // @@protoc_insertion_point(field_mutable:viro.Node.Geometry.LOD.element)
+  return element_.Mutable(index);
+}
+inline ::viro::Node_Geometry_Element* Node_Geometry_LOD::add_element() {
+  // @@protoc_insertion_point(field_add:viro.Node.Geometry.LOD.element)
+  return element_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Element >*
+Node_Geometry_LOD::mutable_element() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.Geometry.LOD.element)
+  return &element_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_Element >&
+Node_Geometry_LOD::element() const {
+  // @@protoc_insertion_point(field_list:viro.Node.Geometry.LOD.element)
+  return element_;
+}
+
+// float screen_size = 2;
+inline void Node_Geometry_LOD::clear_screen_size() {
+  screen_size_ = 0;
+}
+inline float Node_Geometry_LOD::screen_size() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.LOD.screen_size)
+  return screen_size_;
+}
+inline void Node_Geometry_LOD::set_screen_size(float value) {
+
+  screen_size_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.LOD.screen_size)
+}
+
+// float error = 3;
+inline void Node_Geometry_LOD::clear_error() {
+  error_ = 0;
+}
+inline float Node_Geometry_LOD::error() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.LOD.error)
+  return error_;
+}
+inline void Node_Geometry_LOD::set_error(float value) {
+
+  error_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.LOD.error)
+}
+
 // -------------------------------------------------------------------
 
 // Node_Geometry
@@ -3900,6 +5545,80 @@ inline void Node_Geometry::set_allocated_skin(::viro::Node_Geometry_Skin* skin)
   // @@protoc_insertion_point(field_set_allocated:viro.Node.Geometry.skin)
 }
 
+// repeated .viro.Node.Geometry.LOD lod = 7;
+inline int Node_Geometry::lod_size() const {
+  return lod_.size();
+}
+inline void Node_Geometry::clear_lod() {
+  lod_.Clear();
+}
+inline const ::viro::Node_Geometry_LOD& Node_Geometry::lod(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.lod)
+  return lod_.Get(index);
+}
+inline ::viro::Node_Geometry_LOD* Node_Geometry::mutable_lod(int index) {
+  // @@protoc_insertion_point(field_mutable:viro.Node.Geometry.lod)
+  return lod_.Mutable(index);
+}
+inline ::viro::Node_Geometry_LOD* Node_Geometry::add_lod() {
+  // @@protoc_insertion_point(field_add:viro.Node.Geometry.lod)
+  return lod_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_LOD >*
+Node_Geometry::mutable_lod() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.Geometry.lod)
+  return &lod_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry_LOD >&
+Node_Geometry::lod() const {
+  // @@protoc_insertion_point(field_list:viro.Node.Geometry.lod)
+  return lod_;
+}
+
+// repeated uint32 progressive_parent = 8;
+inline int Node_Geometry::progressive_parent_size() const {
+  return progressive_parent_.size();
+}
+inline void Node_Geometry::clear_progressive_parent() {
+  progressive_parent_.Clear();
+}
+inline ::google::protobuf::uint32 Node_Geometry::progressive_parent(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.progressive_parent)
+  return progressive_parent_.Get(index);
+}
+inline void Node_Geometry::set_progressive_parent(int index, ::google::protobuf::uint32 value) {
+  progressive_parent_.Set(index, value);
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.progressive_parent)
+}
+inline void Node_Geometry::add_progressive_parent(::google::protobuf::uint32 value) {
+  progressive_parent_.Add(value);
+  // @@protoc_insertion_point(field_add:viro.Node.Geometry.progressive_parent)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+Node_Geometry::progressive_parent() const {
+  // @@protoc_insertion_point(field_list:viro.Node.Geometry.progressive_parent)
+  return progressive_parent_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+Node_Geometry::mutable_progressive_parent() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.Geometry.progressive_parent)
+  return &progressive_parent_;
+}
+
+// .viro.Node.Geometry.Encoding data_encoding = 9;
+inline void Node_Geometry::clear_data_encoding() {
+  data_encoding_ = 0;
+}
+inline ::viro::Node_Geometry_Encoding Node_Geometry::data_encoding() const {
+  // @@protoc_insertion_point(field_get:viro.Node.Geometry.data_encoding)
+  return static_cast< ::viro::Node_Geometry_Encoding >(data_encoding_);
+}
+inline void Node_Geometry::set_data_encoding(::viro::Node_Geometry_Encoding value) {
+
+  data_encoding_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.Geometry.data_encoding)
+}
+
 // -------------------------------------------------------------------
 
 // Node_Skeleton_Bone
@@ -4190,6 +5909,66 @@ Node_SkeletalAnimation_Frame::local_transform() const {
   return local_transform_;
 }
 
+// repeated .viro.Node.DualQuaternion dual_quaternion = 5;
+inline int Node_SkeletalAnimation_Frame::dual_quaternion_size() const {
+  return dual_quaternion_.size();
+}
+inline void Node_SkeletalAnimation_Frame::clear_dual_quaternion() {
+  dual_quaternion_.Clear();
+}
+inline const ::viro::Node_DualQuaternion& Node_SkeletalAnimation_Frame::dual_quaternion(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.SkeletalAnimation.Frame.dual_quaternion)
+  return dual_quaternion_.Get(index);
+}
+inline ::viro::Node_DualQuaternion* Node_SkeletalAnimation_Frame::mutable_dual_quaternion(int index) {
+  // @@protoc_insertion_point(field_mutable:viro.Node.SkeletalAnimation.Frame.dual_quaternion)
+  return dual_quaternion_.Mutable(index);
+}
+inline ::viro::Node_DualQuaternion* Node_SkeletalAnimation_Frame::add_dual_quaternion() {
+  // @@protoc_insertion_point(field_add:viro.Node.SkeletalAnimation.Frame.dual_quaternion)
+  return dual_quaternion_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::viro::Node_DualQuaternion >*
+Node_SkeletalAnimation_Frame::mutable_dual_quaternion() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.SkeletalAnimation.Frame.dual_quaternion)
+  return &dual_quaternion_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::viro::Node_DualQuaternion >&
+Node_SkeletalAnimation_Frame::dual_quaternion() const {
+  // @@protoc_insertion_point(field_list:viro.Node.SkeletalAnimation.Frame.dual_quaternion)
+  return dual_quaternion_;
+}
+
+// repeated .viro.Node.DualQuaternion local_dual_quaternion = 6;
+inline int Node_SkeletalAnimation_Frame::local_dual_quaternion_size() const {
+  return local_dual_quaternion_.size();
+}
+inline void Node_SkeletalAnimation_Frame::clear_local_dual_quaternion() {
+  local_dual_quaternion_.Clear();
+}
+inline const ::viro::Node_DualQuaternion& Node_SkeletalAnimation_Frame::local_dual_quaternion(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.SkeletalAnimation.Frame.local_dual_quaternion)
+  return local_dual_quaternion_.Get(index);
+}
+inline ::viro::Node_DualQuaternion* Node_SkeletalAnimation_Frame::mutable_local_dual_quaternion(int index) {
+  // @@protoc_insertion_point(field_mutable:viro.Node.SkeletalAnimation.Frame.local_dual_quaternion)
+  return local_dual_quaternion_.Mutable(index);
+}
+inline ::viro::Node_DualQuaternion* Node_SkeletalAnimation_Frame::add_local_dual_quaternion() {
+  // @@protoc_insertion_point(field_add:viro.Node.SkeletalAnimation.Frame.local_dual_quaternion)
+  return local_dual_quaternion_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::viro::Node_DualQuaternion >*
+Node_SkeletalAnimation_Frame::mutable_local_dual_quaternion() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.SkeletalAnimation.Frame.local_dual_quaternion)
+  return &local_dual_quaternion_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::viro::Node_DualQuaternion >&
+Node_SkeletalAnimation_Frame::local_dual_quaternion() const {
+  // @@protoc_insertion_point(field_list:viro.Node.SkeletalAnimation.Frame.local_dual_quaternion)
+  return local_dual_quaternion_;
+}
+
 // -------------------------------------------------------------------
 
 // Node_SkeletalAnimation
@@ -4806,6 +6585,54 @@ Node_Camera::mutable_position() {
 
 // -------------------------------------------------------------------
 
+// Node_GeometryInstance
+
+// uint32 index = 1;
+inline void Node_GeometryInstance::clear_index() {
+  index_ = 0u;
+}
+inline ::google::protobuf::uint32 Node_GeometryInstance::index() const {
+  // @@protoc_insertion_point(field_get:viro.Node.GeometryInstance.index)
+  return index_;
+}
+inline void Node_GeometryInstance::set_index(::google::protobuf::uint32 value) {
+
+  index_ = value;
+  // @@protoc_insertion_point(field_set:viro.Node.GeometryInstance.index)
+}
+
+// repeated .viro.Node.Matrix transform = 2;
+inline int Node_GeometryInstance::transform_size() const {
+  return transform_.size();
+}
+inline void Node_GeometryInstance::clear_transform() {
+  transform_.Clear();
+}
+inline const ::viro::Node_Matrix& Node_GeometryInstance::transform(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.GeometryInstance.transform)
+  return transform_.Get(index);
+}
+inline ::viro::Node_Matrix* Node_GeometryInstance::mutable_transform(int index) {
+  // @@protoc_insertion_point(field_mutable:viro.Node.GeometryInstance.transform)
+  return transform_.Mutable(index);
+}
+inline ::viro::Node_Matrix* Node_GeometryInstance::add_transform() {
+  // @@protoc_insertion_point(field_add:viro.Node.GeometryInstance.transform)
+  return transform_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::viro::Node_Matrix >*
+Node_GeometryInstance::mutable_transform() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.GeometryInstance.transform)
+  return &transform_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::viro::Node_Matrix >&
+Node_GeometryInstance::transform() const {
+  // @@protoc_insertion_point(field_list:viro.Node.GeometryInstance.transform)
+  return transform_;
+}
+
+// -------------------------------------------------------------------
+
 // Node
 
 // string name = 1;
@@ -5215,6 +7042,75 @@ Node::subnode() const {
   return subnode_;
 }
 
+// repeated .viro.Node.Geometry shared_geometry = 14;
+inline int Node::shared_geometry_size() const {
+  return shared_geometry_.size();
+}
+inline void Node::clear_shared_geometry() {
+  shared_geometry_.Clear();
+}
+inline const ::viro::Node_Geometry& Node::shared_geometry(int index) const {
+  // @@protoc_insertion_point(field_get:viro.Node.shared_geometry)
+  return shared_geometry_.Get(index);
+}
+inline ::viro::Node_Geometry* Node::mutable_shared_geometry(int index) {
+  // @@protoc_insertion_point(field_mutable:viro.Node.shared_geometry)
+  return shared_geometry_.Mutable(index);
+}
+inline ::viro::Node_Geometry* Node::add_shared_geometry() {
+  // @@protoc_insertion_point(field_add:viro.Node.shared_geometry)
+  return shared_geometry_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry >*
+Node::mutable_shared_geometry() {
+  // @@protoc_insertion_point(field_mutable_list:viro.Node.shared_geometry)
+  return &shared_geometry_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::viro::Node_Geometry >&
+Node::shared_geometry() const {
+  // @@protoc_insertion_point(field_list:viro.Node.shared_geometry)
+  return shared_geometry_;
+}
+
+// .viro.Node.GeometryInstance geometry_instance = 15;
+inline bool Node::has_geometry_instance() const {
+  return this != internal_default_instance() && geometry_instance_ != NULL;
+}
+inline void Node::clear_geometry_instance() {
+  if (GetArenaNoVirtual() == NULL && geometry_instance_ != NULL) delete geometry_instance_;
+  geometry_instance_ = NULL;
+}
+inline const ::viro::Node_GeometryInstance& Node::geometry_instance() const {
+  // @@protoc_insertion_point(field_get:viro.Node.geometry_instance)
+  return geometry_instance_ != NULL ? *geometry_instance_
+                         : *::viro::Node_GeometryInstance::internal_default_instance();
+}
+inline ::viro::Node_GeometryInstance* Node::mutable_geometry_instance() {
+
+  if (geometry_instance_ == NULL) {
+    geometry_instance_ = new ::viro::Node_GeometryInstance;
+  }
+  // @@protoc_insertion_point(field_mutable:viro.Node.geometry_instance)
+  return geometry_instance_;
+}
+inline ::viro::Node_GeometryInstance* Node::release_geometry_instance() {
+  // @@protoc_insertion_point(field_release:viro.Node.geometry_instance)
+
+  ::viro::Node_GeometryInstance* temp = geometry_instance_;
+  geometry_instance_ = NULL;
+  return temp;
+}
+inline void Node::set_allocated_geometry_instance(::viro::Node_GeometryInstance* geometry_instance) {
+  delete geometry_instance_;
+  geometry_instance_ = geometry_instance;
+  if (geometry_instance) {
+
+  } else {
+
+  }
+  // @@protoc_insertion_point(field_set_allocated:viro.Node.geometry_instance)
+}
+
 #endif  // !PROTOBUF_INLINE_NOT_IN_HEADERS
 // -------------------------------------------------------------------
 
@@ -5257,12 +7153,14 @@ namespace google {
 namespace protobuf {
 
 template <> struct is_proto_enum< ::viro::Node_Geometry_Source_Semantic> : ::google::protobuf::internal::true_type {};
+template <> struct is_proto_enum< ::viro::Node_Geometry_Source_Normalization> : ::google::protobuf::internal::true_type {};
 template <> struct is_proto_enum< ::viro::Node_Geometry_Element_Primitive> : ::google::protobuf::internal::true_type {};
 template <> struct is_proto_enum< ::viro::Node_Geometry_Material_Visual_WrapMode> : ::google::protobuf::internal::true_type {};
 template <> struct is_proto_enum< ::viro::Node_Geometry_Material_Visual_FilterMode> : ::google::protobuf::internal::true_type {};
 template <> struct is_proto_enum< ::viro::Node_Geometry_Material_LightingModel> : ::google::protobuf::internal::true_type {};
 template <> struct is_proto_enum< ::viro::Node_Geometry_Material_CullMode> : ::google::protobuf::internal::true_type {};
 template <> struct is_proto_enum< ::viro::Node_Geometry_Material_BlendMode> : ::google::protobuf::internal::true_type {};
+template <> struct is_proto_enum< ::viro::Node_Geometry_Encoding> : ::google::protobuf::internal::true_type {};
 template <> struct is_proto_enum< ::viro::Node_Light_LightType> : ::google::protobuf::internal::true_type {};
 
 }  // namespace protobuf
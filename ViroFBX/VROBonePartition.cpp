@@ -0,0 +1,140 @@
+//
+//  VROBonePartition.cpp
+//  ViroFBX
+//
+//  Copyright © 2017 Viro. All rights reserved.
+//
+
+#include "VROBonePartition.h"
+#include "VROMeshData.h"
+#include "VROLog.h"
+#include <algorithm>
+#include <map>
+
+bool requiresBonePartitions(const VROMeshData &mesh, int maxBones) {
+    for (size_t i = 0; i < mesh.boneIndices.size(); i++) {
+        if (mesh.boneWeights[i] > 0 && mesh.boneIndices[i] >= maxBones) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ Collect the bones with non-zero weight on the given triangle into outBones, sorted
+ and without duplicates.
+ */
+static void readTriangleBones(const VROMeshData &mesh, const uint32_t *triangle, std::vector<int> *outBones) {
+    outBones->clear();
+    for (int i = 0; i < 3; i++) {
+        for (int b = 0; b < mesh.boneInfluences; b++) {
+            size_t slot = triangle[i] * mesh.boneInfluences + b;
+            if (mesh.boneWeights[slot] > 0) {
+                outBones->push_back(mesh.boneIndices[slot]);
+            }
+        }
+    }
+    std::sort(outBones->begin(), outBones->end());
+    outBones->erase(std::unique(outBones->begin(), outBones->end()), outBones->end());
+}
+
+std::vector<std::vector<VROBonePartition>> partitionBones(VROMeshData *mesh, int maxBones) {
+    passert (mesh->boneInfluences > 0);
+    std::vector<std::vector<VROBonePartition>> partitions(mesh->elements.size());
+
+    /*
+     The partition (numbered across all elements) that owns each vertex, and the
+     copies made of vertices claimed by more than one partition.
+     */
+    int numVertices = mesh->getVertexCount();
+    std::vector<int> vertexPartition(numVertices, -1);
+    std::map<std::pair<uint32_t, int>, uint32_t> copies;
+    std::vector<uint32_t> copySources;
+    std::vector<std::vector<int>> palettes;
+
+    std::vector<int> triangleBones;
+    std::vector<int> merged;
+
+    for (size_t e = 0; e < mesh->elements.size(); e++) {
+        std::vector<uint32_t> &element = mesh->elements[e];
+        int numTriangles = (int) element.size() / 3;
+
+        std::vector<bool> assigned(numTriangles, false);
+        std::vector<uint32_t> reordered;
+        reordered.reserve(element.size());
+
+        int numAssigned = 0;
+        while (numAssigned < numTriangles) {
+            VROBonePartition partition;
+            partition.triangleOffset = (int) reordered.size() / 3;
+            int partitionIndex = (int) palettes.size();
+
+            for (int t = 0; t < numTriangles; t++) {
+                if (assigned[t]) {
+                    continue;
+                }
+                readTriangleBones(*mesh, &element[t * 3], &triangleBones);
+
+                merged.clear();
+                std::set_union(partition.bones.begin(), partition.bones.end(),
+                               triangleBones.begin(), triangleBones.end(), std::back_inserter(merged));
+                if (merged.size() > maxBones && !partition.bones.empty()) {
+                    continue;
+                }
+                partition.bones.swap(merged);
+                assigned[t] = true;
+                ++numAssigned;
+                ++partition.triangleCount;
+
+                for (int i = 0; i < 3; i++) {
+                    uint32_t vertex = element[t * 3 + i];
+                    if (vertexPartition[vertex] < 0) {
+                        vertexPartition[vertex] = partitionIndex;
+                    }
+                    else if (vertexPartition[vertex] != partitionIndex) {
+                        auto copy = copies.find(std::make_pair(vertex, partitionIndex));
+                        if (copy == copies.end()) {
+                            uint32_t copyIndex = numVertices + (uint32_t) copySources.size();
+                            copy = copies.insert(std::make_pair(std::make_pair(vertex, partitionIndex), copyIndex)).first;
+                            copySources.push_back(vertex);
+                            vertexPartition.push_back(partitionIndex);
+                        }
+                        vertex = copy->second;
+                    }
+                    reordered.push_back(vertex);
+                }
+            }
+
+            palettes.push_back(partition.bones);
+            partitions[e].push_back(partition);
+        }
+        element.swap(reordered);
+    }
+
+    mesh->duplicateVertices(copySources);
+
+    /*
+     Rewrite each vertex's bone indices into its partition's palette.
+     */
+    for (int v = 0; v < mesh->getVertexCount(); v++) {
+        if (vertexPartition[v] < 0) {
+            continue;
+        }
+        const std::vector<int> &palette = palettes[vertexPartition[v]];
+        for (int b = 0; b < mesh->boneInfluences; b++) {
+            size_t slot = v * mesh->boneInfluences + b;
+            if (mesh->boneWeights[slot] > 0) {
+                auto it = std::lower_bound(palette.begin(), palette.end(), mesh->boneIndices[slot]);
+                passert (it != palette.end() && *it == mesh->boneIndices[slot]);
+                mesh->boneIndices[slot] = (int) (it - palette.begin());
+            }
+            else {
+                mesh->boneIndices[slot] = 0;
+            }
+        }
+    }
+
+    pinfo("      Partitioned skin into %d palettes of at most %d bones, duplicating %d vertices",
+          (int) palettes.size(), maxBones, (int) copySources.size());
+    return partitions;
+}
@@ -0,0 +1,54 @@
+//
+//  VROBonePartition.h
+//  ViroFBX
+//
+//  Copyright © 2017 Viro. All rights reserved.
+//
+
+#ifndef VROBonePartition_h
+#define VROBonePartition_h
+
+#include <stdio.h>
+#include <stdint.h>
+#include <vector>
+
+class VROMeshData;
+
+/*
+ A range [triangleOffset, triangleOffset + triangleCount) of an element's triangles
+ whose vertices are influenced only by the bones in the partition's palette. The
+ bone indices of those vertices index the palette, which holds the corresponding
+ skeleton bone indices.
+ */
+class VROBonePartition {
+public:
+    int triangleOffset;
+    int triangleCount;
+    std::vector<int> bones;
+
+    VROBonePartition() :
+        triangleOffset(0),
+        triangleCount(0) {}
+};
+
+/*
+ Returns true if any vertex of the mesh is influenced by a bone at or beyond
+ maxBones, in which case the mesh must be partitioned before it can be rendered
+ with a palette of maxBones bones.
+ */
+bool requiresBonePartitions(const VROMeshData &mesh, int maxBones);
+
+/*
+ Partition the triangles of each element of the skinned mesh so that each partition
+ is influenced by at most maxBones bones. Each partition collects, in order, the
+ remaining triangles whose bones fit in its palette, so that spatially coherent
+ triangles (which share bones) stay together. The triangles of each element are
+ reordered so that partitions are contiguous, vertices shared between partitions
+ are duplicated, and every bone index is rewritten to index its partition's palette.
+ Bone slots with zero weight are set to index 0.
+
+ Returns the partitions of each element.
+ */
+std::vector<std::vector<VROBonePartition>> partitionBones(VROMeshData *mesh, int maxBones);
+
+#endif /* VROBonePartition_h */
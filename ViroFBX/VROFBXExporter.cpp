@@ -15,6 +15,11 @@
 #include <iostream>
 #include <array>
 #include "VROUtil.h"
+#include "VROMeshData.h"
+#include "VROMeshOptimizer.h"
+#include "glm.hpp"
+#include "gtc/quaternion.hpp"
+#include "gtc/type_ptr.hpp"
 
 static const bool kDebugGeometrySource = false;
 static const bool kDebugBones = false;
@@ -23,6 +28,18 @@ static const bool kDebugNodeTransforms = false;
 static const int kAnimationFPS = 30;
 static const float kEpsilon = 0.00000001;
 
+/*
+ Number of frames sampled from each animation when measuring the displacement caused
+ by pruning bone influences.
+ */
+static const int kPruningErrorSamples = 16;
+
+/*
+ Largest deviation from orthonormal allowed in the basis of a transform written as a
+ dual quaternion. The transforms are read back from their float encoding.
+ */
+static const float kRigidTolerance = 1e-4f;
+
 FbxString GetAttributeTypeName(FbxNodeAttribute::EType type) {
     switch(type) {
         case FbxNodeAttribute::eUnknown: return "unidentified";
@@ -53,6 +70,7 @@ FbxString GetAttributeTypeName(FbxNodeAttribute::EType type) {
 
 VROFBXExporter::VROFBXExporter() {
     _fbxManager = FbxManager::Create();
+    _rootNode = nullptr;
 
 }
 
@@ -127,7 +145,10 @@ FbxScene *VROFBXExporter::loadFBX(std::string fbxPath) {
 
 #pragma mark - Export Geometry
 
-void VROFBXExporter::exportFBX(std::string fbxPath, std::string destPath, bool compressTextures) {
+void VROFBXExporter::exportFBX(std::string fbxPath, std::string destPath, bool compressTextures,
+                               VROFBXExportOptions options) {
+    _options = options;
+
     FbxScene *scene = loadFBX(fbxPath);
     if (scene == nullptr) {
         return;
@@ -140,8 +161,18 @@ void VROFBXExporter::exportFBX(std::string fbxPath, std::string destPath, bool c
 
     pinfo("Exporting FBX...");
     viro::Node *outNode = new viro::Node();
+    _rootNode = outNode;
 
     FbxNode *rootNode = scene->GetRootNode();
+    _geometryInstances.clear();
+    _sharedGeometryIndices.clear();
+    if (_options.instanceGeometry && rootNode) {
+        findGeometryInstances(rootNode);
+    }
+    _visibleTriangles.clear();
+    if (_options.removeHiddenGeometry && rootNode) {
+        findHiddenTriangles(scene, rootNode);
+    }
 
     FbxDouble3 translation = rootNode->LclTranslation.Get();
     outNode->add_position(translation[0]);
@@ -165,12 +196,7 @@ void VROFBXExporter::exportFBX(std::string fbxPath, std::string destPath, bool c
         std::vector<FbxNode *> boneNodes;
         exportSkeleton(rootNode, &boneNodes, skeleton);
 
-        for (int i = 0; i < rootNode->GetChildCount(); i++) {
-            if (isExportableNode(rootNode->GetChild(i))) {
-                exportNode(scene, rootNode->GetChild(i), 0, compressTextures,
-                           boneNodes, skeleton, outNode->add_subnode());
-            }
-        }
+        exportSubnodes(scene, rootNode, 0, compressTextures, boneNodes, skeleton, outNode);
     }
 
     int byteSize = outNode->ByteSize();
@@ -260,24 +286,39 @@ void VROFBXExporter::exportNode(FbxScene *scene, FbxNode *node, int depth, bool
     outNode->set_rendering_order(0);
     outNode->set_opacity(1.0);
 
-    if (node->GetMesh() != nullptr) {
-        pinfo("   Exporting geometry");
-        exportGeometry(node, depth, compressTextures, outNode->mutable_geometry());
-
+    if (node->GetMesh() != nullptr && _geometryInstances.count(node) > 0) {
+        pinfo("   Exporting geometry instance");
+        exportGeometryInstance(node, depth, compressTextures, outNode->mutable_geometry_instance());
+    }
+    else if (node->GetMesh() != nullptr) {
         /*
-         Export the skin, if there is a skeleton.
+         Export the skin first, if there is a skeleton. The bone influences for each
+         control point are needed when building the geometry's vertices, since vertices
+         are only welded together if their skinning data is identical as well.
          */
-        if (boneNodes.size() > 0 && node->GetMesh()->GetDeformerCount() > 0) {
-            pinfo("   Exporting skin");
-            exportSkin(node, boneNodes, outSkeleton, outNode->mutable_geometry()->mutable_skin());
+        bool hasSkin = boneNodes.size() > 0 && node->GetMesh()->GetDeformerCount() > 0;
+        VROControlPointMetadata skinMetadata;
 
-            pinfo("   Exporting skeletal animations");
-            exportSkeletalAnimations(scene, node, boneNodes, outNode);
+        if (hasSkin) {
+            pinfo("   Exporting skin");
+            exportSkin(node, boneNodes, outSkeleton, outNode->mutable_geometry()->mutable_skin(), &skinMetadata);
         }
         else {
             pinfo("   No skeleton found, will not export skin");
         }
 
+        pinfo("   Exporting geometry");
+        exportGeometry(node, depth, compressTextures, hasSkin ? &skinMetadata : nullptr, outNode->mutable_geometry());
+
+        if (hasSkin) {
+            pinfo("   Exporting skeletal animations");
+            exportSkeletalAnimations(scene, node, boneNodes, outNode);
+
+            if (_options.dualQuaternionSkinning) {
+                exportDualQuaternions(outNode);
+            }
+        }
+
         pinfo("   Exporting blend shape animations");
         exportBlendShapeAnimations(scene, node, outNode);
     }
@@ -286,236 +327,1678 @@ void VROFBXExporter::exportNode(FbxScene *scene, FbxNode *node, int depth, bool
     pinfo("   Exporting keyframe animations");
     exportSampledKeyframeAnimations(scene, node, outNode);
 
+    exportSubnodes(scene, node, depth, compressTextures, boneNodes, outSkeleton, outNode);
+}
+
+void VROFBXExporter::exportSubnodes(FbxScene *scene, FbxNode *node, int depth, bool compressTextures,
+                                    const std::vector<FbxNode *> &boneNodes,
+                                    viro::Node::Skeleton *outSkeleton, viro::Node *outNode) {
+    /*
+     Static children are batched together, provided there are at least two meshes to
+     merge among them; the rest are exported (and batched within) as usual.
+     */
+    std::vector<FbxNode *> batch;
+    if (_options.batchStaticMeshes) {
+        std::vector<std::pair<FbxNode *, FbxAMatrix>> meshes;
+        for (int i = 0; i < node->GetChildCount(); i++) {
+            FbxNode *child = node->GetChild(i);
+            if (isExportableNode(child) && isStaticSubtree(scene, child)) {
+                batch.push_back(child);
+                collectStaticMeshes(child, FbxAMatrix(), &meshes);
+            }
+        }
+        if (meshes.size() < 2) {
+            batch.clear();
+        }
+    }
+
+    /*
+     Sibling leaves that instance the same geometry are collapsed into one node, at
+     the position of the first of them.
+     */
+    std::map<int, std::vector<FbxNode *>> instanceGroups;
+    for (int i = 0; i < node->GetChildCount(); i++) {
+        FbxNode *child = node->GetChild(i);
+        if (isExportableNode(child) && std::find(batch.begin(), batch.end(), child) == batch.end() &&
+            isInstanceLeaf(scene, child)) {
+            instanceGroups[_geometryInstances[child]].push_back(child);
+        }
+    }
+
+    for (int i = 0; i < node->GetChildCount(); i++) {
+        FbxNode *child = node->GetChild(i);
+        if (!isExportableNode(child) || std::find(batch.begin(), batch.end(), child) != batch.end()) {
+            continue;
+        }
+
+        auto group = _geometryInstances.find(child);
+        if (group != _geometryInstances.end() && instanceGroups[group->second].size() > 1 &&
+            isInstanceLeaf(scene, child)) {
+            const std::vector<FbxNode *> &siblings = instanceGroups[group->second];
+            if (siblings.front() == child) {
+                exportInstanceGroup(siblings, depth, compressTextures, outNode->add_subnode());
+            }
+        }
+        else {
+            exportNode(scene, child, depth, compressTextures, boneNodes, outSkeleton, outNode->add_subnode());
+        }
+    }
+
+    if (!batch.empty()) {
+        exportStaticBatch(node, batch, compressTextures, outNode->add_subnode());
+    }
+}
+
+#pragma mark - Hidden Geometry Removal
+
+void VROFBXExporter::collectVisibilityMeshes(FbxScene *scene, FbxNode *node, const FbxAMatrix &parentTransform,
+                                             std::vector<std::pair<FbxNode *, FbxAMatrix>> *outMeshes) {
+    // Animated nodes move relative to the rest of the scene, and so does their subtree
+    if (isAnimated(scene, node)) {
+        return;
+    }
+
+    FbxDouble3 translation = node->LclTranslation.Get();
+    FbxDouble3 rotation = node->LclRotation.Get();
+    FbxDouble3 scaling = node->LclScaling.Get();
+    FbxAMatrix localTransform(FbxVector4(translation[0], translation[1], translation[2]),
+                              FbxVector4(rotation[0], rotation[1], rotation[2]),
+                              FbxVector4(scaling[0], scaling[1], scaling[2]));
+    FbxAMatrix transform = parentTransform * localTransform;
+
+    if (node->GetMesh() != nullptr && node->GetMesh()->GetDeformerCount() == 0) {
+        outMeshes->push_back(std::make_pair(node, transform));
+    }
+    for (int i = 0; i < node->GetChildCount(); i++) {
+        if (isExportableNode(node->GetChild(i))) {
+            collectVisibilityMeshes(scene, node->GetChild(i), transform, outMeshes);
+        }
+    }
+}
+
+/*
+ Whether the image of the texture may have an alpha channel. PNG and TGA headers are
+ read; JPEG and BMP are taken to be opaque, and any other format, or an image that
+ cannot be found, to possibly have alpha.
+ */
+bool VROFBXExporter::hasAlphaChannel(FbxFileTexture *texture) {
+    std::string textureName = extractTextureName(texture);
+    std::string extension = getFileExtension(textureName);
+    std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+    if (extension == "jpg" || extension == "jpeg" || extension == "bmp") {
+        return false;
+    }
+
+    // Look in the .fbm folder first, as in compressTexture
+    std::string texturePath = getFileName(_fbxPath) + ".fbm/" + textureName;
+    FILE *file = fopen(texturePath.c_str(), "rb");
+    if (file == nullptr) {
+        file = fopen(texture->GetFileName(), "rb");
+    }
+    if (file == nullptr) {
+        return true;
+    }
+    unsigned char header[26];
+    size_t headerSize = fread(header, 1, sizeof(header), file);
+    fclose(file);
+
+    if (extension == "png" && headerSize >= 26) {
+        // Color type in the IHDR chunk: grey with alpha (4), RGBA (6), or a palette (3),
+        // which may have transparent entries
+        return header[25] == 3 || header[25] == 4 || header[25] == 6;
+    }
+    if (extension == "tga" && headerSize >= 18) {
+        // The low bits of the image descriptor are the alpha bits per pixel
+        return (header[17] & 0x0F) != 0;
+    }
+    return true;
+}
+
+/*
+ Whether surfaces with the given material completely hide what is behind them: the
+ material is neither transparent nor blended, and has no opacity map or diffuse
+ texture with alpha (as used for alpha tested foliage and fences). Hardware
+ materials are shaders whose blending cannot be determined, so they are not
+ considered opaque.
+ */
+bool VROFBXExporter::isOpaqueMaterial(FbxSurfaceMaterial *material) {
+    if (material == nullptr) {
+        return true;
+    }
+    if (GetImplementation(material, FBXSDK_IMPLEMENTATION_HLSL) ||
+        GetImplementation(material, FBXSDK_IMPLEMENTATION_CGFX)) {
+        return false;
+    }
+
+    // Transparency as derived in exportMaterial
+    if (material->GetClassId().Is(FbxSurfaceLambert::ClassId)) {
+        FbxSurfaceLambert *lambert = reinterpret_cast<FbxSurfaceLambert *>(material);
+        double transparency = 0;
+        if (lambert->TransparencyFactor.IsValid() && lambert->TransparentColor.IsValid()) {
+            FbxDouble3 color = lambert->TransparentColor.Get();
+            transparency = (color[0] + color[1] + color[2]) * lambert->TransparencyFactor.Get() / 3.0;
+        }
+        else if (lambert->TransparencyFactor.IsValid()) {
+            transparency = lambert->TransparencyFactor.Get();
+        }
+        else if (lambert->TransparentColor.IsValid()) {
+            FbxDouble3 color = lambert->TransparentColor.Get();
+            transparency = (color[0] + color[1] + color[2]) / 3.0;
+        }
+        if (transparency > 0) {
+            return false;
+        }
+    }
+
+    for (FbxProperty property = material->GetFirstProperty(); property.IsValid();
+         property = material->GetNextProperty(property)) {
+        int numTextures = property.GetSrcObjectCount<FbxFileTexture>();
+        if (numTextures == 0) {
+            continue;
+        }
+
+        std::string name = property.GetNameAsCStr();
+        std::string lowercaseName = name;
+        std::transform(lowercaseName.begin(), lowercaseName.end(), lowercaseName.begin(), ::tolower);
+        if (name == FbxSurfaceMaterial::sTransparentColor || name == FbxSurfaceMaterial::sTransparencyFactor ||
+            lowercaseName.find("opacity") != std::string::npos) {
+            return false;
+        }
+        if (name == FbxSurfaceMaterial::sDiffuse || name == "TEX_color_map") {
+            for (int i = 0; i < numTextures; i++) {
+                if (hasAlphaChannel(property.GetSrcObject<FbxFileTexture>(i))) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+void VROFBXExporter::findHiddenTriangles(FbxScene *scene, FbxNode *rootNode) {
+    FbxDouble3 translation = rootNode->LclTranslation.Get();
+    FbxDouble3 rotation = rootNode->LclRotation.Get();
+    FbxDouble3 scaling = rootNode->LclScaling.Get();
+    FbxAMatrix rootTransform(FbxVector4(translation[0], translation[1], translation[2]),
+                             FbxVector4(rotation[0], rotation[1], rotation[2]),
+                             FbxVector4(scaling[0], scaling[1], scaling[2]));
+
+    std::vector<std::pair<FbxNode *, FbxAMatrix>> meshes;
+    for (int i = 0; i < rootNode->GetChildCount(); i++) {
+        if (isExportableNode(rootNode->GetChild(i))) {
+            collectVisibilityMeshes(scene, rootNode->GetChild(i), rootTransform, &meshes);
+        }
+    }
+
+    /*
+     Gather every static triangle in world space, recording where each mesh's
+     triangles begin, and whether each is opaque and so occludes what is behind it.
+     Triangles without a material are not exported, so they do not occlude either.
+     */
+    std::vector<float> triangles;
+    std::vector<bool> occluders;
+    std::vector<int> meshOffsets;
+    std::map<FbxSurfaceMaterial *, bool> opaqueMaterials;
+    for (const std::pair<FbxNode *, FbxAMatrix> &mesh : meshes) {
+        meshOffsets.push_back((int) triangles.size() / 9);
+
+        FbxMesh *fbxMesh = mesh.first->GetMesh();
+        const int *polygonVertices = fbxMesh->GetPolygonVertices();
+        const FbxVector4 *controlPoints = fbxMesh->GetControlPoints();
+        int numPolygons = fbxMesh->GetPolygonCount();
+        int numCorners = numPolygons * 3;
+        passert (numCorners == fbxMesh->GetPolygonVertexCount());
+
+        int numMaterials = mesh.first->GetMaterialCount();
+        std::vector<bool> opaque(std::max(numMaterials, 1), true);
+        for (int i = 0; i < numMaterials; i++) {
+            FbxSurfaceMaterial *material = mesh.first->GetMaterial(i);
+            auto it = opaqueMaterials.find(material);
+            if (it == opaqueMaterials.end()) {
+                it = opaqueMaterials.insert(std::make_pair(material, isOpaqueMaterial(material))).first;
+            }
+            opaque[i] = it->second;
+        }
+
+        std::vector<int> materialMapping = readMaterialToMeshMapping(fbxMesh, numPolygons);
+        for (int p = 0; p < numPolygons; p++) {
+            int materialIndex = numMaterials > 0 ? materialMapping[p] : 0;
+            occluders.push_back(materialIndex >= 0 && materialIndex < opaque.size() && opaque[materialIndex]);
+        }
+
+        for (int c = 0; c < numCorners; c++) {
+            const FbxVector4 &point = controlPoints[polygonVertices[c]];
+            FbxVector4 world = mesh.second.MultT(FbxVector4(point[0], point[1], point[2], 1));
+            triangles.push_back(world[0]);
+            triangles.push_back(world[1]);
+            triangles.push_back(world[2]);
+        }
+    }
+    meshOffsets.push_back((int) triangles.size() / 9);
+
+    int numTriangles = meshOffsets.back();
+    pinfo("Casting up to %d rays at each of %d static triangles in %d meshes (seed %u)", _options.visibilitySamples,
+          numTriangles, (int) meshes.size(), _options.visibilitySeed);
+    pinfo("   %d triangles have transparent (or no) materials, and do not occlude",
+          (int) std::count(occluders.begin(), occluders.end(), false));
+
+    std::vector<bool> visible = computeTriangleVisibility(triangles, occluders, _options.visibilitySamples,
+                                                          _options.visibilitySeed, getThreadPool());
+
+    for (int m = 0; m < meshes.size(); m++) {
+        _visibleTriangles[meshes[m].first].assign(visible.begin() + meshOffsets[m], visible.begin() + meshOffsets[m + 1]);
+    }
+
+    /*
+     Instanced nodes share one exported geometry, so a triangle is kept if it is
+     visible in any instance, and kept everywhere if any instance is animated.
+     */
+    std::map<int, std::vector<FbxNode *>> instanceGroups;
+    for (const auto &instance : _geometryInstances) {
+        instanceGroups[instance.second].push_back(instance.first);
+    }
+    for (const auto &group : instanceGroups) {
+        std::vector<bool> combined;
+        bool allStatic = true;
+        for (FbxNode *node : group.second) {
+            auto it = _visibleTriangles.find(node);
+            if (it == _visibleTriangles.end()) {
+                allStatic = false;
+                break;
+            }
+            combined.resize(it->second.size(), false);
+            for (size_t t = 0; t < it->second.size(); t++) {
+                combined[t] = combined[t] || it->second[t];
+            }
+        }
+        for (FbxNode *node : group.second) {
+            if (allStatic) {
+                _visibleTriangles[node] = combined;
+            }
+            else {
+                _visibleTriangles.erase(node);
+            }
+        }
+    }
+
+    int numHidden = 0;
+    for (const std::pair<FbxNode *, FbxAMatrix> &mesh : meshes) {
+        auto it = _visibleTriangles.find(mesh.first);
+        if (it == _visibleTriangles.end()) {
+            pinfo("   Node [%s]: instanced with animated geometry, kept whole", mesh.first->GetName());
+            continue;
+        }
+        int hidden = (int) std::count(it->second.begin(), it->second.end(), false);
+        numHidden += hidden;
+        pinfo("   Node [%s]: removing %d of %d triangles (%.1f%%)", mesh.first->GetName(), hidden,
+              (int) it->second.size(), it->second.empty() ? 0 : 100.0f * hidden / it->second.size());
+    }
+    pinfo("Removing %d of %d static triangles as hidden", numHidden, numTriangles);
+}
+
+#pragma mark - Geometry Instancing
+
+static void appendBytes(const void *data, size_t size, std::string *out) {
+    out->append((const char *) data, size);
+}
+
+static void appendIndexArray(FbxLayerElementArrayTemplate<int> &indexArray, std::string *out) {
+    int count = indexArray.GetCount();
+    appendBytes(&count, sizeof(count), out);
+
+    FbxLayerElementArrayReadLock<int> lock(indexArray);
+    if (count > 0) {
+        appendBytes(lock.GetData(), count * sizeof(int), out);
+    }
+}
+
+/*
+ Append the mapping, reference mode, and contents of the given layer element to the
+ signature. Absent elements are written as a single zero.
+ */
+template <typename T>
+static void appendLayerElement(const FbxLayerElementTemplate<T> *element, std::string *out) {
+    int present = element != nullptr;
+    appendBytes(&present, sizeof(present), out);
+    if (!element) {
+        return;
+    }
+
+    int modes[2] = { (int) element->GetMappingMode(), (int) element->GetReferenceMode() };
+    appendBytes(modes, sizeof(modes), out);
+
+    FbxLayerElementTemplate<T> *mutableElement = const_cast<FbxLayerElementTemplate<T> *>(element);
+    FbxLayerElementArrayTemplate<T> &directArray = mutableElement->GetDirectArray();
+    int count = directArray.GetCount();
+    appendBytes(&count, sizeof(count), out);
+
+    FbxLayerElementArrayReadLock<T> lock(directArray);
+    if (count > 0) {
+        appendBytes(lock.GetData(), count * sizeof(T), out);
+    }
+    if (element->GetReferenceMode() != FbxGeometryElement::eDirect) {
+        appendIndexArray(mutableElement->GetIndexArray(), out);
+    }
+}
+
+/*
+ Build a byte signature of everything exportGeometry() reads from the node: its
+ materials, and its mesh's control points, polygons, and layer elements. Two nodes
+ with equal signatures export identical geometry.
+ */
+static std::string readMeshSignature(FbxNode *node) {
+    std::string signature;
+    FbxMesh *mesh = node->GetMesh();
+
+    int numMaterials = node->GetMaterialCount();
+    appendBytes(&numMaterials, sizeof(numMaterials), &signature);
+    for (int i = 0; i < numMaterials; i++) {
+        FbxSurfaceMaterial *material = node->GetMaterial(i);
+        appendBytes(&material, sizeof(material), &signature);
+    }
+
+    int numControlPoints = mesh->GetControlPointsCount();
+    appendBytes(&numControlPoints, sizeof(numControlPoints), &signature);
+    if (numControlPoints > 0) {
+        appendBytes(mesh->GetControlPoints(), numControlPoints * sizeof(FbxVector4), &signature);
+    }
+
+    int numPolygons = mesh->GetPolygonCount();
+    int numPolygonVertices = mesh->GetPolygonVertexCount();
+    appendBytes(&numPolygons, sizeof(numPolygons), &signature);
+    appendBytes(&numPolygonVertices, sizeof(numPolygonVertices), &signature);
+    if (numPolygonVertices > 0) {
+        appendBytes(mesh->GetPolygonVertices(), numPolygonVertices * sizeof(int), &signature);
+    }
+
+    int numLayers = mesh->GetLayerCount();
+    appendBytes(&numLayers, sizeof(numLayers), &signature);
+    for (int l = 0; l < numLayers; l++) {
+        FbxLayer *layer = mesh->GetLayer(l);
+        appendLayerElement(layer->GetNormals(), &signature);
+        appendLayerElement(layer->GetTangents(), &signature);
+        appendLayerElement(layer->GetBinormals(), &signature);
+        appendLayerElement(layer->GetVertexColors(), &signature);
+
+        FbxArray<const FbxLayerElementUV *> uvSets = layer->GetUVSets();
+        int numUVSets = uvSets.GetCount();
+        appendBytes(&numUVSets, sizeof(numUVSets), &signature);
+        for (int i = 0; i < numUVSets; i++) {
+            signature.append(uvSets[i]->GetName());
+            signature.push_back(0);
+            appendLayerElement(uvSets[i], &signature);
+        }
+
+        // Only the material indices matter; the direct array is not used by the SDK
+        FbxLayerElementMaterial *materials = layer->GetMaterials();
+        int present = materials != nullptr;
+        appendBytes(&present, sizeof(present), &signature);
+        if (materials) {
+            int mappingMode = (int) materials->GetMappingMode();
+            appendBytes(&mappingMode, sizeof(mappingMode), &signature);
+            appendIndexArray(materials->GetIndexArray(), &signature);
+        }
+    }
+    return signature;
+}
+
+void VROFBXExporter::collectInstanceCandidates(FbxNode *node, std::vector<FbxNode *> *outNodes) {
+    // Skinned meshes and blend shapes are deformed per node, so they are never shared
+    if (node->GetMesh() != nullptr && node->GetMesh()->GetDeformerCount() == 0) {
+        outNodes->push_back(node);
+    }
+    for (int i = 0; i < node->GetChildCount(); i++) {
+        if (isExportableNode(node->GetChild(i))) {
+            collectInstanceCandidates(node->GetChild(i), outNodes);
+        }
+    }
+}
+
+void VROFBXExporter::findGeometryInstances(FbxNode *rootNode) {
+    std::vector<FbxNode *> candidates;
+    for (int i = 0; i < rootNode->GetChildCount(); i++) {
+        if (isExportableNode(rootNode->GetChild(i))) {
+            collectInstanceCandidates(rootNode->GetChild(i), &candidates);
+        }
+    }
+
+    /*
+     Group the nodes by the hash of their signature. Nodes with equal hashes are
+     compared by signature before they are grouped, so hash collisions never merge
+     different geometry.
+     */
+    std::hash<std::string> hasher;
+    std::map<size_t, std::vector<int>> groupsByHash;
+    std::vector<std::vector<FbxNode *>> groups;
+
+    for (FbxNode *node : candidates) {
+        std::string signature = readMeshSignature(node);
+        std::vector<int> &hashGroups = groupsByHash[hasher(signature)];
+
+        int group = -1;
+        for (int candidateGroup : hashGroups) {
+            if (readMeshSignature(groups[candidateGroup].front()) == signature) {
+                group = candidateGroup;
+                break;
+            }
+        }
+        if (group < 0) {
+            group = (int) groups.size();
+            groups.emplace_back();
+            hashGroups.push_back(group);
+        }
+        groups[group].push_back(node);
+    }
+
+    int numInstancedNodes = 0;
+    for (const std::vector<FbxNode *> &group : groups) {
+        if (group.size() < 2) {
+            continue;
+        }
+        for (FbxNode *node : group) {
+            _geometryInstances[node] = (int) _sharedGeometryIndices.size();
+        }
+        _sharedGeometryIndices.push_back(-1);
+        numInstancedNodes += group.size();
+    }
+    pinfo("Found %d shared geometries among %d meshes, referenced by %d nodes",
+          (int) _sharedGeometryIndices.size(), (int) candidates.size(), numInstancedNodes);
+}
+
+bool VROFBXExporter::isInstanceLeaf(FbxScene *scene, FbxNode *node) {
+    if (_geometryInstances.count(node) == 0 || isAnimated(scene, node)) {
+        return false;
+    }
     for (int i = 0; i < node->GetChildCount(); i++) {
         if (isExportableNode(node->GetChild(i))) {
-            exportNode(scene, node->GetChild(i), depth, compressTextures,
-                       boneNodes, outSkeleton, outNode->add_subnode());
+            return false;
+        }
+    }
+    return true;
+}
+
+void VROFBXExporter::exportGeometryInstance(FbxNode *node, int depth, bool compressTextures,
+                                            viro::Node::GeometryInstance *outInstance) {
+    int &index = _sharedGeometryIndices[_geometryInstances[node]];
+    if (index < 0) {
+        index = _rootNode->shared_geometry_size();
+        pinfo("   Exporting shared geometry %d", index);
+        exportGeometry(node, depth, compressTextures, nullptr, _rootNode->add_shared_geometry());
+    }
+    outInstance->set_index(index);
+}
+
+void VROFBXExporter::exportInstanceGroup(const std::vector<FbxNode *> &nodes, int depth, bool compressTextures,
+                                         viro::Node *outNode) {
+    pinfo("Exporting node [%s] with %d instances", nodes.front()->GetName(), (int) nodes.size());
+
+    outNode->set_name(nodes.front()->GetName());
+    for (int i = 0; i < 3; i++) {
+        outNode->add_position(0);
+        outNode->add_scale(1);
+        outNode->add_rotation(0);
+    }
+    outNode->set_rendering_order(0);
+    outNode->set_opacity(1.0);
+
+    viro::Node::GeometryInstance *instance = outNode->mutable_geometry_instance();
+    exportGeometryInstance(nodes.front(), depth, compressTextures, instance);
+
+    for (FbxNode *node : nodes) {
+        FbxDouble3 translation = node->LclTranslation.Get();
+        FbxDouble3 rotation = node->LclRotation.Get();
+        FbxDouble3 scaling = node->LclScaling.Get();
+        FbxAMatrix transform(FbxVector4(translation[0], translation[1], translation[2]),
+                             FbxVector4(rotation[0], rotation[1], rotation[2]),
+                             FbxVector4(scaling[0], scaling[1], scaling[2]));
+
+        viro::Node::Matrix *outTransform = instance->add_transform();
+        for (int t = 0; t < 16; t++) {
+            outTransform->add_value(transform.Get(t / 4, t % 4));
+        }
+    }
+}
+
+#pragma mark - Static Batching
+
+bool VROFBXExporter::isAnimated(FbxScene *scene, FbxNode *node) {
+    int numStacks = scene->GetSrcObjectCount(FbxCriteria::ObjectType(FbxAnimStack::ClassId));
+    for (int s = 0; s < numStacks; s++) {
+        FbxAnimStack *animStack = scene->GetSrcObject<FbxAnimStack>(s);
+
+        int numLayers = animStack->GetMemberCount<FbxAnimLayer>();
+        for (int l = 0; l < numLayers; l++) {
+            FbxAnimLayer *layer = animStack->GetMember<FbxAnimLayer>(l);
+            if (node->LclTranslation.GetCurveNode(layer) != nullptr ||
+                node->LclRotation.GetCurveNode(layer) != nullptr ||
+                node->LclScaling.GetCurveNode(layer) != nullptr ||
+                node->Visibility.GetCurveNode(layer) != nullptr) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool VROFBXExporter::isStaticSubtree(FbxScene *scene, FbxNode *node) {
+    if (isAnimated(scene, node)) {
+        return false;
+    }
+    if (node->GetMesh() != nullptr && node->GetMesh()->GetDeformerCount() > 0) {
+        return false;
+    }
+
+    for (int i = 0; i < node->GetChildCount(); i++) {
+        FbxNode *child = node->GetChild(i);
+        if (isExportableNode(child) && !isStaticSubtree(scene, child)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void VROFBXExporter::collectStaticMeshes(FbxNode *node, const FbxAMatrix &parentTransform,
+                                         std::vector<std::pair<FbxNode *, FbxAMatrix>> *outMeshes) {
+    /*
+     Compose the same local transforms that exportNode() writes, so that the batch
+     renders exactly as the unbatched nodes would.
+     */
+    FbxDouble3 translation = node->LclTranslation.Get();
+    FbxDouble3 rotation = node->LclRotation.Get();
+    FbxDouble3 scaling = node->LclScaling.Get();
+    FbxAMatrix localTransform(FbxVector4(translation[0], translation[1], translation[2]),
+                              FbxVector4(rotation[0], rotation[1], rotation[2]),
+                              FbxVector4(scaling[0], scaling[1], scaling[2]));
+    FbxAMatrix transform = parentTransform * localTransform;
+
+    if (node->GetMesh() != nullptr) {
+        outMeshes->push_back(std::make_pair(node, transform));
+    }
+    for (int i = 0; i < node->GetChildCount(); i++) {
+        if (isExportableNode(node->GetChild(i))) {
+            collectStaticMeshes(node->GetChild(i), transform, outMeshes);
+        }
+    }
+}
+
+/*
+ Transform the vertices of the mesh by the given affine transform. Normals use the
+ inverse transpose; if the transform mirrors, triangle winding and tangent handedness
+ are reversed so that front faces and bitangents are preserved.
+ */
+static void transformMeshData(const FbxAMatrix &transform, VROMeshData *meshData) {
+    FbxAMatrix linear = transform;
+    linear.SetT(FbxVector4(0, 0, 0, 1));
+    FbxAMatrix normalTransform = linear.Inverse().Transpose();
+    bool mirrored = linear.Determinant() < 0;
+
+    for (int v = 0; v < meshData->getVertexCount(); v++) {
+        float *position = &meshData->positions[v * 3];
+        FbxVector4 p = transform.MultT(FbxVector4(position[0], position[1], position[2], 1));
+        position[0] = p[0];
+        position[1] = p[1];
+        position[2] = p[2];
+
+        if (meshData->hasNormals) {
+            float *normal = &meshData->normals[v * 3];
+            FbxVector4 n = normalTransform.MultT(FbxVector4(normal[0], normal[1], normal[2], 0));
+            n.Normalize();
+            normal[0] = n[0];
+            normal[1] = n[1];
+            normal[2] = n[2];
+        }
+        if (meshData->hasTangents) {
+            float *tangent = &meshData->tangents[v * 4];
+            FbxVector4 t = linear.MultT(FbxVector4(tangent[0], tangent[1], tangent[2], 0));
+            t.Normalize();
+            tangent[0] = t[0];
+            tangent[1] = t[1];
+            tangent[2] = t[2];
+            if (mirrored) {
+                tangent[3] = -tangent[3];
+            }
+        }
+    }
+
+    if (mirrored) {
+        for (std::vector<uint32_t> &element : meshData->elements) {
+            for (size_t t = 0; t < element.size() / 3; t++) {
+                std::swap(element[t * 3 + 1], element[t * 3 + 2]);
+            }
+        }
+    }
+}
+
+void VROFBXExporter::exportStaticBatch(FbxNode *parent, const std::vector<FbxNode *> &nodes, bool compressTextures,
+                                       viro::Node *outNode) {
+    std::string name = std::string(parent->GetName()) + "_static_batch";
+    pinfo("Exporting static batch [%s] of %d subtrees", name.c_str(), (int) nodes.size());
+
+    outNode->set_name(name);
+    for (int i = 0; i < 3; i++) {
+        outNode->add_position(0);
+        outNode->add_scale(1);
+        outNode->add_rotation(0);
+    }
+    outNode->set_rendering_order(0);
+    outNode->set_opacity(1.0);
+
+    std::vector<std::pair<FbxNode *, FbxAMatrix>> meshes;
+    for (FbxNode *node : nodes) {
+        collectStaticMeshes(node, FbxAMatrix(), &meshes);
+    }
+
+    /*
+     Read each mesh with its own materials, then map each material to the batch's
+     material with identical exported properties. The batch carries every attribute
+     that any of its meshes carries.
+     */
+    std::vector<VROMeshData> parts(meshes.size());
+    std::vector<viro::Node::Geometry> partGeometries(meshes.size());
+    for (int m = 0; m < meshes.size(); m++) {
+        pinfo("   Reading mesh of node [%s]", meshes[m].first->GetName());
+        readGeometry(meshes[m].first, compressTextures, nullptr, &partGeometries[m], &parts[m]);
+        transformMeshData(meshes[m].second, &parts[m]);
+    }
+
+    viro::Node::Geometry *geo = outNode->mutable_geometry();
+    VROMeshData batch;
+    batch.hasTexcoords = false;
+    batch.hasNormals = false;
+    batch.hasTangents = false;
+    for (const VROMeshData &part : parts) {
+        batch.hasTexcoords |= part.hasTexcoords;
+        batch.hasNormals |= part.hasNormals;
+        batch.hasTangents |= part.hasTangents;
+    }
+
+    std::map<std::string, int> materialIndices;
+    for (int m = 0; m < parts.size(); m++) {
+        const viro::Node::Geometry &partGeometry = partGeometries[m];
+
+        std::vector<int> elementMapping;
+        for (const viro::Node::Geometry::Material &material : partGeometry.material()) {
+            std::string key = material.SerializeAsString();
+            auto it = materialIndices.find(key);
+            if (it == materialIndices.end()) {
+                it = materialIndices.insert(std::make_pair(key, geo->material_size())).first;
+                geo->add_material()->CopyFrom(material);
+            }
+            elementMapping.push_back(it->second);
+        }
+        batch.append(parts[m], elementMapping);
+    }
+
+    pinfo("   Merged %d meshes into %d vertices and %d materials", (int) parts.size(), batch.getVertexCount(),
+          geo->material_size());
+    exportMeshData(batch, false, geo);
+}
+
+/*
+ Read the given layer element for each of the mesh's triangle corners into out, which
+ must have room for components floats per corner. The element's direct and index arrays
+ are each locked once and walked directly, resolving the mapping and reference mode
+ without going through the SDK per corner. Corners whose index is out of range are
+ filled with unmappedValue, or zero if unmappedValue is null. If a pool is given, the
+ corners are split across its threads. Returns false if the element's mapping or
+ reference mode is not supported.
+ */
+template <typename T>
+static bool readLayerElement(const FbxLayerElementTemplate<T> *element, int components,
+                             const int *polygonVertices, int numCorners,
+                             const double *unmappedValue, VROThreadPool *pool, float *out) {
+    FbxGeometryElement::EMappingMode mappingMode = element->GetMappingMode();
+    FbxGeometryElement::EReferenceMode referenceMode = element->GetReferenceMode();
+
+    if (mappingMode != FbxGeometryElement::eByControlPoint &&
+        mappingMode != FbxGeometryElement::eByPolygonVertex &&
+        mappingMode != FbxGeometryElement::eByPolygon &&
+        mappingMode != FbxGeometryElement::eAllSame) {
+        pinfo("      Unsupported mapping mode %d for layer element %s", (int) mappingMode, element->GetName());
+        return false;
+    }
+    if (referenceMode != FbxGeometryElement::eDirect &&
+        referenceMode != FbxGeometryElement::eIndexToDirect) {
+        pinfo("      Unsupported reference mode %d for layer element %s", (int) referenceMode, element->GetName());
+        return false;
+    }
+
+    FbxLayerElementArrayTemplate<T> &directArray = const_cast<FbxLayerElementTemplate<T> *>(element)->GetDirectArray();
+    FbxLayerElementArrayTemplate<int> &indexArray = const_cast<FbxLayerElementTemplate<T> *>(element)->GetIndexArray();
+
+    FbxLayerElementArrayReadLock<T> directLock(directArray);
+    const T *direct = directLock.GetData();
+    int numDirect = directArray.GetCount();
+
+    const int *indices = nullptr;
+    int numIndices = 0;
+    FbxLayerElementArrayReadLock<int> indexLock(indexArray);
+    if (referenceMode == FbxGeometryElement::eIndexToDirect) {
+        indices = indexLock.GetData();
+        numIndices = indexArray.GetCount();
+    }
+
+    dispatchRanges(pool, numCorners, [&](int range, int start, int end) {
+        for (int c = start; c < end; c++) {
+            int index;
+            switch (mappingMode) {
+                case FbxGeometryElement::eByControlPoint:
+                    index = polygonVertices[c];
+                    break;
+                case FbxGeometryElement::eByPolygonVertex:
+                    index = c;
+                    break;
+                case FbxGeometryElement::eByPolygon:
+                    index = c / 3;
+                    break;
+                default:
+                    index = 0;
+                    break;
+            }
+
+            if (indices != nullptr) {
+                index = (index >= 0 && index < numIndices) ? indices[index] : -1;
+            }
+
+            float *value = out + c * components;
+            if (index < 0 || index >= numDirect) {
+                for (int i = 0; i < components; i++) {
+                    value[i] = unmappedValue != nullptr ? unmappedValue[i] : 0;
+                }
+            }
+            else {
+                for (int i = 0; i < components; i++) {
+                    value[i] = direct[index].mData[i];
+                }
+            }
+        }
+    });
+    return true;
+}
+
+VROThreadPool *VROFBXExporter::getThreadPool() {
+    if (!_threadPool) {
+        _threadPool = std::unique_ptr<VROThreadPool>(new VROThreadPool(_options.numThreads));
+    }
+    return _threadPool.get();
+}
+
+VROThreadPool *VROFBXExporter::getGeometryThreadPool(int numTriangles) {
+    if (_options.parallelTriangleThreshold > 0 && numTriangles >= _options.parallelTriangleThreshold) {
+        return getThreadPool();
+    }
+    return nullptr;
+}
+
+static bool hasNormalMap(const viro::Node::Geometry &geo) {
+    for (const viro::Node::Geometry::Material &material : geo.material()) {
+        if (material.has_normal() && !material.normal().texture().empty()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void VROFBXExporter::exportGeometry(FbxNode *node, int depth, bool compressTextures,
+                                    const VROControlPointMetadata *skinMetadata, viro::Node::Geometry *geo) {
+    VROMeshData meshData;
+    readGeometry(node, compressTextures, skinMetadata, geo, &meshData);
+    exportMeshData(meshData, skinMetadata != nullptr, geo);
+}
+
+void VROFBXExporter::readGeometry(FbxNode *node, bool compressTextures, const VROControlPointMetadata *skinMetadata,
+                                  viro::Node::Geometry *geo, VROMeshData *outMeshData) {
+    FbxMesh *mesh = node->GetMesh();
+    passert_msg (mesh, "Failed to export, null mesh!");
+
+    /*
+     Export the materials first, so that the vertex layout can be derived from what
+     they use.
+     */
+    int numMaterials = node->GetMaterialCount();
+    pinfo("   Exporting materials");
+    pinfo("      Num materials %d", numMaterials);
+
+    if (numMaterials > 0) {
+        for (int i = 0; i < numMaterials; i++) {
+            FbxSurfaceMaterial *fbxMaterial = node->GetMaterial(i);
+            viro::Node::Geometry::Material *material = geo->add_material();
+
+            exportMaterial(fbxMaterial, compressTextures, material);
+        }
+    }
+    else {
+        // If there are no materials, export a default (blank) material
+        viro::Node::Geometry::Material *material = geo->add_material();
+        material->set_transparency(1.0);
+
+        viro::Node::Geometry::Material::Visual *diffuse = material->mutable_diffuse();
+        diffuse->add_color(1.0);
+        diffuse->add_color(1.0);
+        diffuse->add_color(1.0);
+        diffuse->set_intensity(1.0);
+    }
+
+    /*
+     Only export the vertex attributes the materials read: UVs if any material is
+     textured, normals if any material is lit, and tangents if any material has a
+     normal map.
+     */
+    VROMeshData &meshData = *outMeshData;
+    if (_options.pruneVertexAttributes) {
+        meshData.hasTexcoords = false;
+        meshData.hasNormals = false;
+
+        for (const viro::Node::Geometry::Material &material : geo->material()) {
+            meshData.hasTexcoords |= isTextured(material);
+            meshData.hasNormals |= material.lighting_model() != viro::Node_Geometry_Material_LightingModel_Constant;
+        }
+        meshData.hasTangents = hasNormalMap(*geo);
+        pinfo("      Exporting attributes: UVs %d, normals %d, tangents %d", meshData.hasTexcoords,
+              meshData.hasNormals, meshData.hasTangents);
+    }
+
+    /*
+     Get the UV set names. For now we only use the first one.
+     */
+    const char *uvSetName = nullptr;
+    int layerCount = mesh->GetLayerCount();
+    if (layerCount > 0) {
+        for (int uvLayerIndex = 0; uvLayerIndex < layerCount; uvLayerIndex++) {
+            FbxLayer *layer = mesh->GetLayer(uvLayerIndex);
+
+            // One layer can have multiple UV sets
+            int uvSetCount = layer->GetUVSetCount();
+            FbxArray<const FbxLayerElementUV *> sets = layer->GetUVSets();
+
+            for (int uvIndex = 0; uvIndex < uvSetCount; uvIndex++) {
+                FbxLayerElementUV const* elementUV = sets[uvIndex];
+                if (elementUV) {
+                    uvSetName = elementUV->GetName();
+                }
+            }
+        }
+    }
+
+    pinfo("      UV set name %s", uvSetName);
+    if (_options.pruneVertexAttributes && meshData.hasTexcoords && uvSetName == nullptr) {
+        pinfo("      Mesh has no UV set, UVs will not be exported");
+        meshData.hasTexcoords = false;
+    }
+
+    /*
+     Read the vertex, normal, tex-coord, tangent, and (if skinned) bone data for each
+     triangle corner into the geometry sources. Each attribute is read in bulk from its
+     layer element's arrays, straight into the presized streams.
+     */
+    int numPolygons = mesh->GetPolygonCount();
+    int numCorners = mesh->GetPolygonVertexCount();
+    pinfo("      Polygon count %d", numPolygons);
+
+    // We only support triangles
+    passert (numCorners == numPolygons * 3);
+
+    /*
+     Large meshes are read in parallel, each thread taking a contiguous range of
+     corners (or triangles) and writing to its precomputed place in the output, so
+     that the result is identical to the serial read.
+     */
+    VROThreadPool *pool = getGeometryThreadPool(numPolygons);
+    if (pool != nullptr) {
+        pinfo("      Reading geometry on %d threads", pool->getNumThreads());
+    }
+
+    if (skinMetadata != nullptr) {
+        meshData.boneInfluences = skinMetadata->influences;
+    }
+    meshData.resize(numCorners);
+
+    const int *polygonVertices = mesh->GetPolygonVertices();
+    const FbxVector4 *controlPoints = mesh->GetControlPoints();
+    dispatchRanges(pool, numCorners, [&](int range, int start, int end) {
+        for (int c = start; c < end; c++) {
+            const FbxVector4 &vertex = controlPoints[polygonVertices[c]];
+            meshData.positions[c * 3 + 0] = vertex.mData[0];
+            meshData.positions[c * 3 + 1] = vertex.mData[1];
+            meshData.positions[c * 3 + 2] = vertex.mData[2];
+        }
+    });
+
+    /*
+     Unmapped corners are given (0, 1) so that they end up at (0, 0) once V is flipped
+     (FBX puts the UV origin at the bottom left).
+     */
+    static const double kUnmappedUV[2] = { 0, 1 };
+    if (meshData.hasTexcoords) {
+        const FbxGeometryElementUV *uvElement = uvSetName != nullptr ? mesh->GetElementUV(uvSetName) : nullptr;
+        if (uvElement != nullptr && readLayerElement(uvElement, 2, polygonVertices, numCorners, kUnmappedUV, pool,
+                                                     meshData.texcoords.data())) {
+            dispatchRanges(pool, numCorners, [&](int range, int start, int end) {
+                for (int c = start; c < end; c++) {
+                    meshData.texcoords[c * 2 + 1] = 1 - meshData.texcoords[c * 2 + 1];
+                }
+            });
+        }
+        else {
+            pinfo("      No readable UVs found, UVs will be zero");
+        }
+    }
+
+    if (meshData.hasNormals) {
+        const FbxGeometryElementNormal *normalElement = mesh->GetElementNormalCount() > 0 ? mesh->GetElementNormal(0) : nullptr;
+        if (normalElement == nullptr || !readLayerElement(normalElement, 3, polygonVertices, numCorners, nullptr, pool,
+                                                                     meshData.normals.data())) {
+            pinfo("      No readable normals found, normals will be generated");
+        }
+    }
+
+    if (meshData.hasTangents) {
+        const FbxGeometryElementTangent *tangentElement = mesh->GetElementTangentCount() > 0 ? mesh->GetElementTangent(0) : nullptr;
+        if (tangentElement == nullptr || !readLayerElement(tangentElement, 4, polygonVertices, numCorners, nullptr, pool,
+                                                                       meshData.tangents.data())) {
+            pinfo("      No readable tangents found, tangents will be generated");
+        }
+    }
+
+    if (skinMetadata != nullptr) {
+        /*
+         Each range records the control points it found without bones, which are then
+         logged in order, once per control point instead of once per corner.
+         */
+        int numRanges = pool != nullptr ? pool->getRangeCount(numCorners) : 1;
+        std::vector<std::vector<int>> controlPointsNoBones(numRanges);
+
+        dispatchRanges(pool, numCorners, [&](int range, int start, int end) {
+            for (int c = start; c < end; c++) {
+                int controlPointIndex = polygonVertices[c];
+                int *boneIndices = &meshData.boneIndices[c * meshData.boneInfluences];
+                float *boneWeights = &meshData.boneWeights[c * meshData.boneInfluences];
+
+                const VROBoneIndexWeight *boneData = skinMetadata->getBones(controlPointIndex);
+                if (boneData == nullptr) {
+                    controlPointsNoBones[range].push_back(controlPointIndex);
+                    continue;
+                }
+
+                for (int b = 0; b < meshData.boneInfluences; b++) {
+                    boneIndices[b] = boneData[b].index;
+                    boneWeights[b] = boneData[b].weight;
+                }
+            }
+        });
+
+        std::vector<bool> loggedControlPoints(mesh->GetControlPointsCount(), false);
+        for (const std::vector<int> &controlPoints : controlPointsNoBones) {
+            for (int controlPointIndex : controlPoints) {
+                if (controlPointIndex < 0 || controlPointIndex >= loggedControlPoints.size()) {
+                    pinfo("         No bones found for control point %d", controlPointIndex);
+                }
+                else if (!loggedControlPoints[controlPointIndex]) {
+                    loggedControlPoints[controlPointIndex] = true;
+                    pinfo("         No bones found for control point %d", controlPointIndex);
+                }
+            }
+        }
+    }
+
+    if (kDebugGeometrySource) {
+        for (int c = 0; c < numCorners; c++) {
+            pinfo("      Corner %d (polygon %d)", c, c / 3);
+            pinfo("            Read vertex %f, %f, %f", meshData.positions[c * 3 + 0], meshData.positions[c * 3 + 1],
+                  meshData.positions[c * 3 + 2]);
+            if (meshData.hasTexcoords) {
+                pinfo("            Read UV %f, %f", meshData.texcoords[c * 2 + 0], meshData.texcoords[c * 2 + 1]);
+            }
+            if (meshData.hasNormals) {
+                pinfo("            Read normal %f, %f, %f", meshData.normals[c * 3 + 0], meshData.normals[c * 3 + 1],
+                      meshData.normals[c * 3 + 2]);
+            }
+            if (meshData.hasTangents) {
+                pinfo("            Read tangent %f, %f, %f, %f", meshData.tangents[c * 4 + 0], meshData.tangents[c * 4 + 1],
+                      meshData.tangents[c * 4 + 2], meshData.tangents[c * 4 + 3]);
+            }
+        }
+    }
+
+    /*
+     Each corner is its own vertex at this point; the element for each material is
+     built from the corners of the triangles mapped to that material. Each range of
+     triangles first counts its triangles per material, which gives every range its
+     offset within each element; the ranges then fill the elements in place.
+     */
+    std::vector<int> materialMapping = readMaterialToMeshMapping(mesh, numPolygons);
+    int numElements = std::max(numMaterials, 1);
+    int numFaces = (int) materialMapping.size();
+    meshData.elements.resize(numElements);
+
+    int numFaceRanges = pool != nullptr ? pool->getRangeCount(numFaces) : 1;
+    std::vector<std::vector<int>> rangeOffsets(numFaceRanges, std::vector<int>(numElements, 0));
+
+    dispatchRanges(pool, numFaces, [&](int range, int start, int end) {
+        for (int face = start; face < end; face++) {
+            int materialIndex = numMaterials > 0 ? materialMapping[face] : 0;
+            if (materialIndex >= 0 && materialIndex < numElements) {
+                rangeOffsets[range][materialIndex]++;
+            }
+        }
+    });
+
+    for (int e = 0; e < numElements; e++) {
+        int offset = 0;
+        for (int range = 0; range < numFaceRanges; range++) {
+            int count = rangeOffsets[range][e];
+            rangeOffsets[range][e] = offset;
+            offset += count;
+        }
+        meshData.elements[e].resize(offset * 3);
+    }
+
+    dispatchRanges(pool, numFaces, [&](int range, int start, int end) {
+        std::vector<int> &offsets = rangeOffsets[range];
+        for (int face = start; face < end; face++) {
+            int materialIndex = numMaterials > 0 ? materialMapping[face] : 0;
+            if (materialIndex < 0 || materialIndex >= numElements) {
+                continue;
+            }
+
+            uint32_t *triangle = &meshData.elements[materialIndex][offsets[materialIndex] * 3];
+            triangle[0] = face * 3 + 0;
+            triangle[1] = face * 3 + 1;
+            triangle[2] = face * 3 + 2;
+            offsets[materialIndex]++;
+        }
+    });
+
+    /*
+     Drop the triangles found to be hidden inside the scene. Each corner is still its
+     own vertex, so a triangle's first index identifies its polygon.
+     */
+    auto visibility = _visibleTriangles.find(node);
+    if (visibility != _visibleTriangles.end()) {
+        const std::vector<bool> &visible = visibility->second;
+        passert (visible.size() == numPolygons);
+
+        for (std::vector<uint32_t> &element : meshData.elements) {
+            size_t kept = 0;
+            for (size_t t = 0; t < element.size() / 3; t++) {
+                if (visible[element[t * 3] / 3]) {
+                    std::copy(&element[t * 3], &element[t * 3] + 3, &element[kept * 3]);
+                    ++kept;
+                }
+            }
+            element.resize(kept * 3);
+        }
+    }
+}
+
+void VROFBXExporter::exportMeshData(VROMeshData &meshData, bool skinned, viro::Node::Geometry *geo) {
+    /*
+     Weld identical vertices so that triangles share them through the index buffer.
+     */
+    if (_options.weldVertices) {
+        int numCorners = meshData.getVertexCount();
+        int numWelded = meshData.weld();
+        pinfo("      Welded %d corners into %d vertices (%.2fx reduction)", numCorners, numWelded,
+              numWelded > 0 ? (float) numCorners / (float) numWelded : 0);
+    }
+
+    /*
+     Fill in the normals the FBX lacks, and generate tangents where a normal map will
+     sample them. Tangents read from the FBX are kept.
+     */
+    int numTriangles = 0;
+    for (const std::vector<uint32_t> &element : meshData.elements) {
+        numTriangles += (int) element.size() / 3;
+    }
+    VROThreadPool *pool = getGeometryThreadPool(numTriangles);
+
+    if (meshData.hasNormals) {
+        int numGenerated = generateNormals(&meshData, pool);
+        if (numGenerated > 0) {
+            pinfo("      Generated normals for %d vertices", numGenerated);
+        }
+    }
+    if (meshData.hasTangents && hasNormalMap(*geo)) {
+        if (meshData.hasNormals && meshData.hasTexcoords) {
+            int numSplit = generateTangents(&meshData, pool);
+            pinfo("      Generated tangents (%d vertices split at mirrored UVs)", numSplit);
+        }
+        else {
+            pinfo("      Mesh has no normals or UVs, tangents will be zero");
+        }
+    }
+
+    /*
+     Remove triangles that draw nothing or draw the same pixels twice. These are
+     common in scanned and CAD-derived meshes.
+     */
+    if (_options.cleanupTriangles) {
+        std::vector<bool> doubleSided;
+        for (int i = 0; i < meshData.elements.size(); i++) {
+            doubleSided.push_back(i < geo->material_size() &&
+                                  geo->material(i).cull_mode() == viro::Node_Geometry_Material_CullMode_None);
+        }
+
+        VROCleanupStats cleanup = cleanupMesh(&meshData, doubleSided);
+        pinfo("      Removed %d collapsed, %d zero-area, and %d duplicate triangles, and %d unreferenced vertices",
+              cleanup.collapsedTriangles, cleanup.zeroAreaTriangles, cleanup.duplicateTriangles,
+              cleanup.unreferencedVertices);
+    }
+
+    /*
+     Reorder each element's triangles for the post-transform vertex cache and, if
+     requested, to reduce overdraw. Then reorder the vertices themselves into first-use
+     order for sequential vertex fetch.
+     */
+    if (_options.optimizeVertexCache || _options.optimizeOverdraw) {
+        for (int i = 0; i < meshData.elements.size(); i++) {
+            std::vector<uint32_t> &indices = meshData.elements[i];
+            if (indices.empty()) {
+                continue;
+            }
+
+            VROVertexCacheStats before = analyzeVertexCache(indices, meshData.getVertexCount());
+            if (_options.optimizeVertexCache) {
+                optimizeVertexCache(indices, meshData.getVertexCount());
+            }
+            if (_options.optimizeOverdraw) {
+                optimizeOverdraw(indices, meshData.positions, meshData.getVertexCount(), _options.overdrawThreshold);
+            }
+            VROVertexCacheStats after = analyzeVertexCache(indices, meshData.getVertexCount());
+
+            pinfo("      Vertex cache for element %d: ACMR %.3f -> %.3f, ATVR %.3f -> %.3f", i,
+                  before.acmr, after.acmr, before.atvr, after.atvr);
+        }
+        optimizeVertexFetch(&meshData);
+    }
+
+    /*
+     Progressive ordering replaces the vertex and triangle order chosen above, though
+     triangles that appear at the same level retain their relative order.
+     */
+    std::vector<VROProgressiveLevel> progressiveLevels;
+    if (_options.progressiveMesh) {
+        if (!skinned) {
+            std::vector<uint32_t> parents;
+            buildProgressiveMesh(&meshData, _options.lodMaxError, &parents, &progressiveLevels);
+            for (uint32_t parent : parents) {
+                geo->add_progressive_parent(parent);
+            }
+
+            if (!progressiveLevels.empty()) {
+                pinfo("      Progressive mesh: %d levels, base mesh of %d vertices", (int) progressiveLevels.size(),
+                      progressiveLevels.front().vertexCount);
+            }
+        }
+        else {
+            pinfo("      Geometry is skinned, not generating progressive mesh");
+        }
+    }
+
+    /*
+     Skins that use bones beyond a single palette are split into partitions, each of
+     which indexes its own palette of skeleton bones.
+     */
+    std::vector<std::vector<VROBonePartition>> bonePartitions;
+    if (skinned && requiresBonePartitions(meshData, kMaxBones)) {
+        bonePartitions = partitionBones(&meshData, kMaxBones);
+        if (_options.optimizeVertexCache || _options.optimizeOverdraw) {
+            optimizeVertexFetch(&meshData);
+        }
+    }
+
+    /*
+     Sort the vertices into tiers by their number of bone influences, so the renderer
+     can skin rigid and lightly weighted ranges with fewer influences. This only
+     reorders vertices, so it is done last.
+     */
+    std::vector<VROInfluenceTier> influenceTiers;
+    if (skinned && _options.boneInfluenceTiers) {
+        influenceTiers = sortByInfluenceTier(&meshData);
+        for (const VROInfluenceTier &tier : influenceTiers) {
+            pinfo("      Influence tier %d: %d vertices", tier.influences, tier.vertexCount);
+        }
+    }
+
+    int numVertices = meshData.getVertexCount();
+    exportVertices(meshData, geo);
+
+    /*
+     The skin's bone sources are written from the same (welded) vertices, so that they
+     stay in the same order as the geometry sources.
+     */
+    if (skinned) {
+        exportSkinSources(meshData, geo->mutable_skin());
+
+        for (const VROInfluenceTier &tier : influenceTiers) {
+            viro::Node::Geometry::Skin::InfluenceTier *influenceTier = geo->mutable_skin()->add_influence_tier();
+            influenceTier->set_influences(tier.influences);
+            influenceTier->set_vertex_offset(tier.vertexOffset);
+            influenceTier->set_vertex_count(tier.vertexCount);
+        }
+    }
+
+    /*
+     Export the elements, one per material.
+     */
+    for (int i = 0; i < meshData.elements.size(); i++) {
+        /*
+         Strips and meshlets are not aligned to the bone partitions, so partitioned
+         elements are written as plain triangle lists.
+         */
+        bool partitioned = !bonePartitions.empty();
+        viro::Node::Geometry::Element *element = geo->add_element();
+        exportElement(meshData.elements[i], numVertices,
+                      !_options.buildMeshlets && progressiveLevels.empty() && !partitioned, element);
+
+        pinfo("      Primitive count for material %d: %d", i, element->primitive_count());
+        if (_options.buildMeshlets && !partitioned) {
+            exportMeshlets(meshData.elements[i], meshData, element);
+        }
+        if (partitioned) {
+            for (const VROBonePartition &partition : bonePartitions[i]) {
+                viro::Node::Geometry::Element::BonePartition *outPartition = element->add_bone_partition();
+                outPartition->set_triangle_offset(partition.triangleOffset);
+                outPartition->set_triangle_count(partition.triangleCount);
+                for (int bone : partition.bones) {
+                    outPartition->add_bone(bone);
+                }
+            }
+        }
+        for (const VROProgressiveLevel &level : progressiveLevels) {
+            viro::Node::Geometry::Element::ProgressiveLevel *outLevel = element->add_progressive_level();
+            outLevel->set_vertex_count(level.vertexCount);
+            outLevel->set_triangle_count(level.triangleCounts[i]);
+            outLevel->set_error(level.error);
+        }
+    }
+
+    /*
+     Skinned geometry deforms at runtime, so simplifying its bind pose gives no bound
+     on the error; only static geometry receives LODs.
+     */
+    if (!_options.lodRatios.empty()) {
+        if (!skinned) {
+            exportLODs(meshData, geo);
+        }
+        else {
+            pinfo("      Geometry is skinned, not generating LODs");
+        }
+    }
+
+    if (_options.encodeMeshData) {
+        encodeGeometryData(geo);
+    }
+}
+
+#pragma mark - Mesh Codec
+
+/*
+ Encode the given vertex blob in place if that makes it smaller, verifying that it
+ decodes back to the original. Returns the encoding used.
+ */
+static viro::Node_Geometry_Encoding encodeVertexBlob(std::string *blob, int stride, int *rawBytes, int *encodedBytes) {
+    *rawBytes += (int) blob->size();
+    if (blob->empty() || stride <= 0 || blob->size() % stride != 0) {
+        *encodedBytes += (int) blob->size();
+        return viro::Node_Geometry_Encoding_Raw;
+    }
+
+    int numVertices = (int) blob->size() / stride;
+    std::string encoded = encodeVertexBuffer(blob->data(), numVertices, stride);
+    std::string decoded;
+    passert_msg (decodeVertexBuffer(encoded, numVertices, stride, &decoded) && decoded == *blob,
+                 "Vertex codec failed to round trip");
+
+    if (encoded.size() >= blob->size()) {
+        *encodedBytes += (int) blob->size();
+        return viro::Node_Geometry_Encoding_Raw;
+    }
+    *encodedBytes += (int) encoded.size();
+    blob->swap(encoded);
+    return viro::Node_Geometry_Encoding_MeshVertex;
+}
+
+static void encodeVertexSource(viro::Node::Geometry::Source *source, int *rawBytes, int *encodedBytes) {
+    if (source->data().empty()) {
+        return;
+    }
+    std::string blob = source->data();
+    source->set_data_encoding(encodeVertexBlob(&blob, source->data_stride(), rawBytes, encodedBytes));
+    source->set_data(blob);
+}
+
+static void encodeElement(viro::Node::Geometry::Element *element, int *rawBytes, int *encodedBytes) {
+    const std::string &data = element->data();
+    *rawBytes += (int) data.size();
+
+    if (element->primitive() != viro::Node_Geometry_Element_Primitive_Triangle || data.empty()) {
+        *encodedBytes += (int) data.size();
+        return;
+    }
+
+    int bytesPerIndex = element->bytes_per_index();
+    std::vector<uint32_t> indices(data.size() / bytesPerIndex);
+    for (size_t i = 0; i < indices.size(); i++) {
+        if (bytesPerIndex == sizeof(uint16_t)) {
+            uint16_t index;
+            memcpy(&index, data.data() + i * sizeof(uint16_t), sizeof(uint16_t));
+            indices[i] = index;
+        }
+        else {
+            memcpy(&indices[i], data.data() + i * sizeof(uint32_t), sizeof(uint32_t));
+        }
+    }
+
+    /*
+     The codec may rotate triangles, which preserves their winding and position in
+     the list. The check compares the triangle sets exactly, up to rotation.
+     */
+    std::string encoded = encodeIndexBuffer(indices);
+    std::vector<uint32_t> decoded;
+    bool valid = decodeIndexBuffer(encoded, &decoded) && decoded.size() == indices.size();
+    for (size_t t = 0; valid && t < indices.size() / 3; t++) {
+        bool match = false;
+        for (int r = 0; r < 3; r++) {
+            match |= decoded[t * 3] == indices[t * 3 + r] &&
+                     decoded[t * 3 + 1] == indices[t * 3 + (r + 1) % 3] &&
+                     decoded[t * 3 + 2] == indices[t * 3 + (r + 2) % 3];
+        }
+        valid = match;
+    }
+    passert_msg (valid, "Index codec failed to round trip");
+
+    if (encoded.size() >= data.size()) {
+        *encodedBytes += (int) data.size();
+        return;
+    }
+    *encodedBytes += (int) encoded.size();
+    element->set_data(encoded);
+    element->set_data_encoding(viro::Node_Geometry_Encoding_MeshIndex);
+}
+
+void VROFBXExporter::encodeGeometryData(viro::Node::Geometry *geo) {
+    int vertexRaw = 0, vertexEncoded = 0;
+    int indexRaw = 0, indexEncoded = 0;
+
+    // The interleaved data's stride is that of any source that reads from it
+    int stride = 0;
+    for (const viro::Node::Geometry::Source &source : geo->source()) {
+        if (source.data().empty()) {
+            stride = source.data_stride();
+            break;
+        }
+    }
+    if (!geo->data().empty()) {
+        std::string blob = geo->data();
+        geo->set_data_encoding(encodeVertexBlob(&blob, stride, &vertexRaw, &vertexEncoded));
+        geo->set_data(blob);
+    }
+
+    for (viro::Node::Geometry::Source &source : *geo->mutable_source()) {
+        encodeVertexSource(&source, &vertexRaw, &vertexEncoded);
+    }
+    if (geo->has_skin()) {
+        encodeVertexSource(geo->mutable_skin()->mutable_bone_indices(), &vertexRaw, &vertexEncoded);
+        encodeVertexSource(geo->mutable_skin()->mutable_bone_weights(), &vertexRaw, &vertexEncoded);
+    }
+
+    for (viro::Node::Geometry::Element &element : *geo->mutable_element()) {
+        encodeElement(&element, &indexRaw, &indexEncoded);
+    }
+    for (viro::Node::Geometry::LOD &lod : *geo->mutable_lod()) {
+        for (viro::Node::Geometry::Element &element : *lod.mutable_element()) {
+            encodeElement(&element, &indexRaw, &indexEncoded);
+        }
+    }
+
+    pinfo("      Mesh codec: vertices %d -> %d bytes, indices %d -> %d bytes", vertexRaw, vertexEncoded,
+          indexRaw, indexEncoded);
+}
+
+void VROFBXExporter::exportVertices(const VROMeshData &meshData, viro::Node::Geometry *geo) {
+    int numVertices = meshData.getVertexCount();
+    VROVertexLayout layout(numVertices);
+
+    VROVertexFormat positionFormat = VROVertexFormat::Float;
+    VROVertexFormat texcoordFormat = VROVertexFormat::Float;
+    std::vector<float> positionScale, positionOffset;
+    std::vector<float> texcoordScale, texcoordOffset;
+
+    if (_options.quantizeVertices && numVertices > 0) {
+        /*
+         Positions are quantized over their bounding box; the tolerance is relative to
+         its largest extent.
+         */
+        fitQuantizationRange(meshData.positions.data(), numVertices, 3, VROVertexFormat::SNorm16,
+                             &positionScale, &positionOffset);
+        float extent = 2 * std::max(positionScale[0], std::max(positionScale[1], positionScale[2]));
+        float tolerance = _options.quantizeTolerance * extent;
+        float error = measureQuantizationError(meshData.positions.data(), numVertices, 3, VROVertexFormat::SNorm16,
+                                               positionScale, positionOffset);
+        if (error <= tolerance) {
+            positionFormat = VROVertexFormat::SNorm16;
+            pinfo("      Quantized positions to snorm16, max error %f (tolerance %f)", error, tolerance);
+        }
+        else {
+            positionScale.clear();
+            positionOffset.clear();
+            pwarn("      Positions exceed quantization tolerance (error %f, tolerance %f), keeping floats", error, tolerance);
+        }
+    }
+
+    if (_options.quantizeVertices && meshData.hasTexcoords && numVertices > 0) {
+        /*
+         UVs within [0, 1] are stored as unorm16 directly. UVs that wrap (i.e. that are
+         used with repeating textures) are stored as unorm16 over their range if that
+         is precise enough, and as half floats otherwise.
+         */
+        std::vector<float> scale, offset;
+        fitQuantizationRange(meshData.texcoords.data(), numVertices, 2, VROVertexFormat::UNorm16, &scale, &offset);
+        bool wraps = offset[0] < 0 || offset[1] < 0 || offset[0] + scale[0] > 1 || offset[1] + scale[1] > 1;
+        if (!wraps) {
+            scale.clear();
+            offset.clear();
+        }
+
+        float uvTolerance = _options.quantizeUVTolerance;
+        float uvError = measureQuantizationError(meshData.texcoords.data(), numVertices, 2, VROVertexFormat::UNorm16,
+                                                 scale, offset);
+        if (uvError <= uvTolerance) {
+            texcoordFormat = VROVertexFormat::UNorm16;
+            texcoordScale = scale;
+            texcoordOffset = offset;
+            pinfo("      Quantized UVs to unorm16%s, max error %f (tolerance %f)", wraps ? " with wrapping" : "",
+                  uvError, uvTolerance);
+        }
+        else {
+            uvError = measureQuantizationError(meshData.texcoords.data(), numVertices, 2, VROVertexFormat::Half, {}, {});
+            if (uvError <= uvTolerance) {
+                texcoordFormat = VROVertexFormat::Half;
+                pinfo("      Quantized UVs to half, max error %f (tolerance %f)", uvError, uvTolerance);
+            }
+            else {
+                pwarn("      UVs exceed quantization tolerance (error %f, tolerance %f), keeping floats", uvError, uvTolerance);
+            }
         }
     }
-}
 
-void VROFBXExporter::exportGeometry(FbxNode *node, int depth, bool compressTextures, viro::Node::Geometry *geo) {
-    FbxMesh *mesh = node->GetMesh();
-    passert_msg (mesh, "Failed to export, null mesh!");
+    VROVertexAttribute &positions = layout.addAttribute(viro::Node_Geometry_Source_Semantic_Vertex, 3, positionFormat,
+                                                        meshData.positions.data(), _options.separatePositions);
+    positions.scale = positionScale;
+    positions.offset = positionOffset;
 
-    mesh->GenerateTangentsData(0);
-    int cornerCounter = 0;
+    if (meshData.hasTexcoords) {
+        VROVertexAttribute &texcoords = layout.addAttribute(viro::Node_Geometry_Source_Semantic_Texcoord, 2, texcoordFormat,
+                                                            meshData.texcoords.data());
+        texcoords.scale = texcoordScale;
+        texcoords.offset = texcoordOffset;
+    }
 
     /*
-     Get the UV set names. For now we only use the first one.
+     QTangents replace the normal and tangent together, so they are only used when
+     both are exported.
      */
-    const char *uvSetName = nullptr;
-    int layerCount = mesh->GetLayerCount();
-    if (layerCount > 0) {
-        for (int uvLayerIndex = 0; uvLayerIndex < layerCount; uvLayerIndex++) {
-            FbxLayer *layer = mesh->GetLayer(uvLayerIndex);
+    std::vector<float> qtangents;
+    if (_options.encodeQTangents && meshData.hasNormals && meshData.hasTangents) {
+        encodeQTangents(meshData.normals.data(), meshData.tangents.data(), numVertices, &qtangents);
+        layout.addAttribute(viro::Node_Geometry_Source_Semantic_QTangent, 4, VROVertexFormat::SNorm16, qtangents.data());
+        pinfo("      Encoded normals and tangents as QTangents");
+    }
+    else {
+        if (meshData.hasNormals) {
+            layout.addAttribute(viro::Node_Geometry_Source_Semantic_Normal, 3, VROVertexFormat::Float, meshData.normals.data());
+        }
+        if (meshData.hasTangents) {
+            layout.addAttribute(viro::Node_Geometry_Source_Semantic_Tangent, 4, VROVertexFormat::Float, meshData.tangents.data());
+        }
+    }
+    layout.exportGeometry(geo);
 
-            // One layer can have multiple UV sets
-            int uvSetCount = layer->GetUVSetCount();
-            FbxArray<const FbxLayerElementUV *> sets = layer->GetUVSets();
+    // Size of the full position, UV, normal, and tangent float layout, for comparison
+    int fullSize = numVertices * 12 * sizeof(float);
+    pinfo("      Num vertices %d, stride %d", numVertices, layout.getStride());
+    if (_options.separatePositions) {
+        int positionStride = layout.getAttributes().front().getAlignedSize();
+        pinfo("      Position stream size %d, stride %d", numVertices * positionStride, positionStride);
+    }
+    pinfo("      VAR size %lu (%d with every attribute as floats)", geo->data().size(), fullSize);
+}
 
-            for (int uvIndex = 0; uvIndex < uvSetCount; uvIndex++) {
-                FbxLayerElementUV const* elementUV = sets[uvIndex];
-                if (elementUV) {
-                    uvSetName = elementUV->GetName();
-                }
-            }
-        }
+/*
+ Write the indices to the element, as 16-bit values whenever every vertex is
+ addressable with them.
+ */
+static void writeIndices(const std::vector<uint32_t> &indices, int numVertices,
+                         viro::Node::Geometry::Element *element) {
+    if (numVertices <= 0xFFFF) {
+        std::vector<uint16_t> shortIndices(indices.begin(), indices.end());
+        element->set_data(shortIndices.data(), shortIndices.size() * sizeof(uint16_t));
+        element->set_bytes_per_index(sizeof(uint16_t));
+    }
+    else {
+        element->set_data(indices.data(), indices.size() * sizeof(uint32_t));
+        element->set_bytes_per_index(sizeof(uint32_t));
     }
+}
 
-    pinfo("      UV set name %s", uvSetName);
+void VROFBXExporter::exportElement(const std::vector<uint32_t> &indices, int numVertices, bool allowStrip,
+                                   viro::Node::Geometry::Element *element) {
+    element->set_primitive(viro::Node_Geometry_Element_Primitive_Triangle);
+    element->set_primitive_count((int)indices.size() / 3);
+    writeIndices(indices, numVertices, element);
+
+    if (!allowStrip || !_options.stripifyElements || indices.empty()) {
+        return;
+    }
 
     /*
-     Export the vertex, normal, tex-coord, and tangent data (the geometry
-     sources).
+     The strip uses the same index width as the list, so the smaller index count is
+     the smaller element. The restart index is the largest value of that width, which
+     no vertex can use.
      */
-    std::vector<float> data;
+    uint32_t restartIndex = numVertices <= 0xFFFF ? 0xFFFF : 0xFFFFFFFF;
+    std::vector<uint32_t> strip = stripify(indices, _options.stripPrimitiveRestart, restartIndex);
+    bool useStrip = strip.size() >= 3 && strip.size() < indices.size();
+
+    pinfo("      Triangle strip has %d indices, triangle list has %d (%.1f%%), using %s", (int) strip.size(),
+          (int) indices.size(), 100.0f * strip.size() / indices.size(), useStrip ? "strip" : "list");
+    if (useStrip) {
+        element->set_primitive(viro::Node_Geometry_Element_Primitive_TriangleStrip);
+        element->set_primitive_count((int) strip.size() - 2);
+        element->set_primitive_restart(_options.stripPrimitiveRestart);
+        writeIndices(strip, numVertices, element);
+    }
+}
 
-    int numPolygons = mesh->GetPolygonCount();
-    pinfo("      Polygon count %d", numPolygons);
+void VROFBXExporter::exportMeshlets(const std::vector<uint32_t> &indices, const VROMeshData &meshData,
+                                    viro::Node::Geometry::Element *element) {
+    std::vector<VROMeshlet> meshlets = buildMeshlets(indices, meshData.positions, meshData.getVertexCount());
 
-    for (unsigned int i = 0; i < numPolygons; i++) {
-        if (kDebugGeometrySource) {
-            pinfo("      Reading polygon %d", i);
+    int numVerticesReferenced = 0;
+    for (const VROMeshlet &meshlet : meshlets) {
+        viro::Node::Geometry::Element::Meshlet *outMeshlet = element->add_meshlet();
+        outMeshlet->set_triangle_offset(meshlet.triangleOffset);
+        outMeshlet->set_triangle_count(meshlet.triangleCount);
+        outMeshlet->set_vertex_count(meshlet.vertexCount);
+
+        for (int i = 0; i < 3; i++) {
+            outMeshlet->add_bounding_sphere(meshlet.center[i]);
         }
+        outMeshlet->add_bounding_sphere(meshlet.radius);
 
-        // We only support triangles
-        int polygonSize = mesh->GetPolygonSize(i);
-        passert (polygonSize == 3);
+        for (int i = 0; i < 3; i++) {
+            outMeshlet->add_cone_apex(meshlet.coneApex[i]);
+            outMeshlet->add_cone_axis(meshlet.coneAxis[i]);
+        }
+        outMeshlet->set_cone_cutoff(meshlet.coneCutoff);
 
-        for (int j = 0; j < polygonSize; j++) {
-            if (kDebugGeometrySource) {
-                pinfo("         V%d", j);
-            }
-            int controlPointIndex = mesh->GetPolygonVertex(i, j);
+        numVerticesReferenced += meshlet.vertexCount;
+    }
 
-            FbxVector4 vertex = mesh->GetControlPointAt(controlPointIndex);
-            data.push_back(vertex.mData[0]);
-            data.push_back(vertex.mData[1]);
-            data.push_back(vertex.mData[2]);
+    if (!meshlets.empty()) {
+        pinfo("      Meshlets: %d, average %.1f triangles and %.1f vertices", (int) meshlets.size(),
+              (float) (indices.size() / 3) / meshlets.size(), (float) numVerticesReferenced / meshlets.size());
+    }
+}
 
-            if (kDebugGeometrySource) {
-                pinfo("            Read vertex %f, %f, %f", vertex.mData[0], vertex.mData[1], vertex.mData[2]);
-            }
+void VROFBXExporter::exportLODs(const VROMeshData &meshData, viro::Node::Geometry *geo) {
+    int numVertices = meshData.getVertexCount();
+    int numTriangles = 0;
+    for (const std::vector<uint32_t> &indices : meshData.elements) {
+        numTriangles += (int) indices.size() / 3;
+    }
 
-            FbxVector2 uv;
-            bool unmapped;
-            bool hasUV = mesh->GetPolygonVertexUV(i, j, uvSetName, uv, unmapped);
+    std::vector<float> ratios = _options.lodRatios;
+    std::sort(ratios.begin(), ratios.end(), std::greater<float>());
 
-            if (kDebugGeometrySource) {
-                pinfo("            Read UV %f, %f", uv.mData[0], uv.mData[1]);
-            }
+    int previousTriangles = numTriangles;
+    for (float ratio : ratios) {
+        std::vector<std::vector<uint32_t>> lodElements;
+        float error = simplifyMesh(meshData.elements, meshData.positions, numVertices, ratio,
+                                   _options.lodMaxError, &lodElements);
 
-            if (hasUV && !unmapped) {
-                data.push_back(uv.mData[0]);
-                data.push_back(1 - uv.mData[1]);
-            }
-            else {
-                data.push_back(0);
-                data.push_back(0);
-            }
+        int lodTriangles = 0;
+        for (const std::vector<uint32_t> &indices : lodElements) {
+            lodTriangles += (int) indices.size() / 3;
+        }
 
-            FbxVector4 normal;
-            bool hasNormal = mesh->GetPolygonVertexNormal(i, j, normal);
+        /*
+         Once the error limit stops the simplification from making progress, every
+         remaining (smaller) ratio would produce the same level.
+         */
+        if (lodTriangles >= previousTriangles) {
+            pinfo("      LOD at ratio %.3f reached no further than %d triangles within max error, stopping",
+                  ratio, lodTriangles);
+            break;
+        }
+        previousTriangles = lodTriangles;
 
-            if (kDebugGeometrySource) {
-                pinfo("            Read normal %f, %f, %f", normal.mData[0], normal.mData[1], normal.mData[2]);
-            }
+        viro::Node::Geometry::LOD *lod = geo->add_lod();
+        lod->set_error(error);
+        lod->set_screen_size(error > 0 ? std::min(1.0f, kLODMaxScreenError / error) : 1.0f);
 
-            if (hasNormal) {
-                data.push_back(normal.mData[0]);
-                data.push_back(normal.mData[1]);
-                data.push_back(normal.mData[2]);
+        for (int i = 0; i < lodElements.size(); i++) {
+            std::vector<uint32_t> &indices = lodElements[i];
+            if (_options.optimizeVertexCache && !indices.empty()) {
+                optimizeVertexCache(indices, numVertices);
             }
-            else {
-                data.push_back(0);
-                data.push_back(0);
-                data.push_back(0);
-            }
-
-            FbxVector4 tangent = readTangent(mesh, controlPointIndex, cornerCounter);
-            data.push_back(tangent.mData[0]);
-            data.push_back(tangent.mData[1]);
-            data.push_back(tangent.mData[2]);
-            data.push_back(tangent.mData[3]);
-
-            if (kDebugGeometrySource) {
-                pinfo("            Read tangent %f, %f, %f, %f", tangent.mData[0], tangent.mData[1], tangent.mData[2], tangent.mData[3]);
-            }
-            ++cornerCounter;
-        }
-    }
-
-    int floatsPerVertex = 12;
-    int numVertices = (uint32_t)data.size() / floatsPerVertex;
-    int stride = floatsPerVertex * sizeof(float);
-
-    passert (numPolygons * 3 * stride == data.size() * sizeof(float));
-    geo->set_data(data.data(), data.size() * sizeof(float));
-
-    pinfo("      Num vertices %d, stride %d", numVertices, stride);
-    pinfo("      VAR size %lu", data.size() * sizeof(float));
-
-    viro::Node::Geometry::Source *vertices = geo->add_source();
-    vertices->set_semantic(viro::Node_Geometry_Source_Semantic_Vertex);
-    vertices->set_vertex_count(numVertices);
-    vertices->set_float_components(true);
-    vertices->set_components_per_vertex(3);
-    vertices->set_bytes_per_component(sizeof(float));
-    vertices->set_data_offset(0);
-    vertices->set_data_stride(stride);
-
-    viro::Node::Geometry::Source *texCoords = geo->add_source();
-    texCoords->set_semantic(viro::Node_Geometry_Source_Semantic_Texcoord);
-    texCoords->set_vertex_count(numVertices);
-    texCoords->set_float_components(true);
-    texCoords->set_components_per_vertex(2);
-    texCoords->set_bytes_per_component(sizeof(float));
-    texCoords->set_data_offset(sizeof(float) * 3);
-    texCoords->set_data_stride(stride);
-
-    viro::Node::Geometry::Source *normals = geo->add_source();
-    normals->set_semantic(viro::Node_Geometry_Source_Semantic_Normal);
-    normals->set_vertex_count(numVertices);
-    normals->set_float_components(true);
-    normals->set_components_per_vertex(3);
-    normals->set_bytes_per_component(sizeof(float));
-    normals->set_data_offset(sizeof(float) * 5);
-    normals->set_data_stride(stride);
-
-    viro::Node::Geometry::Source *tangents = geo->add_source();
-    tangents->set_semantic(viro::Node_Geometry_Source_Semantic_Tangent);
-    tangents->set_vertex_count(numVertices);
-    tangents->set_float_components(true);
-    tangents->set_components_per_vertex(4);
-    tangents->set_bytes_per_component(sizeof(float));
-    tangents->set_data_offset(sizeof(float) * 8);
-    tangents->set_data_stride(stride);
-
-    /*
-     Export the elements and materials.
-     */
-    int numMaterials = node->GetMaterialCount();
-    pinfo("   Exporting materials");
-    pinfo("      Num materials %d", numMaterials);
 
-    std::vector<int> materialMapping = readMaterialToMeshMapping(mesh, numPolygons);
-    if (numMaterials > 0) {
-        for (int i = 0; i < numMaterials; i++) {
-            std::vector<int> triangles;
-
-            for (int face = 0; face < materialMapping.size(); face++) {
-                int materialIndex = materialMapping[face];
-                if (materialIndex == i) {
-                    triangles.push_back(face * 3 + 0);
-                    triangles.push_back(face * 3 + 1);
-                    triangles.push_back(face * 3 + 2);
-                }
+            viro::Node::Geometry::Element *element = lod->add_element();
+            exportElement(indices, numVertices, !_options.buildMeshlets, element);
+            if (_options.buildMeshlets) {
+                exportMeshlets(indices, meshData, element);
             }
-
-            viro::Node::Geometry::Element *element = geo->add_element();
-            element->set_data(triangles.data(), triangles.size() * sizeof(int));
-            element->set_primitive(viro::Node_Geometry_Element_Primitive_Triangle);
-            element->set_bytes_per_index(sizeof(int));
-            element->set_primitive_count((int)triangles.size() / 3);
-
-            pinfo("      Primitive count for material %d: %d", i, element->primitive_count());
-
-            FbxSurfaceMaterial *fbxMaterial = node->GetMaterial(i);
-            viro::Node::Geometry::Material *material = geo->add_material();
-
-            exportMaterial(fbxMaterial, compressTextures, material);
-        }
-    }
-    else {
-        // If there are no materials, export a default (blank) material
-        std::vector<int> triangles;
-        for (int face = 0; face < materialMapping.size(); face++) {
-            triangles.push_back(face * 3 + 0);
-            triangles.push_back(face * 3 + 1);
-            triangles.push_back(face * 3 + 2);
         }
 
-        viro::Node::Geometry::Element *element = geo->add_element();
-        element->set_data(triangles.data(), triangles.size() * sizeof(int));
-        element->set_primitive(viro::Node_Geometry_Element_Primitive_Triangle);
-        element->set_bytes_per_index(sizeof(int));
-        element->set_primitive_count((int)triangles.size() / 3);
-
-        viro::Node::Geometry::Material *material = geo->add_material();
-        material->set_transparency(1.0);
-
-        viro::Node::Geometry::Material::Visual *diffuse = material->mutable_diffuse();
-        diffuse->add_color(1.0);
-        diffuse->add_color(1.0);
-        diffuse->add_color(1.0);
-        diffuse->set_intensity(1.0);
+        pinfo("      LOD %d: %d triangles (%.1f%%), error %.5f, screen size %.3f", geo->lod_size(), lodTriangles,
+              100.0f * lodTriangles / numTriangles, error, lod->screen_size());
     }
 }
 
-// It turns out we can just use mesh->GetPolygonVertexNormal() instead of this function,
-// but keeping this here for educational purposes, on how to read normals directly from
-// a mesh.
+// Normals are read in bulk by readLayerElement() instead of this function, but keeping
+// this here for educational purposes, on how to read a single normal directly from a
+// mesh.
 FbxVector4 VROFBXExporter::readNormal(FbxMesh *mesh, int controlPointIndex, int cornerCounter) {
     if (mesh->GetElementNormalCount() < 1) {
         return {};
@@ -561,51 +2044,6 @@ FbxVector4 VROFBXExporter::readNormal(FbxMesh *mesh, int controlPointIndex, int
     return {};
 }
 
-FbxVector4 VROFBXExporter::readTangent(FbxMesh *mesh, int controlPointIndex, int cornerCounter) {
-    if(mesh->GetElementTangentCount() < 1) {
-        return {};
-    }
-
-    FbxGeometryElementTangent *tangentsLayer = mesh->GetElementTangent(0);
-
-    switch (tangentsLayer->GetMappingMode()) {
-        case FbxGeometryElement::eByControlPoint:
-            switch(tangentsLayer->GetReferenceMode()) {
-                case FbxGeometryElement::eDirect: {
-                    return tangentsLayer->GetDirectArray().GetAt(controlPointIndex);
-                }
-                case FbxGeometryElement::eIndexToDirect: {
-                    int index = tangentsLayer->GetIndexArray().GetAt(controlPointIndex);
-                    return tangentsLayer->GetDirectArray().GetAt(index);
-                }
-                default:
-                    pabort("Invalid reference mode");
-            }
-            break;
-
-        case FbxGeometryElement::eByPolygonVertex:
-            switch(tangentsLayer->GetReferenceMode()) {
-                case FbxGeometryElement::eDirect: {
-                    return tangentsLayer->GetDirectArray().GetAt(cornerCounter);
-                }
-                    break;
-                case FbxGeometryElement::eIndexToDirect: {
-                    int index = tangentsLayer->GetIndexArray().GetAt(cornerCounter);
-                    return tangentsLayer->GetDirectArray().GetAt(index);
-                }
-                    break;
-                default:
-                    pabort("Invalid reference mode");
-            }
-
-        default:
-            pabort("Invalid mapping mode");
-            break;
-    }
-
-    return {};
-}
-
 FbxAMatrix VROFBXExporter::getGeometryMatrix(FbxNode *node) {
     /*
      The geometry transform only applies to the geometry of a node, and does
@@ -667,7 +2105,8 @@ bool SortByBoneWeight(const VROBoneIndexWeight &i, const VROBoneIndexWeight &j)
 void VROFBXExporter::exportSkin(FbxNode *node,
                                 const std::vector<FbxNode *> &boneNodes,
                                 viro::Node::Skeleton *outSkeleton,
-                                viro::Node::Geometry::Skin *outSkin) {
+                                viro::Node::Geometry::Skin *outSkin,
+                                VROControlPointMetadata *outMetadata) {
     FbxMesh *mesh = node->GetMesh();
 
     /*
@@ -675,7 +2114,22 @@ void VROFBXExporter::exportSkin(FbxNode *node,
      bone). Normally only one deformer per mesh.
      */
     unsigned int numDeformers = mesh->GetDeformerCount();
-    std::map<int, std::vector<VROBoneIndexWeight>> bones;
+    int numControlPoints = mesh->GetControlPointsCount();
+
+    /*
+     The clusters are gathered first, so that their influences can be counted per
+     control point and then placed directly into a flat table (CSR): the influences
+     of control point c are influences[offsets[c]] through influences[offsets[c + 1] - 1],
+     in cluster order.
+     */
+    std::vector<std::pair<FbxCluster *, int>> boneClusters;
+
+    /*
+     For each bone, the transform from the mesh's encoded position to the bone's local
+     space in bind position (boneSpaceTransform * geometryBindingTransform). These are
+     used to measure the effect of pruning influences.
+     */
+    std::vector<FbxAMatrix> bindTransforms(boneNodes.size());
 
     for (unsigned int deformerIndex = 0; deformerIndex < numDeformers; ++deformerIndex) {
         // We only use skin deformers for skeletal animation
@@ -719,16 +2173,6 @@ void VROFBXExporter::exportSkin(FbxNode *node,
             std::string boneName = cluster->GetLink()->GetName();
             unsigned int boneIndex = findBoneIndex(cluster->GetLink(), boneNodes);
 
-            /*
-             If a model has more bones that we support, we ignore the bones that are beyond
-             our max bone index. This will likely ruin the animation, so log a warning.
-             */
-            if (boneIndex >= kMaxBones) {
-                pinfo("Warning: Viro only supports %d bones: bone %d will be discarded, animations may be skewed",
-                      kMaxBones, boneIndex);
-                continue;
-            }
-
             /*
              Sanity check: the transform matrix for each cluster's parent node should
              be the same (it's the same parent!).
@@ -762,139 +2206,277 @@ void VROFBXExporter::exportSkin(FbxNode *node,
             for (int i = 0; i < 16; i++) {
                 bt->add_value(boneSpaceTransform.Get(i / 4, i % 4));
             }
+            bindTransforms[boneIndex] = boneSpaceTransform * geometryBindingTransform;
 
-            /*
-             Associate each bone with the control points it affects.
-             */
-            unsigned int numIndices = cluster->GetControlPointIndicesCount();
-            for (unsigned int i = 0; i < numIndices; ++i) {
-                int controlPointIndex = cluster->GetControlPointIndices()[i];
-                float boneWeight = cluster->GetControlPointWeights()[i];
+            boneClusters.push_back({ cluster, (int) boneIndex });
+        }
+    }
 
-                /*
-                 Associates a control point (vertex) with a bone, and gives
-                 the bone a weight on that control point.
-                 */
-                VROBoneIndexWeight bone(boneIndex, boneWeight);
-                bones[controlPointIndex].push_back(bone);
+    /*
+     Count the influences on each control point, then associate each bone with the
+     control points it affects, giving the bone a weight on each.
+     */
+    std::vector<int> offsets(numControlPoints + 1, 0);
+    for (const std::pair<FbxCluster *, int> &boneCluster : boneClusters) {
+        const int *controlPointIndices = boneCluster.first->GetControlPointIndices();
+        int numIndices = boneCluster.first->GetControlPointIndicesCount();
+        for (int i = 0; i < numIndices; ++i) {
+            int controlPointIndex = controlPointIndices[i];
+            if (controlPointIndex >= 0 && controlPointIndex < numControlPoints) {
+                ++offsets[controlPointIndex + 1];
+            }
+        }
+    }
+    for (int c = 0; c < numControlPoints; c++) {
+        offsets[c + 1] += offsets[c];
+    }
+
+    std::vector<VROBoneIndexWeight> influences(offsets[numControlPoints], VROBoneIndexWeight(0, 0));
+    std::vector<int> next(offsets.begin(), offsets.end() - 1);
+    for (const std::pair<FbxCluster *, int> &boneCluster : boneClusters) {
+        const int *controlPointIndices = boneCluster.first->GetControlPointIndices();
+        const double *controlPointWeights = boneCluster.first->GetControlPointWeights();
+        int numIndices = boneCluster.first->GetControlPointIndicesCount();
+        for (int i = 0; i < numIndices; ++i) {
+            int controlPointIndex = controlPointIndices[i];
+            if (controlPointIndex >= 0 && controlPointIndex < numControlPoints) {
+                influences[next[controlPointIndex]++] = VROBoneIndexWeight(boneCluster.second,
+                                                                           controlPointWeights[i]);
             }
         }
     }
 
+    /*
+     Reduce each control point to the configured number of influences in the
+     fixed-width table, sorted by decreasing weight (selected with a partial sort).
+     Influences below the minimum weight are dropped first, though the largest is
+     always kept. If more remain than fit, only those of greatest weight are kept.
+     The kept weights are then renormalized. Control points with fewer influences are
+     padded with zero weights.
+     */
+    int maxInfluences = getInfluenceTier(std::max(1, std::min(_options.maxBoneInfluences, kMaxBoneInfluences)));
+    outMetadata->influences = maxInfluences;
+    outMetadata->bones.assign(numControlPoints * maxInfluences, VROBoneIndexWeight(0, 0));
+    outMetadata->hasBones.assign(numControlPoints, false);
+
+    std::vector<VROBoneIndexWeight> originalInfluences = influences;
+    std::vector<int> prunedControlPoints;
+
+    int numPointsWithBones = 0;
     int numPointsWithTooManyBones = 0;
-    for (auto &kv : bones) {
-        std::vector<VROBoneIndexWeight> &bones = kv.second;
+    int numInfluencesBelowMinimum = 0;
+    for (int c = 0; c < numControlPoints; c++) {
+        VROBoneIndexWeight *begin = influences.data() + offsets[c];
+        VROBoneIndexWeight *end = influences.data() + offsets[c + 1];
+        int numInfluences = (int) (end - begin);
+        if (numInfluences == 0) {
+            continue;
+        }
+        ++numPointsWithBones;
+
+        if (_options.minBoneWeight > 0) {
+            std::iter_swap(begin, std::max_element(begin, end, [](const VROBoneIndexWeight &a,
+                                                                  const VROBoneIndexWeight &b) {
+                return a.weight < b.weight;
+            }));
+            end = std::remove_if(begin + 1, end, [this](const VROBoneIndexWeight &bone) {
+                return bone.weight < _options.minBoneWeight;
+            });
+            numInfluencesBelowMinimum += numInfluences - (int) (end - begin);
+        }
 
-        // If there are more than kMaxBoneInfluences bones, use only those with greatest
-        // weight, and renormalize
-        if (bones.size() > kMaxBoneInfluences) {
+        int numRemaining = (int) (end - begin);
+        int numKept = std::min(numRemaining, maxInfluences);
+        std::partial_sort(begin, begin + numKept, end, SortByBoneWeight);
+
+        if (numRemaining > maxInfluences) {
             ++numPointsWithTooManyBones;
             if (kDebugBones) {
-                pinfo("Control point has %d bones", (int)bones.size());
+                pinfo("Control point has %d bones", numRemaining);
             }
+            end = begin + maxInfluences;
+        }
 
-            std::sort(bones.begin(), bones.end(), SortByBoneWeight);
-            bones.erase(bones.begin() + kMaxBoneInfluences, bones.end());
-
+        if (numKept < numInfluences) {
             float total = 0;
-            for (VROBoneIndexWeight &bone : bones) {
-                total += bone.weight;
+            for (VROBoneIndexWeight *bone = begin; bone != end; ++bone) {
+                total += bone->weight;
             }
-            for (VROBoneIndexWeight &bone : bones) {
+            for (VROBoneIndexWeight *bone = begin; total > 0 && bone != end; ++bone) {
                 if (kDebugBones) {
-                    pinfo("   Refactoring bone weight from %f to %f", bone.weight, (bone.weight / total));
+                    pinfo("   Refactoring bone weight from %f to %f", bone->weight, (bone->weight / total));
                 }
-                bone.weight = (bone.weight / total);
+                bone->weight = (bone->weight / total);
             }
+            prunedControlPoints.push_back(c);
         }
 
-        // Add extra dummy bones to each control point that has fewer than
-        // kMaxBoneInfluences
-        for (size_t i = bones.size(); i < kMaxBoneInfluences; ++i) {
-            bones.push_back({0, 0});
-        }
+        std::copy(begin, end, outMetadata->bones.begin() + c * maxInfluences);
+        outMetadata->hasBones[c] = true;
     }
 
-    pinfo("      Found bones for %lu control points", bones.size());
+    pinfo("      Found bones for %d control points", numPointsWithBones);
+    if (numInfluencesBelowMinimum > 0) {
+        pinfo("      Pruned %d influences with weight below %f", numInfluencesBelowMinimum, _options.minBoneWeight);
+    }
     if (numPointsWithTooManyBones > 0) {
         pinfo("************************");
-        pinfo("WARN: Found %d control points with too many bone influences. Max 4 supported!", numPointsWithTooManyBones);
+        pinfo("WARN: Found %d control points with too many bone influences. Max %d supported!", numPointsWithTooManyBones,
+              maxInfluences);
         pinfo("************************");
     }
+    if (!prunedControlPoints.empty()) {
+        measurePruningDisplacement(node, boneNodes, bindTransforms, offsets, originalInfluences,
+                                   prunedControlPoints, *outMetadata);
+    }
+}
+
+/*
+ Position of the control point when skinned with the given influences, each bone
+ transformed by the given skinning transforms.
+ */
+static FbxVector4 skinControlPoint(const FbxVector4 &point, const VROBoneIndexWeight *influences, int numInfluences,
+                                   const std::vector<FbxAMatrix> &skinningTransforms) {
+    FbxVector4 skinned(0, 0, 0, 0);
+    for (int i = 0; i < numInfluences; i++) {
+        skinned += skinningTransforms[influences[i].index].MultT(point) * influences[i].weight;
+    }
+    return skinned;
+}
+
+void VROFBXExporter::measurePruningDisplacement(FbxNode *node, const std::vector<FbxNode *> &boneNodes,
+                                                const std::vector<FbxAMatrix> &bindTransforms,
+                                                const std::vector<int> &offsets,
+                                                const std::vector<VROBoneIndexWeight> &originalInfluences,
+                                                const std::vector<int> &prunedControlPoints,
+                                                const VROControlPointMetadata &metadata) {
+    FbxMesh *mesh = node->GetMesh();
+    const FbxVector4 *controlPoints = mesh->GetControlPoints();
 
     /*
-     Export the geometry sources for the skin. Note this must be in the same order we
-     follow in exportGeometry.
+     The largest distance, over the pruned control points, between the position skinned
+     with all of the original influences and with the pruned influences, in the given
+     pose. Each bone's skinning transform takes the mesh from its encoded position to
+     its posed position in model space. The bind pose itself is not measured: when the
+     source weights sum to one, renormalization leaves each control point in place.
      */
-    std::vector<int> boneIndicesData;
-    std::vector<float> boneWeightsData;
-    std::set<int> controlPointsNoBones;
+    auto measure = [&](const std::vector<FbxAMatrix> &skinningTransforms) {
+        double maxDisplacement = 0;
+        for (int c : prunedControlPoints) {
+            FbxVector4 point = controlPoints[c];
+            point.mData[3] = 1;
+
+            FbxVector4 original = skinControlPoint(point, &originalInfluences[offsets[c]], offsets[c + 1] - offsets[c],
+                                                   skinningTransforms);
+            FbxVector4 pruned = skinControlPoint(point, metadata.getBones(c), metadata.influences, skinningTransforms);
+            FbxVector4 difference = original - pruned;
+            difference.mData[3] = 0;
+            maxDisplacement = std::max(maxDisplacement, difference.Length());
+        }
+        return maxDisplacement;
+    };
 
-    int numPolygons = mesh->GetPolygonCount();
-    for (unsigned int i = 0; i < numPolygons; i++) {
-        // We only support triangles
-        int polygonSize = mesh->GetPolygonSize(i);
-        passert (polygonSize == 3);
-
-        for (int j = 0; j < polygonSize; j++) {
-            int controlPointIndex = mesh->GetPolygonVertex(i, j);
-
-            auto it = bones.find(controlPointIndex);
-            if (it == bones.end()) {
-                // This is just so we only log the message once per control point instead
-                // of once per polygon
-                if (controlPointsNoBones.find(controlPointIndex) == controlPointsNoBones.end()) {
-                    controlPointsNoBones.insert(controlPointIndex);
-                    pinfo("         No bones found for control point %d", controlPointIndex);
-                }
+    pinfo("      Pruned influences of %d control points", (int) prunedControlPoints.size());
 
-                for (int b = 0; b < kMaxBoneInfluences; b++) {
-                    boneIndicesData.push_back(0);
-                    boneWeightsData.push_back(0);
-                }
-            }
-            else {
-                std::vector<VROBoneIndexWeight> &boneData = it->second;
-                passert (boneData.size() == kMaxBoneInfluences);
+    /*
+     Sample frames from each animation, posing each bone as in exportSkeletalAnimations.
+     */
+    std::vector<FbxAMatrix> skinningTransforms(boneNodes.size());
+    FbxScene *scene = node->GetScene();
+    FbxAnimEvaluator *evaluator = scene->GetAnimationEvaluator();
+    int numStacks = scene->GetSrcObjectCount(FbxCriteria::ObjectType(FbxAnimStack::ClassId));
+    for (int s = 0; s < numStacks; s++) {
+        FbxAnimStack *animStack = scene->GetSrcObject<FbxAnimStack>(s);
+        FbxTakeInfo *take = scene->GetTakeInfo(animStack->GetName());
+        if (take == nullptr) {
+            continue;
+        }
+        scene->SetCurrentAnimationStack(animStack);
 
-                if (kDebugGeometrySource) {
-                    pinfo("      Control point %d", controlPointIndex);
-                }
-                for (VROBoneIndexWeight &bone : boneData) {
-                    boneIndicesData.push_back(bone.index);
-                    boneWeightsData.push_back(bone.weight);
+        FbxLongLong startFrame = take->mLocalTimeSpan.GetStart().GetFrameCount(FbxTime::eFrames30);
+        FbxLongLong endFrame = take->mLocalTimeSpan.GetStop().GetFrameCount(FbxTime::eFrames30);
 
-                    if (kDebugGeometrySource) {
-                        pinfo("         bone-index: %d", bone.index);
-                        pinfo("         bone-weight: %f", bone.weight);
-                    }
-                }
+        double maxDisplacement = 0;
+        for (int sample = 0; sample < kPruningErrorSamples; sample++) {
+            FbxTime frameTime;
+            frameTime.SetFrame(startFrame + (endFrame - startFrame) * sample / kPruningErrorSamples, FbxTime::eFrames30);
+
+            for (int b = 0; b < boneNodes.size(); b++) {
+                skinningTransforms[b] = evaluator->GetNodeGlobalTransform(boneNodes[b], frameTime) * bindTransforms[b];
+            }
+            maxDisplacement = std::max(maxDisplacement, measure(skinningTransforms));
+        }
+        pinfo("      Max displacement over %d frames of animation [%s] %f", kPruningErrorSamples,
+              animStack->GetName(), maxDisplacement);
+    }
+}
+
+void VROFBXExporter::exportSkinSources(const VROMeshData &meshData, viro::Node::Geometry::Skin *outSkin) {
+    /*
+     Export the geometry sources for the skin. These are read from the same vertices as
+     the geometry sources, so they follow the same (welded) order.
+     */
+    int intsPerVertex = meshData.boneInfluences;
+    int numVertices = meshData.getVertexCount();
+    passert (meshData.boneIndices.size() == numVertices * intsPerVertex);
+
+    if (kDebugGeometrySource) {
+        for (int v = 0; v < numVertices; v++) {
+            pinfo("      Vertex %d", v);
+            for (int b = 0; b < intsPerVertex; b++) {
+                pinfo("         bone-index: %d", meshData.boneIndices[v * intsPerVertex + b]);
+                pinfo("         bone-weight: %f", meshData.boneWeights[v * intsPerVertex + b]);
             }
         }
     }
 
-    int intsPerVertex = kMaxBoneInfluences;
-    int numVertices = (uint32_t)boneIndicesData.size() / intsPerVertex;
+    /*
+     Compact skins use the smallest integer that holds every bone index (palette
+     indices, if the skin was partitioned), and normalized integer weights.
+     */
+    int indexBytes = sizeof(int);
+    int weightBytes = sizeof(float);
+    if (_options.compactSkin) {
+        int maxIndex = 0;
+        for (int index : meshData.boneIndices) {
+            maxIndex = std::max(maxIndex, index);
+        }
+        indexBytes = maxIndex <= UINT8_MAX ? sizeof(uint8_t) : (maxIndex <= UINT16_MAX ? sizeof(uint16_t) : sizeof(int));
+        weightBytes = _options.skinWeightBytes;
+        pinfo("      Writing bone indices with %d bytes and weights with %d bytes per component", indexBytes, weightBytes);
+    }
 
     viro::Node::Geometry::Source *boneIndices = outSkin->mutable_bone_indices();
     boneIndices->set_semantic(viro::Node_Geometry_Source_Semantic_BoneIndices);
     boneIndices->set_vertex_count(numVertices);
     boneIndices->set_float_components(false);
-    boneIndices->set_components_per_vertex(kMaxBoneInfluences);
-    boneIndices->set_bytes_per_component(sizeof(int));
+    boneIndices->set_components_per_vertex(intsPerVertex);
+    boneIndices->set_bytes_per_component(indexBytes);
     boneIndices->set_data_offset(0);
-    boneIndices->set_data_stride(sizeof(int) * kMaxBoneInfluences);
-    boneIndices->set_data(boneIndicesData.data(), boneIndicesData.size() * sizeof(int));
+    boneIndices->set_data_stride(indexBytes * intsPerVertex);
+    if (indexBytes == sizeof(int)) {
+        boneIndices->set_data(meshData.boneIndices.data(), meshData.boneIndices.size() * sizeof(int));
+    }
+    else {
+        boneIndices->set_data(packBoneIndices(meshData.boneIndices.data(), (int) meshData.boneIndices.size(), indexBytes));
+    }
 
     viro::Node::Geometry::Source *boneWeights = outSkin->mutable_bone_weights();
     boneWeights->set_semantic(viro::Node_Geometry_Source_Semantic_BoneWeights);
     boneWeights->set_vertex_count(numVertices);
-    boneWeights->set_float_components(true);
-    boneWeights->set_components_per_vertex(kMaxBoneInfluences);
-    boneWeights->set_bytes_per_component(sizeof(float));
+    boneWeights->set_components_per_vertex(intsPerVertex);
+    boneWeights->set_bytes_per_component(weightBytes);
     boneWeights->set_data_offset(0);
-    boneWeights->set_data_stride(sizeof(float) * kMaxBoneInfluences);
-    boneWeights->set_data(boneWeightsData.data(), boneWeightsData.size() * sizeof(float));
+    boneWeights->set_data_stride(weightBytes * intsPerVertex);
+    if (weightBytes == sizeof(float)) {
+        boneWeights->set_float_components(true);
+        boneWeights->set_data(meshData.boneWeights.data(), meshData.boneWeights.size() * sizeof(float));
+    }
+    else {
+        boneWeights->set_float_components(false);
+        boneWeights->set_normalization(viro::Node_Geometry_Source_Normalization_UNorm);
+        boneWeights->set_data(quantizeBoneWeights(meshData.boneWeights.data(), numVertices, intsPerVertex, weightBytes));
+    }
 }
 
 void VROFBXExporter::exportSkeletalAnimations(FbxScene *scene, FbxNode *node, const std::vector<FbxNode *> &boneNodes,
@@ -1017,6 +2599,110 @@ void VROFBXExporter::exportSkeletalAnimations(FbxScene *scene, FbxNode *node, co
     }
 }
 
+#pragma mark - Dual Quaternions
+
+/*
+ Returns true if the transform is a rotation and translation only: no scale, shear,
+ or reflection. Empty matrices (bones the skin does not bind) are trivially rigid.
+ */
+static bool isRigidTransform(const viro::Node::Matrix &matrix) {
+    if (matrix.value_size() == 0) {
+        return true;
+    }
+    if (matrix.value_size() != 16) {
+        return false;
+    }
+
+    glm::mat3 basis(glm::make_mat4(matrix.value().data()));
+    for (int i = 0; i < 3; i++) {
+        if (fabs(glm::length(basis[i]) - 1) > kRigidTolerance ||
+            fabs(glm::dot(basis[i], basis[(i + 1) % 3])) > kRigidTolerance) {
+            return false;
+        }
+    }
+    return glm::determinant(basis) > 0;
+}
+
+/*
+ Encode the rigid transform as a unit dual quaternion: the rotation q followed by
+ the dual part t * q / 2, where t is the translation as a pure quaternion. The
+ rotation is kept in the hemisphere w >= 0.
+ */
+static void encodeDualQuaternion(const viro::Node::Matrix &matrix, viro::Node::DualQuaternion *outDualQuaternion) {
+    if (matrix.value_size() == 0) {
+        return;
+    }
+
+    glm::mat4 transform = glm::make_mat4(matrix.value().data());
+    glm::quat real = glm::normalize(glm::quat_cast(glm::mat3(transform)));
+    if (real.w < 0) {
+        real = -real;
+    }
+    glm::vec3 translation(transform[3]);
+    glm::quat dual = (glm::quat(0, translation.x, translation.y, translation.z) * real) * 0.5f;
+
+    const float values[8] = { real.x, real.y, real.z, real.w, dual.x, dual.y, dual.z, dual.w };
+    for (float value : values) {
+        outDualQuaternion->add_value(value);
+    }
+}
+
+void VROFBXExporter::exportDualQuaternions(viro::Node *outNode) {
+    viro::Node::Geometry::Skin *skin = outNode->mutable_geometry()->mutable_skin();
+
+    /*
+     Dual quaternions represent only rigid transforms, and the renderer composes
+     each frame's transform with the bind transform, so the whole skin falls back to
+     matrices if any of its animations has scaling, or any transform is not rigid.
+     */
+    bool rigid = true;
+    for (const viro::Node::Matrix &bindTransform : skin->bind_transform()) {
+        rigid &= isRigidTransform(bindTransform);
+    }
+    if (!rigid) {
+        pinfo("      Skin bind transforms have scaling, keeping matrices");
+        return;
+    }
+
+    for (const viro::Node::SkeletalAnimation &animation : outNode->skeletal_animation()) {
+        if (animation.has_scaling()) {
+            pinfo("      Animation [%s] has scaling, keeping matrices", animation.name().c_str());
+            return;
+        }
+        for (const viro::Node::SkeletalAnimation::Frame &frame : animation.frame()) {
+            for (const viro::Node::Matrix &transform : frame.transform()) {
+                rigid &= isRigidTransform(transform);
+            }
+            for (const viro::Node::Matrix &transform : frame.local_transform()) {
+                rigid &= isRigidTransform(transform);
+            }
+        }
+        if (!rigid) {
+            pinfo("      Animation [%s] has non-rigid transforms, keeping matrices", animation.name().c_str());
+            return;
+        }
+    }
+
+    for (const viro::Node::Matrix &bindTransform : skin->bind_transform()) {
+        encodeDualQuaternion(bindTransform, skin->add_bind_dual_quaternion());
+    }
+    skin->clear_bind_transform();
+
+    for (viro::Node::SkeletalAnimation &animation : *outNode->mutable_skeletal_animation()) {
+        for (viro::Node::SkeletalAnimation::Frame &frame : *animation.mutable_frame()) {
+            for (const viro::Node::Matrix &transform : frame.transform()) {
+                encodeDualQuaternion(transform, frame.add_dual_quaternion());
+            }
+            for (const viro::Node::Matrix &transform : frame.local_transform()) {
+                encodeDualQuaternion(transform, frame.add_local_dual_quaternion());
+            }
+            frame.clear_transform();
+            frame.clear_local_transform();
+        }
+    }
+    pinfo("      Wrote skin and %d animations as dual quaternions", outNode->skeletal_animation_size());
+}
+
 void VROFBXExporter::exportBlendShapeAnimations(FbxScene *scene, FbxNode *node, viro::Node *outNode) {
     FbxMesh *mesh = node->GetMesh();
 
@@ -1707,6 +3393,20 @@ viro::Node_Geometry_Material_Visual_WrapMode VROFBXExporter::convert(FbxTexture:
     }
 }
 
+bool VROFBXExporter::isTextured(const viro::Node::Geometry::Material &material) {
+    const viro::Node::Geometry::Material::Visual *visuals[] = {
+        &material.diffuse(), &material.specular(), &material.normal(), &material.reflective(),
+        &material.emission(), &material.multiply(), &material.roughness(), &material.metalness(),
+        &material.ao()
+    };
+    for (const viro::Node::Geometry::Material::Visual *visual : visuals) {
+        if (!visual->texture().empty()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool VROFBXExporter::compressTexture(std::string textureName) {
     // Check if the texture exists in the .fbm folder that the importer
     // automatically creates when we export an FBX with embedded textures
@@ -13,15 +13,30 @@
 #include "fbxsdk.h"
 #include <vector>
 #include <map>
+#include <memory>
 #include "Nodes.pb.h"
+#include "VROMeshOptimizer.h"
+#include "VROVertexLayout.h"
+#include "VROThreadPool.h"
+#include "VROMeshlet.h"
+#include "VROMeshSimplifier.h"
+#include "VROBonePartition.h"
+#include "VROVisibility.h"
+#include "VROMeshCodec.h"
+#include "VROTangentSpace.h"
+#include "VROInfluenceTier.h"
+
+class VROMeshData;
 
 /*
- Maximum number of bones that can influence each vertex.
+ Default and largest number of bones that can influence each vertex.
  */
-static const int kMaxBoneInfluences = 4;
+static const int kDefaultBoneInfluences = 4;
+static const int kMaxBoneInfluences = 8;
 
 /*
- Maximum number of bones in a node. Keep in sync with:
+ Maximum number of bones in a palette; skins with more bones are split into bone
+ partitions. Keep in sync with:
 
  ViroRenderer::VROBoneUBO.h and
  ViroRenderer::skinning_vsh.glsl
@@ -40,10 +55,253 @@ public:
 class VROControlPointMetadata {
 public:
     /*
-     Maps control point indices to each bone mapped to that
-     control point.
+     The bone influences of each control point, in a flat table indexed by control
+     point: control point c's influences begin at bones[c * influences], sorted by
+     decreasing weight. Control points influenced by fewer bones are padded with zero
+     weights; hasBones is false for those no bone influences.
      */
-    std::map<int, std::vector<VROBoneIndexWeight>> bones;
+    int influences;
+    std::vector<VROBoneIndexWeight> bones;
+    std::vector<bool> hasBones;
+
+    VROControlPointMetadata() :
+        influences(kDefaultBoneInfluences) {}
+
+    int getControlPointCount() const {
+        return (int) hasBones.size();
+    }
+
+    /*
+     Returns the influences of the given control point, or null if it has none.
+     */
+    const VROBoneIndexWeight *getBones(int controlPoint) const {
+        if (controlPoint < 0 || controlPoint >= hasBones.size() || !hasBones[controlPoint]) {
+            return nullptr;
+        }
+        return &bones[controlPoint * influences];
+    }
+};
+
+/*
+ Default triangle count above which meshes are read in parallel.
+ */
+static const int kDefaultParallelTriangleThreshold = 250000;
+
+/*
+ Screen-space error, as a fraction of the viewport height, that a LOD may introduce
+ before the renderer switches to the next more detailed level: one pixel at 1080p.
+ */
+static const float kLODMaxScreenError = 1.0f / 1080.0f;
+
+/*
+ Options that control how geometry is processed during export.
+ */
+class VROFBXExportOptions {
+public:
+    /*
+     If true, vertices that are identical across every attribute are merged so that
+     triangles share them through the index buffer. If false, each triangle corner
+     receives its own vertex.
+     */
+    bool weldVertices;
+
+    /*
+     If true, collapsed, zero-area, and duplicate triangles are removed after welding,
+     along with any vertices they alone referenced. Opposite-winding duplicates are
+     removed too for materials with cull mode None.
+     */
+    bool cleanupTriangles;
+
+    /*
+     If true, the triangles of each element are reordered for post-transform vertex
+     cache locality, and the vertices are then reordered into first-use order.
+     */
+    bool optimizeVertexCache;
+
+    /*
+     If true, the triangles of each element are additionally sorted into clusters that
+     draw outward-facing surfaces first, to reduce overdraw. The threshold is the factor
+     by which the vertex cache miss ratio may grow in exchange (see optimizeOverdraw).
+     */
+    bool optimizeOverdraw;
+    float overdrawThreshold;
+
+    /*
+     If true, positions are stored as 16-bit normalized integers over the mesh's
+     bounding box, and texture coordinates as 16-bit normalized integers or half
+     floats. The tolerances bound the error introduced: the position tolerance is
+     relative to the largest extent of the bounding box, and the UV tolerance is in
+     UV units. Attributes that cannot meet their tolerance remain 32-bit floats.
+     */
+    bool quantizeVertices;
+    float quantizeTolerance;
+    float quantizeUVTolerance;
+
+    /*
+     If true, the normal and tangent of each vertex are replaced by a single QTangent
+     source: a quaternion stored as four snorm16 components (see encodeQTangents).
+     */
+    bool encodeQTangents;
+
+    /*
+     If true, the skin's bone indices are written as 8-bit unsigned integers (16-bit if
+     any index exceeds 255), and its bone weights as unsigned normalized integers of
+     skinWeightBytes bytes (1 or 2), quantized so that each vertex's weights keep their
+     sum exactly. Otherwise both are written as 32-bit values.
+     */
+    bool compactSkin;
+    int skinWeightBytes;
+
+    /*
+     Number of bones that can influence each vertex, rounded up to 1, 2, 4, or 8.
+     Vertices influenced by more bones keep those of greatest weight.
+     */
+    int maxBoneInfluences;
+
+    /*
+     Bone influences with less than this weight are dropped before the strongest
+     influences are selected, though each vertex keeps at least one. The remaining
+     weights are renormalized, and the displacement this causes is reported.
+     */
+    float minBoneWeight;
+
+    /*
+     If true, the vertices of each skinned geometry are sorted into tiers by the
+     number of bones that influence them (1, 2, 4, or 8), which are recorded in the
+     skin, and the skin's influences per vertex are reduced to its highest tier.
+     */
+    bool boneInfluenceTiers;
+
+    /*
+     If true, the skin's bind transforms and its animations' bone transforms are
+     written as dual quaternions (8 floats) instead of matrices (16 floats). Skins whose
+     bind transforms or animations have scaling are still written as matrices.
+     */
+    bool dualQuaternionSkinning;
+
+    /*
+     If true, positions are written to their own tightly packed buffer (the position
+     source's data) and the remaining attributes are interleaved in the geometry's
+     data. Depth-only and shadow passes then fetch positions alone.
+     */
+    bool separatePositions;
+
+    /*
+     If true, vertex and index data are written with the mesh codecs in VROMeshCodec,
+     each blob flagged with its data_encoding. Blobs that would not shrink are left raw.
+     */
+    bool encodeMeshData;
+
+    /*
+     If true, each geometry only exports the vertex attributes its materials use: UVs
+     only if a material is textured, normals only if a material is lit, and tangents
+     only if a material has a normal map. If false, every attribute is exported.
+     */
+    bool pruneVertexAttributes;
+
+    /*
+     Meshes with at least this many triangles are read on a pool of numThreads
+     threads (0 for one per core). The output is identical to the serial read. A
+     threshold of 0 disables parallel reading.
+     */
+    int parallelTriangleThreshold;
+    int numThreads;
+
+    /*
+     If true, each element is split into meshlets of at most kMeshletMaxVertices
+     vertices and kMeshletMaxTriangles triangles, each covering a contiguous range of
+     the element's (optimized) triangles, with a bounding sphere and normal cone for
+     cluster culling.
+     */
+    bool buildMeshlets;
+
+    /*
+     For each ratio, static (unskinned) geometry receives a LOD with that fraction of
+     its triangles, simplified by quadric edge collapse (see simplifyMesh). Levels stop
+     early where the simplification would exceed lodMaxError, relative to the size of
+     the geometry. Each level's screen size is derived from the error it reached.
+     */
+    std::vector<float> lodRatios;
+    float lodMaxError;
+
+    /*
+     If true, static geometry is written in progressive mesh order (see
+     buildProgressiveMesh), simplified down to lodMaxError, with the collapse parent
+     of each vertex and the triangle count of each element at a set of levels. A
+     renderer can then draw or stream any prefix of the data as a coarser mesh.
+     */
+    bool progressiveMesh;
+
+    /*
+     If true, each element is converted to a triangle strip, which is kept only if it
+     has fewer indices than the optimized triangle list. Strips are joined with
+     degenerate triangles, or with a restart index if stripPrimitiveRestart is true.
+     Elements with meshlets or progressive levels remain triangle lists, since those
+     address triangles by their position in the list.
+     */
+    bool stripifyElements;
+    bool stripPrimitiveRestart;
+
+    /*
+     If true, the static children of each node (subtrees with no keyframe animation,
+     skin, or other deformer) are merged into a single batch node. Their meshes are
+     transformed into the space of the parent node, and merged into one geometry with
+     one element per distinct material.
+     */
+    bool batchStaticMeshes;
+
+    /*
+     If true, meshes that are shared between nodes, or that have identical content
+     and materials, are exported once into the root node's shared geometries and
+     referenced by index. Sibling leaf nodes that share a geometry are collapsed
+     into one node with a list of instance transforms.
+     */
+    bool instanceGeometry;
+
+    /*
+     If true, triangles of static geometry that are hidden inside the scene are
+     removed. Rays are cast at each triangle of the whole scene (every static mesh, in
+     world space) from outside its bounds, visibilitySamples per triangle, and
+     triangles that no ray reaches unobstructed are dropped. Triangles with transparent
+     or alpha tested materials are kept if visible, but do not occlude. Animated and
+     skinned geometry neither occludes nor is removed. The result is deterministic for
+     a given seed.
+     */
+    bool removeHiddenGeometry;
+    int visibilitySamples;
+    uint32_t visibilitySeed;
+
+    VROFBXExportOptions() :
+        weldVertices(true),
+        cleanupTriangles(true),
+        optimizeVertexCache(true),
+        optimizeOverdraw(false),
+        overdrawThreshold(kDefaultOverdrawThreshold),
+        quantizeVertices(false),
+        quantizeTolerance(kDefaultQuantizeTolerance),
+        quantizeUVTolerance(kDefaultQuantizeUVTolerance),
+        encodeQTangents(false),
+        compactSkin(false),
+        skinWeightBytes(1),
+        maxBoneInfluences(kDefaultBoneInfluences),
+        minBoneWeight(0),
+        boneInfluenceTiers(false),
+        dualQuaternionSkinning(false),
+        separatePositions(false),
+        encodeMeshData(false),
+        pruneVertexAttributes(true),
+        parallelTriangleThreshold(kDefaultParallelTriangleThreshold),
+        numThreads(0),
+        buildMeshlets(false),
+        lodMaxError(kDefaultSimplifyMaxError),
+        progressiveMesh(false),
+        stripifyElements(false),
+        stripPrimitiveRestart(false),
+        batchStaticMeshes(false),
+        instanceGeometry(false),
+        removeHiddenGeometry(false),
+        visibilitySamples(kDefaultVisibilitySamples),
+        visibilitySeed(0) {}
 };
 
 class VROFBXExporter {
@@ -53,7 +311,8 @@ public:
     VROFBXExporter();
     virtual ~VROFBXExporter();
 
-    void exportFBX(std::string fbxPath, std::string protoPath, bool compressTextures);
+    void exportFBX(std::string fbxPath, std::string protoPath, bool compressTextures,
+                   VROFBXExportOptions options = VROFBXExportOptions());
     void debugPrint(std::string fbxPath);
 
 private:
@@ -66,18 +325,82 @@ private:
      */
     std::string _fbxPath;
 
+    /*
+     The options for the export currently in progress.
+     */
+    VROFBXExportOptions _options;
+
+    /*
+     Worker threads used to process large meshes, created on first use.
+     */
+    std::unique_ptr<VROThreadPool> _threadPool;
+    VROThreadPool *getThreadPool();
+
+    /*
+     The thread pool to use for a mesh of the given size, or null if it is too small
+     to be worth processing in parallel.
+     */
+    VROThreadPool *getGeometryThreadPool(int numTriangles);
+
+    /*
+     The root node of the export in progress, which holds the shared geometries.
+     */
+    viro::Node *_rootNode;
+
+    /*
+     For each node whose geometry is instanced, its instance group. Each group is
+     exported on first use; _sharedGeometryIndices holds the index of each group's
+     shared geometry in the root node, or -1 if it has not been exported yet.
+     */
+    std::map<FbxNode *, int> _geometryInstances;
+    std::vector<int> _sharedGeometryIndices;
+
+    /*
+     For each static mesh node, whether each of its triangles is visible from outside
+     the scene. Hidden triangles are dropped when the node's geometry is read.
+     */
+    std::map<FbxNode *, std::vector<bool>> _visibleTriangles;
+
 #pragma mark - Export Methods
 
     void exportNode(FbxScene *scene, FbxNode *node, int depth, bool compressTextures,
                     const std::vector<FbxNode *> &boneNodes, viro::Node::Skeleton *outSkeleton, viro::Node *outNode);
-    void exportGeometry(FbxNode *node, int depth, bool compressTextures, viro::Node::Geometry *geo);
+    void exportSubnodes(FbxScene *scene, FbxNode *node, int depth, bool compressTextures,
+                        const std::vector<FbxNode *> &boneNodes, viro::Node::Skeleton *outSkeleton, viro::Node *outNode);
+    void exportStaticBatch(FbxNode *parent, const std::vector<FbxNode *> &nodes, bool compressTextures,
+                           viro::Node *outNode);
+    void exportGeometry(FbxNode *node, int depth, bool compressTextures,
+                        const VROControlPointMetadata *skinMetadata, viro::Node::Geometry *geo);
+    void exportGeometryInstance(FbxNode *node, int depth, bool compressTextures,
+                                viro::Node::GeometryInstance *outInstance);
+    void exportInstanceGroup(const std::vector<FbxNode *> &nodes, int depth, bool compressTextures,
+                             viro::Node *outNode);
+    void readGeometry(FbxNode *node, bool compressTextures, const VROControlPointMetadata *skinMetadata,
+                      viro::Node::Geometry *geo, VROMeshData *outMeshData);
+    void exportMeshData(VROMeshData &meshData, bool skinned, viro::Node::Geometry *geo);
+    void encodeGeometryData(viro::Node::Geometry *geo);
+    void exportVertices(const VROMeshData &meshData, viro::Node::Geometry *geo);
+    void exportElement(const std::vector<uint32_t> &indices, int numVertices, bool allowStrip,
+                       viro::Node::Geometry::Element *element);
+    void exportMeshlets(const std::vector<uint32_t> &indices, const VROMeshData &meshData,
+                        viro::Node::Geometry::Element *element);
+    void exportLODs(const VROMeshData &meshData, viro::Node::Geometry *geo);
     void exportMaterial(FbxSurfaceMaterial *inMaterial, bool compressTextures, viro::Node::Geometry::Material *outMaterial);
     void exportHardwareMaterial(FbxSurfaceMaterial *inMaterial, const FbxImplementation *implementation,
                                 viro::Node::Geometry::Material *outMaterial);
     void exportSkeleton(FbxNode *rootNode, std::vector<FbxNode *> *outBoneNodes, viro::Node::Skeleton *outSkeleton);
     void exportSkeletonRecursive(FbxNode *node, int depth, int index, int parentIndex, std::vector<FbxNode *> *outBoneNodes, viro::Node::Skeleton *outSkeleton);
-    void exportSkin(FbxNode *node, const std::vector<FbxNode *> &boneNodes, viro::Node::Skeleton *outSkeleton, viro::Node::Geometry::Skin *outSkin);
+    void exportSkin(FbxNode *node, const std::vector<FbxNode *> &boneNodes, viro::Node::Skeleton *outSkeleton,
+                    viro::Node::Geometry::Skin *outSkin, VROControlPointMetadata *outMetadata);
+    void measurePruningDisplacement(FbxNode *node, const std::vector<FbxNode *> &boneNodes,
+                                    const std::vector<FbxAMatrix> &bindTransforms,
+                                    const std::vector<int> &offsets,
+                                    const std::vector<VROBoneIndexWeight> &originalInfluences,
+                                    const std::vector<int> &prunedControlPoints,
+                                    const VROControlPointMetadata &metadata);
+    void exportSkinSources(const VROMeshData &meshData, viro::Node::Geometry::Skin *outSkin);
 
+    void exportDualQuaternions(viro::Node *outNode);
     void exportKeyframeAnimations(FbxScene *scene, FbxNode *node, viro::Node *outNode);
     void exportSampledKeyframeAnimations(FbxScene *scene, FbxNode *node, viro::Node *outNode);
     void exportSkeletalAnimations(FbxScene *scene, FbxNode *node, const std::vector<FbxNode *> &boneNodes,
@@ -87,13 +410,25 @@ private:
 #pragma mark - Export Helpers
 
     FbxVector4 readNormal(FbxMesh *mesh, int controlPointIndex, int cornerCounter);
-    FbxVector4 readTangent(FbxMesh *mesh, int controlPointIndex, int cornerCounter);
     std::vector<int> readMaterialToMeshMapping(FbxMesh *mesh, int numPolygons);
     unsigned int findBoneIndex(FbxNode *node, const std::vector<FbxNode *> &boneNodes);
     bool isExportableNode(FbxNode *node);
+    bool isAnimated(FbxScene *scene, FbxNode *node);
+    void findGeometryInstances(FbxNode *rootNode);
+    void findHiddenTriangles(FbxScene *scene, FbxNode *rootNode);
+    void collectVisibilityMeshes(FbxScene *scene, FbxNode *node, const FbxAMatrix &parentTransform,
+                                 std::vector<std::pair<FbxNode *, FbxAMatrix>> *outMeshes);
+    bool isOpaqueMaterial(FbxSurfaceMaterial *material);
+    bool hasAlphaChannel(FbxFileTexture *texture);
+    void collectInstanceCandidates(FbxNode *node, std::vector<FbxNode *> *outNodes);
+    bool isInstanceLeaf(FbxScene *scene, FbxNode *node);
+    bool isStaticSubtree(FbxScene *scene, FbxNode *node);
+    void collectStaticMeshes(FbxNode *node, const FbxAMatrix &parentTransform,
+                             std::vector<std::pair<FbxNode *, FbxAMatrix>> *outMeshes);
     FbxAMatrix getGeometryMatrix(FbxNode *node);
 
     viro::Node_Geometry_Material_Visual_WrapMode convert(FbxTexture::EWrapMode wrapMode);
+    bool isTextured(const viro::Node::Geometry::Material &material);
 
 #pragma mark - Texture Compression
 
@@ -0,0 +1,77 @@
+//
+//  VROInfluenceTier.cpp
+//  ViroFBX
+//
+//  Copyright © 2017 Viro. All rights reserved.
+//
+
+#include "VROInfluenceTier.h"
+#include "VROMeshData.h"
+#include "VROLog.h"
+#include <algorithm>
+
+static const int kInfluenceTiers[] = { 1, 2, 4, 8 };
+static const int kNumInfluenceTiers = sizeof(kInfluenceTiers) / sizeof(kInfluenceTiers[0]);
+
+int getInfluenceTier(int numInfluences) {
+    for (int tier : kInfluenceTiers) {
+        if (numInfluences <= tier) {
+            return tier;
+        }
+    }
+    pabort("Vertex has %d bone influences, more than the largest tier", numInfluences);
+    return kInfluenceTiers[kNumInfluenceTiers - 1];
+}
+
+std::vector<VROInfluenceTier> sortByInfluenceTier(VROMeshData *mesh) {
+    passert (mesh->boneInfluences > 0);
+
+    int numVertices = mesh->getVertexCount();
+    int influences = mesh->boneInfluences;
+
+    /*
+     Classify each vertex by the index of its tier, counting the vertices in each.
+     Zero-weight influences trail the others, so the count is the position of the
+     last non-zero weight.
+     */
+    std::vector<int> vertexTiers(numVertices);
+    std::vector<int> counts(kNumInfluenceTiers, 0);
+    for (int v = 0; v < numVertices; v++) {
+        int numInfluences = 0;
+        for (int b = 0; b < influences; b++) {
+            if (mesh->boneWeights[v * influences + b] != 0) {
+                numInfluences = b + 1;
+            }
+        }
+
+        int tier = getInfluenceTier(numInfluences);
+        int t = (int) (std::find(kInfluenceTiers, kInfluenceTiers + kNumInfluenceTiers, tier) - kInfluenceTiers);
+        vertexTiers[v] = t;
+        counts[t]++;
+    }
+
+    /*
+     Stable counting sort of the vertices by tier.
+     */
+    std::vector<VROInfluenceTier> tiers;
+    std::vector<int> next(kNumInfluenceTiers, 0);
+    int offset = 0;
+    for (int t = 0; t < kNumInfluenceTiers; t++) {
+        next[t] = offset;
+        if (counts[t] > 0) {
+            tiers.push_back(VROInfluenceTier(kInfluenceTiers[t], offset, counts[t]));
+        }
+        offset += counts[t];
+    }
+
+    std::vector<uint32_t> remap(numVertices);
+    for (int v = 0; v < numVertices; v++) {
+        remap[v] = next[vertexTiers[v]]++;
+    }
+    mesh->remapVertices(remap, numVertices);
+
+    if (!tiers.empty()) {
+        mesh->setBoneInfluences(std::min(influences, tiers.back().influences));
+    }
+    return tiers;
+}
@@ -0,0 +1,51 @@
+//
+//  VROInfluenceTier.h
+//  ViroFBX
+//
+//  Copyright © 2017 Viro. All rights reserved.
+//
+
+#ifndef VROInfluenceTier_h
+#define VROInfluenceTier_h
+
+#include <stdio.h>
+#include <stdint.h>
+#include <vector>
+
+class VROMeshData;
+
+/*
+ A range [vertexOffset, vertexOffset + vertexCount) of vertices that are each
+ influenced by at most the given number of bones (1, 2, 4, or 8). Their remaining
+ influences have zero weight, so they can be skinned by reading only the first
+ influences of each vertex.
+ */
+class VROInfluenceTier {
+public:
+    int influences;
+    int vertexOffset;
+    int vertexCount;
+
+    VROInfluenceTier(int influences, int vertexOffset, int vertexCount) :
+        influences(influences),
+        vertexOffset(vertexOffset),
+        vertexCount(vertexCount) {}
+};
+
+/*
+ Returns the smallest tier (1, 2, 4, or 8 influences) that holds the given number of
+ influences.
+ */
+int getInfluenceTier(int numInfluences);
+
+/*
+ Sort the vertices of the skinned mesh by the tier of their influence count (the
+ number of influences with non-zero weight), preserving their relative order within
+ each tier, and reduce the mesh's influences per vertex to its highest tier. The
+ influences of each vertex must be sorted by decreasing weight.
+
+ Returns the non-empty tiers, in increasing order.
+ */
+std::vector<VROInfluenceTier> sortByInfluenceTier(VROMeshData *mesh);
+
+#endif /* VROInfluenceTier_h */
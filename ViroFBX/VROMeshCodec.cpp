@@ -0,0 +1,389 @@
+//
+//  VROMeshCodec.cpp
+//  ViroFBX
+//
+//  Copyright © 2017 Viro. All rights reserved.
+//
+
+#include "VROMeshCodec.h"
+#include "VROLog.h"
+#include <algorithm>
+#include <cstring>
+
+static const int kVertexGroupSize = 16;
+static const int kVertexGroupBits[4] = { 0, 2, 4, 8 };
+
+static const int kEdgeFIFOSize = 15;
+static const int kVertexFIFOSize = 16;
+static const int kCodeNoEdge = 15;
+static const int kCodeExplicit = 15;
+
+#pragma mark - Varints
+
+static void writeVarint(uint32_t value, std::string *out) {
+    while (value >= 0x80) {
+        out->push_back((char) ((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out->push_back((char) value);
+}
+
+static bool readVarint(const std::string &in, size_t *position, uint32_t *outValue) {
+    uint32_t value = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        if (*position >= in.size()) {
+            return false;
+        }
+        uint8_t byte = (uint8_t) in[(*position)++];
+        value |= (uint32_t) (byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            *outValue = value;
+            return true;
+        }
+    }
+    return false;
+}
+
+static uint32_t zigzag(int32_t value) {
+    return ((uint32_t) value << 1) ^ (uint32_t) (value >> 31);
+}
+
+static int32_t unzigzag(uint32_t value) {
+    return (int32_t) (value >> 1) ^ -(int32_t) (value & 1);
+}
+
+#pragma mark - Vertex Codec
+
+static uint8_t zigzag8(uint8_t delta) {
+    return (uint8_t) ((delta << 1) ^ (uint8_t) ((int8_t) delta >> 7));
+}
+
+static uint8_t unzigzag8(uint8_t value) {
+    return (uint8_t) ((value >> 1) ^ (uint8_t) -(int8_t) (value & 1));
+}
+
+std::string encodeVertexBuffer(const char *data, int numVertices, int stride) {
+    std::string encoded;
+    int numGroups = (numVertices + kVertexGroupSize - 1) / kVertexGroupSize;
+
+    std::vector<uint8_t> deltas(numGroups * kVertexGroupSize);
+    std::vector<int> groupBits(numGroups);
+
+    for (int k = 0; k < stride; k++) {
+        std::fill(deltas.begin(), deltas.end(), 0);
+        uint8_t previous = 0;
+        for (int v = 0; v < numVertices; v++) {
+            uint8_t byte = (uint8_t) data[v * stride + k];
+            deltas[v] = zigzag8((uint8_t) (byte - previous));
+            previous = byte;
+        }
+
+        // Headers: 2 bits per group, 4 groups per byte
+        std::string headers((numGroups + 3) / 4, 0);
+        for (int g = 0; g < numGroups; g++) {
+            uint8_t max = 0;
+            for (int i = 0; i < kVertexGroupSize; i++) {
+                max = std::max(max, deltas[g * kVertexGroupSize + i]);
+            }
+            int selector = max == 0 ? 0 : (max < 4 ? 1 : (max < 16 ? 2 : 3));
+            groupBits[g] = kVertexGroupBits[selector];
+            headers[g / 4] |= (char) (selector << ((g % 4) * 2));
+        }
+        encoded.append(headers);
+
+        for (int g = 0; g < numGroups; g++) {
+            int bits = groupBits[g];
+            if (bits == 0) {
+                continue;
+            }
+            int perByte = 8 / bits;
+            for (int i = 0; i < kVertexGroupSize; i += perByte) {
+                uint8_t packed = 0;
+                for (int j = 0; j < perByte; j++) {
+                    packed |= deltas[g * kVertexGroupSize + i + j] << (j * bits);
+                }
+                encoded.push_back((char) packed);
+            }
+        }
+    }
+    return encoded;
+}
+
+bool decodeVertexBuffer(const std::string &encoded, int numVertices, int stride, std::string *outData) {
+    outData->assign((size_t) numVertices * stride, 0);
+    int numGroups = (numVertices + kVertexGroupSize - 1) / kVertexGroupSize;
+    size_t position = 0;
+
+    for (int k = 0; k < stride; k++) {
+        size_t headersSize = (numGroups + 3) / 4;
+        if (position + headersSize > encoded.size()) {
+            return false;
+        }
+        size_t headers = position;
+        position += headersSize;
+
+        uint8_t previous = 0;
+        for (int g = 0; g < numGroups; g++) {
+            int selector = ((uint8_t) encoded[headers + g / 4] >> ((g % 4) * 2)) & 3;
+            int bits = kVertexGroupBits[selector];
+
+            for (int i = 0; i < kVertexGroupSize; i++) {
+                uint8_t value = 0;
+                if (bits > 0) {
+                    int perByte = 8 / bits;
+                    size_t byteIndex = position + i / perByte;
+                    if (byteIndex >= encoded.size()) {
+                        return false;
+                    }
+                    value = ((uint8_t) encoded[byteIndex] >> ((i % perByte) * bits)) & ((1 << bits) - 1);
+                }
+
+                int v = g * kVertexGroupSize + i;
+                if (v < numVertices) {
+                    previous = (uint8_t) (previous + unzigzag8(value));
+                    (*outData)[(size_t) v * stride + k] = (char) previous;
+                }
+            }
+            if (bits > 0) {
+                position += kVertexGroupSize * bits / 8;
+            }
+        }
+    }
+    return position == encoded.size();
+}
+
+#pragma mark - Index Codec
+
+/*
+ The FIFO state shared by the encoder and decoder; both update it identically after
+ each triangle.
+ */
+class VROIndexCodecState {
+public:
+    uint32_t edges[kEdgeFIFOSize][2];
+    int edgeHead;
+    uint32_t vertices[kVertexFIFOSize];
+    int vertexHead;
+    uint32_t next;
+    uint32_t lastExplicit;
+
+    VROIndexCodecState() :
+        edgeHead(0),
+        vertexHead(0),
+        next(0),
+        lastExplicit(0) {
+        memset(edges, 0xFF, sizeof(edges));
+        memset(vertices, 0xFF, sizeof(vertices));
+    }
+
+    /*
+     FIFO positions count back from the most recent entry, so recent (likely) hits
+     get the smallest codes.
+     */
+    int findEdge(uint32_t a, uint32_t b) const {
+        for (int i = 0; i < kEdgeFIFOSize; i++) {
+            const uint32_t *edge = edges[(edgeHead - 1 - i + kEdgeFIFOSize) % kEdgeFIFOSize];
+            if (edge[0] == a && edge[1] == b) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    const uint32_t *getEdge(int i) const {
+        return edges[(edgeHead - 1 - i + kEdgeFIFOSize) % kEdgeFIFOSize];
+    }
+
+    int findVertex(uint32_t v) const {
+        for (int i = 0; i < kVertexFIFOSize; i++) {
+            if (vertices[(vertexHead - 1 - i + kVertexFIFOSize) % kVertexFIFOSize] == v) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    uint32_t getVertex(int i) const {
+        return vertices[(vertexHead - 1 - i + kVertexFIFOSize) % kVertexFIFOSize];
+    }
+
+    void pushVertex(uint32_t v) {
+        vertices[vertexHead] = v;
+        vertexHead = (vertexHead + 1) % kVertexFIFOSize;
+    }
+
+    /*
+     Record the triangle's edges reversed, as a neighboring triangle would wind them.
+     */
+    void pushTriangle(uint32_t a, uint32_t b, uint32_t c) {
+        const uint32_t triangle[3] = { a, b, c };
+        for (int i = 0; i < 3; i++) {
+            edges[edgeHead][0] = triangle[(i + 1) % 3];
+            edges[edgeHead][1] = triangle[i];
+            edgeHead = (edgeHead + 1) % kEdgeFIFOSize;
+        }
+    }
+};
+
+std::string encodeIndexBuffer(const std::vector<uint32_t> &indices) {
+    VROIndexCodecState state;
+    std::string codes;
+    std::string data;
+
+    /*
+     Classify a vertex as the next unseen vertex, a vertex FIFO hit, or an explicit
+     index, updating the state for new vertices. Returns the FIFO position or -1/-2
+     for next/explicit.
+     */
+    auto classify = [&state](uint32_t v, int *outFIFO) {
+        if (v == state.next) {
+            *outFIFO = -1;
+            state.next++;
+            state.pushVertex(v);
+        }
+        else if ((*outFIFO = state.findVertex(v)) >= 0) {
+        }
+        else {
+            *outFIFO = -2;
+            state.pushVertex(v);
+        }
+    };
+
+    size_t numTriangles = indices.size() / 3;
+    for (size_t t = 0; t < numTriangles; t++) {
+        const uint32_t *triangle = &indices[t * 3];
+
+        int rotation = -1;
+        int edge = -1;
+        for (int r = 0; r < 3; r++) {
+            edge = state.findEdge(triangle[r], triangle[(r + 1) % 3]);
+            if (edge >= 0) {
+                rotation = r;
+                break;
+            }
+        }
+
+        if (rotation >= 0) {
+            uint32_t a = triangle[rotation];
+            uint32_t b = triangle[(rotation + 1) % 3];
+            uint32_t c = triangle[(rotation + 2) % 3];
+
+            int fifo;
+            classify(c, &fifo);
+            int low;
+            if (fifo == -1) {
+                low = 0;
+            }
+            else if (fifo >= 0 && fifo < kCodeExplicit - 1) {
+                low = fifo + 1;
+            }
+            else {
+                // FIFO hits beyond the nibble's range are written explicitly
+                if (fifo >= 0) {
+                    state.pushVertex(c);
+                }
+                low = kCodeExplicit;
+                writeVarint(zigzag((int32_t) (c - state.lastExplicit)), &data);
+                state.lastExplicit = c;
+            }
+            codes.push_back((char) ((edge << 4) | low));
+            state.pushTriangle(a, b, c);
+        }
+        else {
+            codes.push_back((char) (kCodeNoEdge << 4));
+            for (int i = 0; i < 3; i++) {
+                uint32_t v = triangle[i];
+                int fifo;
+                classify(v, &fifo);
+                if (fifo == -1) {
+                    writeVarint(0, &data);
+                }
+                else if (fifo >= 0) {
+                    writeVarint(1 + fifo, &data);
+                }
+                else {
+                    writeVarint(1 + kVertexFIFOSize + zigzag((int32_t) (v - state.lastExplicit)), &data);
+                    state.lastExplicit = v;
+                }
+            }
+            state.pushTriangle(triangle[0], triangle[1], triangle[2]);
+        }
+    }
+
+    std::string encoded;
+    writeVarint((uint32_t) numTriangles, &encoded);
+    encoded.append(codes);
+    encoded.append(data);
+    return encoded;
+}
+
+bool decodeIndexBuffer(const std::string &encoded, std::vector<uint32_t> *outIndices) {
+    VROIndexCodecState state;
+    size_t position = 0;
+    uint32_t numTriangles;
+    if (!readVarint(encoded, &position, &numTriangles) || position + numTriangles > encoded.size()) {
+        return false;
+    }
+
+    size_t codes = position;
+    size_t data = position + numTriangles;
+    outIndices->clear();
+    outIndices->reserve(numTriangles * 3);
+
+    for (uint32_t t = 0; t < numTriangles; t++) {
+        uint8_t code = (uint8_t) encoded[codes + t];
+        int high = code >> 4;
+        int low = code & 0xF;
+
+        if (high != kCodeNoEdge) {
+            const uint32_t *edge = state.getEdge(high);
+            uint32_t a = edge[0];
+            uint32_t b = edge[1];
+            uint32_t c;
+            if (low == 0) {
+                c = state.next++;
+                state.pushVertex(c);
+            }
+            else if (low < kCodeExplicit) {
+                c = state.getVertex(low - 1);
+            }
+            else {
+                uint32_t delta;
+                if (!readVarint(encoded, &data, &delta)) {
+                    return false;
+                }
+                c = state.lastExplicit + (uint32_t) unzigzag(delta);
+                state.lastExplicit = c;
+                state.pushVertex(c);
+            }
+            outIndices->push_back(a);
+            outIndices->push_back(b);
+            outIndices->push_back(c);
+            state.pushTriangle(a, b, c);
+        }
+        else {
+            uint32_t triangle[3];
+            for (int i = 0; i < 3; i++) {
+                uint32_t value;
+                if (!readVarint(encoded, &data, &value)) {
+                    return false;
+                }
+                if (value == 0) {
+                    triangle[i] = state.next++;
+                    state.pushVertex(triangle[i]);
+                }
+                else if (value <= kVertexFIFOSize) {
+                    triangle[i] = state.getVertex(value - 1);
+                }
+                else {
+                    triangle[i] = state.lastExplicit + (uint32_t) unzigzag(value - 1 - kVertexFIFOSize);
+                    state.lastExplicit = triangle[i];
+                    state.pushVertex(triangle[i]);
+                }
+                outIndices->push_back(triangle[i]);
+            }
+            state.pushTriangle(triangle[0], triangle[1], triangle[2]);
+        }
+    }
+    return data == encoded.size();
+}
@@ -0,0 +1,52 @@
+//
+//  VROMeshCodec.h
+//  ViroFBX
+//
+//  Copyright © 2017 Viro. All rights reserved.
+//
+
+#ifndef VROMeshCodec_h
+#define VROMeshCodec_h
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/*
+ Lossless codecs for vertex and index buffers. Both produce byte streams with far
+ less entropy than the raw buffers, which the file's zlib pass then compresses much
+ further, and both decode in a single linear pass.
+ */
+
+/*
+ Encode a vertex buffer of numVertices vertices of stride bytes each. Each byte of
+ each vertex is replaced by its difference from the same byte of the previous vertex,
+ zigzag encoded so that small changes of either sign become small values. The deltas
+ are stored column by column (all vertices' byte 0, then byte 1, ...), in groups of
+ 16. Each group is bit-packed at 0, 2, 4, or 8 bits per delta, selected by a 2-bit
+ header; the headers of a column precede its packed groups.
+ */
+std::string encodeVertexBuffer(const char *data, int numVertices, int stride);
+bool decodeVertexBuffer(const std::string &encoded, int numVertices, int stride, std::string *outData);
+
+/*
+ Encode a triangle list. Each triangle is written as one code byte, plus varints in
+ a separate data stream when needed, using a FIFO of recently seen edges and a FIFO of
+ recently seen vertices, in the manner of meshoptimizer's index codec:
+
+ - The high nibble of the code is the position (0-14) of the triangle edge found in
+   the edge FIFO, and the low nibble encodes the third vertex: 0 for the next unseen
+   vertex, 1-14 for a position in the vertex FIFO, or 15 for an explicit index,
+   stored as a zigzag varint delta from the last explicit index.
+ - A high nibble of 15 means no edge was found; the three vertices then each follow
+   in the data stream as varints: 0 for the next unseen vertex, 1-16 for a position
+   in the vertex FIFO, and 17 plus the zigzag delta for an explicit index.
+
+ Triangles may be rotated (but never reflected), so winding is preserved. The output
+ is the triangle count, the code stream, and the data stream.
+ */
+std::string encodeIndexBuffer(const std::vector<uint32_t> &indices);
+bool decodeIndexBuffer(const std::string &encoded, std::vector<uint32_t> *outIndices);
+
+#endif /* VROMeshCodec_h */
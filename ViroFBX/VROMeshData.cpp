@@ -0,0 +1,240 @@
+//
+//  VROMeshData.cpp
+//  ViroFBX
+//
+//  Copyright © 2017 Viro. All rights reserved.
+//
+
+#include "VROMeshData.h"
+#include "VROLog.h"
+#include <cstring>
+#include <algorithm>
+
+VROMeshData::VROMeshData() :
+    hasTexcoords(true),
+    hasNormals(true),
+    hasTangents(true),
+    boneInfluences(0),
+    _numVertices(0) {
+
+}
+
+VROMeshData::~VROMeshData() {
+
+}
+
+void VROMeshData::resize(int numVertices) {
+    _numVertices = numVertices;
+
+    positions.resize(numVertices * 3);
+    texcoords.resize(hasTexcoords ? numVertices * 2 : 0);
+    normals.resize(hasNormals ? numVertices * 3 : 0);
+    tangents.resize(hasTangents ? numVertices * 4 : 0);
+    boneIndices.resize(numVertices * boneInfluences);
+    boneWeights.resize(numVertices * boneInfluences);
+}
+
+#pragma mark - Welding
+
+/*
+ FNV-1a over the raw bytes of a single vertex in the given stream.
+ */
+template <typename T>
+static uint32_t hashStream(uint32_t hash, const std::vector<T> &stream, int vertex, int components) {
+    if (components == 0) {
+        return hash;
+    }
+    const unsigned char *bytes = reinterpret_cast<const unsigned char *>(stream.data() + vertex * components);
+    size_t length = sizeof(T) * components;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= bytes[i];
+        hash *= 16777619;
+    }
+    return hash;
+}
+
+template <typename T>
+static bool isStreamEqual(const std::vector<T> &stream, int a, int b, int components) {
+    if (components == 0) {
+        return true;
+    }
+    return memcmp(stream.data() + a * components, stream.data() + b * components, sizeof(T) * components) == 0;
+}
+
+uint32_t VROMeshData::hashVertex(int vertex) const {
+    uint32_t hash = 2166136261;
+    hash = hashStream(hash, positions, vertex, 3);
+    hash = hashStream(hash, texcoords, vertex, hasTexcoords ? 2 : 0);
+    hash = hashStream(hash, normals, vertex, hasNormals ? 3 : 0);
+    hash = hashStream(hash, tangents, vertex, hasTangents ? 4 : 0);
+    hash = hashStream(hash, boneIndices, vertex, boneInfluences);
+    hash = hashStream(hash, boneWeights, vertex, boneInfluences);
+    return hash;
+}
+
+bool VROMeshData::isVertexEqual(int a, int b) const {
+    return isStreamEqual(positions, a, b, 3) &&
+           isStreamEqual(texcoords, a, b, hasTexcoords ? 2 : 0) &&
+           isStreamEqual(normals, a, b, hasNormals ? 3 : 0) &&
+           isStreamEqual(tangents, a, b, hasTangents ? 4 : 0) &&
+           isStreamEqual(boneIndices, a, b, boneInfluences) &&
+           isStreamEqual(boneWeights, a, b, boneInfluences);
+}
+
+int VROMeshData::weld() {
+    if (_numVertices == 0) {
+        return 0;
+    }
+
+    /*
+     Open-addressed hash table of unique vertices, sized to the next power of two
+     above 1.25x the vertex count so that probe sequences stay short.
+     */
+    size_t tableSize = 1;
+    while (tableSize < (size_t)_numVertices + _numVertices / 4) {
+        tableSize *= 2;
+    }
+    std::vector<uint32_t> table(tableSize, kVertexUnused);
+    std::vector<uint32_t> remap(_numVertices);
+
+    int numUnique = 0;
+    for (int v = 0; v < _numVertices; v++) {
+        size_t bucket = hashVertex(v) & (tableSize - 1);
+        while (true) {
+            uint32_t entry = table[bucket];
+            if (entry == kVertexUnused) {
+                table[bucket] = v;
+                remap[v] = numUnique++;
+                break;
+            }
+            if (isVertexEqual(entry, v)) {
+                remap[v] = remap[entry];
+                break;
+            }
+            bucket = (bucket + 1) & (tableSize - 1);
+        }
+    }
+
+    remapVertices(remap, numUnique);
+    return numUnique;
+}
+
+#pragma mark - Remapping
+
+template <typename T>
+static void remapStream(std::vector<T> &stream, const std::vector<uint32_t> &remap, int numVertices, int components) {
+    if (components == 0) {
+        return;
+    }
+
+    std::vector<T> remapped(numVertices * components);
+    std::vector<bool> written(numVertices, false);
+    for (size_t v = 0; v < remap.size(); v++) {
+        uint32_t target = remap[v];
+        if (target == kVertexUnused || written[target]) {
+            continue;
+        }
+        memcpy(remapped.data() + target * components, stream.data() + v * components, sizeof(T) * components);
+        written[target] = true;
+    }
+    stream.swap(remapped);
+}
+
+void VROMeshData::remapVertices(const std::vector<uint32_t> &remap, int numVertices) {
+    passert (remap.size() == (size_t)_numVertices);
+
+    remapStream(positions, remap, numVertices, 3);
+    remapStream(texcoords, remap, numVertices, hasTexcoords ? 2 : 0);
+    remapStream(normals, remap, numVertices, hasNormals ? 3 : 0);
+    remapStream(tangents, remap, numVertices, hasTangents ? 4 : 0);
+    remapStream(boneIndices, remap, numVertices, boneInfluences);
+    remapStream(boneWeights, remap, numVertices, boneInfluences);
+
+    for (std::vector<uint32_t> &element : elements) {
+        for (uint32_t &index : element) {
+            index = remap[index];
+            passert (index != kVertexUnused);
+        }
+    }
+    _numVertices = numVertices;
+}
+
+#pragma mark - Merging
+
+template <typename T>
+static void appendStream(std::vector<T> &stream, const std::vector<T> &other, bool otherHasStream,
+                         int numOtherVertices, int components) {
+    if (components == 0) {
+        return;
+    }
+    if (otherHasStream) {
+        stream.insert(stream.end(), other.begin(), other.begin() + numOtherVertices * components);
+    }
+    else {
+        stream.resize(stream.size() + numOtherVertices * components, 0);
+    }
+}
+
+void VROMeshData::append(const VROMeshData &other, const std::vector<int> &elementMapping) {
+    passert (other.boneInfluences == boneInfluences);
+    passert (elementMapping.size() == other.elements.size());
+
+    int numOtherVertices = other.getVertexCount();
+    appendStream(positions, other.positions, true, numOtherVertices, 3);
+    appendStream(texcoords, other.texcoords, other.hasTexcoords, numOtherVertices, hasTexcoords ? 2 : 0);
+    appendStream(normals, other.normals, other.hasNormals, numOtherVertices, hasNormals ? 3 : 0);
+    appendStream(tangents, other.tangents, other.hasTangents, numOtherVertices, hasTangents ? 4 : 0);
+    appendStream(boneIndices, other.boneIndices, true, numOtherVertices, boneInfluences);
+    appendStream(boneWeights, other.boneWeights, true, numOtherVertices, boneInfluences);
+
+    for (int e = 0; e < other.elements.size(); e++) {
+        int target = elementMapping[e];
+        if (target >= elements.size()) {
+            elements.resize(target + 1);
+        }
+        for (uint32_t index : other.elements[e]) {
+            elements[target].push_back(index + _numVertices);
+        }
+    }
+    _numVertices += numOtherVertices;
+}
+
+template <typename T>
+static void duplicateStream(std::vector<T> &stream, const std::vector<uint32_t> &sources, int components) {
+    if (components == 0) {
+        return;
+    }
+    size_t size = stream.size();
+    stream.resize(size + sources.size() * components);
+    for (size_t i = 0; i < sources.size(); i++) {
+        memcpy(stream.data() + size + i * components, stream.data() + sources[i] * components,
+               sizeof(T) * components);
+    }
+}
+
+void VROMeshData::duplicateVertices(const std::vector<uint32_t> &sources) {
+    duplicateStream(positions, sources, 3);
+    duplicateStream(texcoords, sources, hasTexcoords ? 2 : 0);
+    duplicateStream(normals, sources, hasNormals ? 3 : 0);
+    duplicateStream(tangents, sources, hasTangents ? 4 : 0);
+    duplicateStream(boneIndices, sources, boneInfluences);
+    duplicateStream(boneWeights, sources, boneInfluences);
+    _numVertices += (int) sources.size();
+}
+
+void VROMeshData::setBoneInfluences(int influences) {
+    if (influences == boneInfluences) {
+        return;
+    }
+
+    std::vector<int> indices(_numVertices * influences, 0);
+    std::vector<float> weights(_numVertices * influences, 0);
+    int kept = std::min(influences, boneInfluences);
+    for (int v = 0; v < _numVertices; v++) {
+        memcpy(&indices[v * influences], &boneIndices[v * boneInfluences], sizeof(int) * kept);
+        memcpy(&weights[v * influences], &boneWeights[v * boneInfluences], sizeof(float) * kept);
+    }
+    boneIndices.swap(indices);
+    boneWeights.swap(weights);
+    boneInfluences = influences;
+}
@@ -0,0 +1,112 @@
+//
+//  VROMeshData.h
+//  ViroFBX
+//
+//  Copyright © 2017 Viro. All rights reserved.
+//
+
+#ifndef VROMeshData_h
+#define VROMeshData_h
+
+#include <stdio.h>
+#include <stdint.h>
+#include <vector>
+
+/*
+ Index used in vertex remap tables to indicate the vertex should be dropped.
+ */
+static const uint32_t kVertexUnused = 0xFFFFFFFF;
+
+/*
+ Intermediate representation of a geometry while it is being exported. Each
+ vertex attribute is held in its own tightly packed stream (structure of arrays),
+ and each element is a triangle list indexing into those streams. The streams are
+ interleaved into the final Geometry.data only when the geometry is serialized.
+ */
+class VROMeshData {
+public:
+
+    VROMeshData();
+    virtual ~VROMeshData();
+
+    /*
+     Vertex attribute streams. Positions, normals, and texcoords hold 3, 3, and 2
+     floats per vertex; tangents hold 4 (the w component is the bitangent sign).
+     Streams whose has flag is false are empty, and are ignored when welding and
+     remapping. The flags must be set before the streams are resized.
+     */
+    bool hasTexcoords;
+    bool hasNormals;
+    bool hasTangents;
+    std::vector<float> positions;
+    std::vector<float> texcoords;
+    std::vector<float> normals;
+    std::vector<float> tangents;
+
+    /*
+     Skinning streams. Each vertex has boneInfluences bone indices and weights;
+     boneInfluences is 0 if the mesh is not skinned.
+     */
+    int boneInfluences;
+    std::vector<int> boneIndices;
+    std::vector<float> boneWeights;
+
+    /*
+     Triangle lists, one per element (material).
+     */
+    std::vector<std::vector<uint32_t>> elements;
+
+    int getVertexCount() const {
+        return _numVertices;
+    }
+
+    /*
+     Resize every attribute stream to hold the given number of vertices.
+     */
+    void resize(int numVertices);
+
+    /*
+     Merge all vertices that are bitwise identical across every attribute stream,
+     and rewrite the elements to index the merged vertices. Returns the new vertex
+     count.
+     */
+    int weld();
+
+    /*
+     Move each vertex v to index remap[v], and rewrite the elements accordingly.
+     Vertices mapped to kVertexUnused are dropped. When several vertices map to the
+     same index, the attributes of the first are retained.
+     */
+    void remapVertices(const std::vector<uint32_t> &remap, int numVertices);
+
+    /*
+     Append the vertices of the given mesh after this mesh's vertices, and append its
+     triangles to the elements given by elementMapping (one entry per element of the
+     other mesh), growing the element list as needed. Streams this mesh has but the
+     other lacks are zero-filled; streams the other has but this mesh lacks are
+     ignored. Both meshes must have the same number of bone influences.
+     */
+    void append(const VROMeshData &other, const std::vector<int> &elementMapping);
+
+    /*
+     Append a copy of each vertex in sources after the existing vertices, so that
+     copy i of sources[i] has index getVertexCount() + i. Elements are unchanged.
+     */
+    void duplicateVertices(const std::vector<uint32_t> &sources);
+
+    /*
+     Change the number of bone influences per vertex, keeping each vertex's first
+     influences and padding new ones with zero weights on bone 0.
+     */
+    void setBoneInfluences(int influences);
+
+private:
+
+    int _numVertices;
+
+    uint32_t hashVertex(int vertex) const;
+    bool isVertexEqual(int a, int b) const;
+
+};
+
+#endif /* VROMeshData_h */
@@ -0,0 +1,626 @@
+//
+//  VROMeshOptimizer.cpp
+//  ViroFBX
+//
+//  Copyright © 2017 Viro. All rights reserved.
+//
+
+#include "VROMeshOptimizer.h"
+#include "VROMeshData.h"
+#include "VROLog.h"
+#include <cmath>
+#include <algorithm>
+#include <array>
+#include <set>
+
+#pragma mark - Analysis
+
+VROVertexCacheStats analyzeVertexCache(const std::vector<uint32_t> &indices, int numVertices, int cacheSize) {
+    VROVertexCacheStats stats;
+    if (indices.empty()) {
+        return stats;
+    }
+
+    /*
+     The FIFO is a ring buffer; each vertex records the time at which it entered the
+     cache, and is a hit if it entered within the last cacheSize misses.
+     */
+    std::vector<int> entryTime(numVertices, -1);
+    std::vector<bool> referenced(numVertices, false);
+    int numReferenced = 0;
+
+    for (uint32_t index : indices) {
+        passert (index < numVertices);
+        if (entryTime[index] < 0 || stats.verticesTransformed - entryTime[index] > cacheSize) {
+            entryTime[index] = stats.verticesTransformed;
+            stats.verticesTransformed++;
+        }
+        if (!referenced[index]) {
+            referenced[index] = true;
+            numReferenced++;
+        }
+    }
+
+    stats.acmr = (float) stats.verticesTransformed / (float) (indices.size() / 3);
+    stats.atvr = (float) stats.verticesTransformed / (float) numReferenced;
+    return stats;
+}
+
+#pragma mark - Vertex Cache Optimization
+
+/*
+ Parameters for Forsyth's algorithm. The simulated LRU cache is larger than the
+ hardware FIFO, which works well in practice across cache sizes.
+ */
+static const int kForsythCacheSize = 32;
+static const int kForsythMaxValence = 32;
+static const float kForsythCacheDecayPower = 1.5f;
+static const float kForsythLastTriangleScore = 0.75f;
+static const float kForsythValenceBoostScale = 2.0f;
+static const float kForsythValenceBoostPower = 0.5f;
+
+class VROForsythScores {
+public:
+    float cache[kForsythCacheSize];
+    float valence[kForsythMaxValence];
+
+    VROForsythScores() {
+        for (int i = 0; i < kForsythCacheSize; i++) {
+            if (i < 3) {
+                // The last triangle's vertices are scored low to avoid emitting strip-like sequences
+                cache[i] = kForsythLastTriangleScore;
+            }
+            else {
+                float scaler = 1.0f / (kForsythCacheSize - 3);
+                cache[i] = powf(1.0f - (i - 3) * scaler, kForsythCacheDecayPower);
+            }
+        }
+        for (int i = 0; i < kForsythMaxValence; i++) {
+            valence[i] = i == 0 ? 0 : kForsythValenceBoostScale * powf((float) i, -kForsythValenceBoostPower);
+        }
+    }
+
+    float score(int cachePosition, int remainingValence) const {
+        if (remainingValence == 0) {
+            // No triangles left to use this vertex
+            return -1.0f;
+        }
+        float score = cachePosition >= 0 ? cache[cachePosition] : 0;
+        if (remainingValence < kForsythMaxValence) {
+            score += valence[remainingValence];
+        }
+        else {
+            score += kForsythValenceBoostScale * powf((float) remainingValence, -kForsythValenceBoostPower);
+        }
+        return score;
+    }
+};
+
+void optimizeVertexCache(std::vector<uint32_t> &indices, int numVertices) {
+    int numTriangles = (int) indices.size() / 3;
+    if (numTriangles == 0) {
+        return;
+    }
+
+    static const VROForsythScores kScores;
+
+    /*
+     Build the vertex to triangle adjacency, in compressed form. The adjacent triangles
+     of vertex v are in adjacency[offsets[v]] to adjacency[offsets[v] + remaining[v]];
+     emitted triangles are swapped out of that range.
+     */
+    std::vector<int> remaining(numVertices, 0);
+    for (uint32_t index : indices) {
+        passert (index < numVertices);
+        remaining[index]++;
+    }
+
+    std::vector<int> offsets(numVertices + 1, 0);
+    for (int v = 0; v < numVertices; v++) {
+        offsets[v + 1] = offsets[v] + remaining[v];
+    }
+
+    std::vector<int> adjacency(indices.size());
+    std::vector<int> fill(offsets.begin(), offsets.end() - 1);
+    for (int t = 0; t < numTriangles; t++) {
+        for (int k = 0; k < 3; k++) {
+            adjacency[fill[indices[t * 3 + k]]++] = t;
+        }
+    }
+
+    std::vector<int> cachePosition(numVertices, -1);
+    std::vector<float> vertexScore(numVertices);
+    for (int v = 0; v < numVertices; v++) {
+        vertexScore[v] = kScores.score(-1, remaining[v]);
+    }
+
+    std::vector<float> triangleScore(numTriangles);
+    std::vector<bool> emitted(numTriangles, false);
+    for (int t = 0; t < numTriangles; t++) {
+        triangleScore[t] = vertexScore[indices[t * 3 + 0]] +
+                           vertexScore[indices[t * 3 + 1]] +
+                           vertexScore[indices[t * 3 + 2]];
+    }
+
+    std::vector<uint32_t> optimized;
+    optimized.reserve(indices.size());
+
+    std::vector<uint32_t> cache;
+    std::vector<uint32_t> newCache;
+    cache.reserve(kForsythCacheSize + 3);
+    newCache.reserve(kForsythCacheSize + 3);
+
+    int bestTriangle = 0;
+    int deadEndCursor = 0;
+
+    for (int i = 0; i < numTriangles; i++) {
+        /*
+         If no triangle touches the cache, continue with the next triangle (in input
+         order) that has not been emitted.
+         */
+        if (bestTriangle < 0) {
+            while (emitted[deadEndCursor]) {
+                deadEndCursor++;
+            }
+            bestTriangle = deadEndCursor;
+        }
+
+        const uint32_t *triangle = &indices[bestTriangle * 3];
+        optimized.insert(optimized.end(), triangle, triangle + 3);
+        emitted[bestTriangle] = true;
+
+        for (int k = 0; k < 3; k++) {
+            uint32_t v = triangle[k];
+            int *begin = &adjacency[offsets[v]];
+            int *end = begin + remaining[v];
+            int *it = std::find(begin, end, bestTriangle);
+            passert (it != end);
+
+            std::swap(*it, *(end - 1));
+            remaining[v]--;
+        }
+
+        /*
+         Move the triangle's vertices to the front of the LRU cache.
+         */
+        newCache.clear();
+        for (int k = 0; k < 3; k++) {
+            if (std::find(newCache.begin(), newCache.end(), triangle[k]) == newCache.end()) {
+                newCache.push_back(triangle[k]);
+            }
+        }
+        for (uint32_t v : cache) {
+            if (std::find(newCache.begin(), newCache.end(), v) == newCache.end()) {
+                newCache.push_back(v);
+            }
+        }
+        cache.swap(newCache);
+
+        /*
+         Update the scores of every vertex in (or just evicted from) the cache, and
+         propagate the change to their remaining triangles.
+         */
+        for (int c = 0; c < cache.size(); c++) {
+            uint32_t v = cache[c];
+            cachePosition[v] = c < kForsythCacheSize ? c : -1;
+
+            float score = kScores.score(cachePosition[v], remaining[v]);
+            float delta = score - vertexScore[v];
+            vertexScore[v] = score;
+
+            for (int a = offsets[v]; a < offsets[v] + remaining[v]; a++) {
+                triangleScore[adjacency[a]] += delta;
+            }
+        }
+        if (cache.size() > kForsythCacheSize) {
+            cache.resize(kForsythCacheSize);
+        }
+
+        /*
+         The next triangle is the highest scoring triangle adjacent to the cache.
+         */
+        bestTriangle = -1;
+        float bestScore = -1;
+        for (uint32_t v : cache) {
+            for (int a = offsets[v]; a < offsets[v] + remaining[v]; a++) {
+                int t = adjacency[a];
+                if (triangleScore[t] > bestScore || (triangleScore[t] == bestScore && t < bestTriangle)) {
+                    bestScore = triangleScore[t];
+                    bestTriangle = t;
+                }
+            }
+        }
+    }
+
+    passert (optimized.size() == indices.size());
+    indices.swap(optimized);
+}
+
+#pragma mark - Overdraw Optimization
+
+/*
+ FIFO cache simulation used to find cluster boundaries. Returns the number of cache
+ misses incurred by the given triangle.
+ */
+static int updateVertexCache(const uint32_t *triangle, std::vector<int> &entryTime, int *time, int cacheSize) {
+    int misses = 0;
+    for (int k = 0; k < 3; k++) {
+        uint32_t v = triangle[k];
+        if (entryTime[v] < 0 || *time - entryTime[v] > cacheSize) {
+            entryTime[v] = *time;
+            (*time)++;
+            misses++;
+        }
+    }
+    return misses;
+}
+
+void optimizeOverdraw(std::vector<uint32_t> &indices, const std::vector<float> &positions,
+                      int numVertices, float threshold) {
+    int numTriangles = (int) indices.size() / 3;
+    if (numTriangles == 0) {
+        return;
+    }
+
+    /*
+     Hard boundaries: the triangles at which the cache optimized order misses on every
+     vertex. These are where the cache optimizer started on a new region of the mesh,
+     so splitting there costs nothing.
+     */
+    std::vector<int> hardClusters;
+    {
+        std::vector<int> entryTime(numVertices, -1);
+        int time = 0;
+        for (int t = 0; t < numTriangles; t++) {
+            int misses = updateVertexCache(&indices[t * 3], entryTime, &time, kVertexCacheAnalysisSize);
+            if (t == 0 || misses == 3) {
+                hardClusters.push_back(t);
+            }
+        }
+    }
+    hardClusters.push_back(numTriangles);
+
+    /*
+     Soft boundaries: within each hard cluster, split wherever the miss ratio of the
+     triangles so far is within the threshold of the hard cluster's overall ratio.
+     */
+    std::vector<int> clusters;
+    {
+        std::vector<int> entryTime(numVertices, -1);
+        int time = 0;
+
+        for (int h = 0; h + 1 < hardClusters.size(); h++) {
+            int start = hardClusters[h];
+            int end = hardClusters[h + 1];
+
+            int clusterMisses = 0;
+            for (int t = start; t < end; t++) {
+                clusterMisses += updateVertexCache(&indices[t * 3], entryTime, &time, kVertexCacheAnalysisSize);
+            }
+            float clusterThreshold = threshold * ((float) clusterMisses / (float) (end - start));
+
+            /*
+             Re-simulate from an empty cache, as the cluster may be drawn in any order.
+             Advancing the time past the cache size evicts every vertex without touching
+             the entry times.
+             */
+            time += kVertexCacheAnalysisSize + 1;
+            clusters.push_back(start);
+
+            int runMisses = 0;
+            int runTriangles = 0;
+            for (int t = start; t < end; t++) {
+                runMisses += updateVertexCache(&indices[t * 3], entryTime, &time, kVertexCacheAnalysisSize);
+                runTriangles++;
+
+                if (t + 1 < end && runMisses <= clusterThreshold * runTriangles) {
+                    clusters.push_back(t + 1);
+                    time += kVertexCacheAnalysisSize + 1;
+                    runMisses = 0;
+                    runTriangles = 0;
+                }
+            }
+        }
+    }
+    clusters.push_back(numTriangles);
+    int numClusters = (int) clusters.size() - 1;
+
+    /*
+     Sort key for each cluster: how far its centroid lies along its average normal,
+     relative to the centroid of the whole mesh. Clusters on the outside of the mesh,
+     facing away from its center, are drawn first.
+     */
+    double meshCentroid[3] = { 0, 0, 0 };
+    double meshArea = 0;
+
+    std::vector<double> clusterCentroids(numClusters * 3, 0);
+    std::vector<double> clusterNormals(numClusters * 3, 0);
+    std::vector<double> clusterAreas(numClusters, 0);
+
+    for (int c = 0; c < numClusters; c++) {
+        for (int t = clusters[c]; t < clusters[c + 1]; t++) {
+            const float *p0 = &positions[indices[t * 3 + 0] * 3];
+            const float *p1 = &positions[indices[t * 3 + 1] * 3];
+            const float *p2 = &positions[indices[t * 3 + 2] * 3];
+
+            double e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+            double e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+            double normal[3] = { e1[1] * e2[2] - e1[2] * e2[1],
+                                 e1[2] * e2[0] - e1[0] * e2[2],
+                                 e1[0] * e2[1] - e1[1] * e2[0] };
+            double area = sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+
+            for (int i = 0; i < 3; i++) {
+                double center = (p0[i] + p1[i] + p2[i]) / 3.0;
+                clusterCentroids[c * 3 + i] += center * area;
+                clusterNormals[c * 3 + i] += normal[i];
+                meshCentroid[i] += center * area;
+            }
+            clusterAreas[c] += area;
+            meshArea += area;
+        }
+    }
+    if (meshArea > 0) {
+        for (int i = 0; i < 3; i++) {
+            meshCentroid[i] /= meshArea;
+        }
+    }
+
+    std::vector<float> sortKeys(numClusters, 0);
+    for (int c = 0; c < numClusters; c++) {
+        double *centroid = &clusterCentroids[c * 3];
+        double *normal = &clusterNormals[c * 3];
+        double length = sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+        if (clusterAreas[c] <= 0 || length <= 0) {
+            continue;
+        }
+
+        float key = 0;
+        for (int i = 0; i < 3; i++) {
+            key += (centroid[i] / clusterAreas[c] - meshCentroid[i]) * (normal[i] / length);
+        }
+        sortKeys[c] = key;
+    }
+
+    std::vector<int> order(numClusters);
+    for (int c = 0; c < numClusters; c++) {
+        order[c] = c;
+    }
+    std::stable_sort(order.begin(), order.end(), [&sortKeys](int a, int b) {
+        return sortKeys[a] > sortKeys[b];
+    });
+
+    std::vector<uint32_t> optimized;
+    optimized.reserve(indices.size());
+    for (int c : order) {
+        optimized.insert(optimized.end(), indices.begin() + clusters[c] * 3, indices.begin() + clusters[c + 1] * 3);
+    }
+    indices.swap(optimized);
+}
+
+#pragma mark - Vertex Fetch Optimization
+
+int optimizeVertexFetch(VROMeshData *mesh) {
+    int numVertices = mesh->getVertexCount();
+    std::vector<uint32_t> remap(numVertices, kVertexUnused);
+
+    int next = 0;
+    for (const std::vector<uint32_t> &element : mesh->elements) {
+        for (uint32_t index : element) {
+            if (remap[index] == kVertexUnused) {
+                remap[index] = next++;
+            }
+        }
+    }
+
+    mesh->remapVertices(remap, next);
+    return next;
+}
+
+#pragma mark - Cleanup
+
+static bool isZeroArea(const std::vector<float> &positions, const uint32_t *triangle) {
+    const float *p0 = &positions[triangle[0] * 3];
+    const float *p1 = &positions[triangle[1] * 3];
+    const float *p2 = &positions[triangle[2] * 3];
+
+    double e1[3], e2[3], e3[3];
+    for (int i = 0; i < 3; i++) {
+        e1[i] = p1[i] - p0[i];
+        e2[i] = p2[i] - p0[i];
+        e3[i] = p2[i] - p1[i];
+    }
+    double cross[3] = { e1[1] * e2[2] - e1[2] * e2[1],
+                        e1[2] * e2[0] - e1[0] * e2[2],
+                        e1[0] * e2[1] - e1[1] * e2[0] };
+    double crossLength = sqrt(cross[0] * cross[0] + cross[1] * cross[1] + cross[2] * cross[2]);
+
+    double longestSq = std::max(e1[0] * e1[0] + e1[1] * e1[1] + e1[2] * e1[2],
+                       std::max(e2[0] * e2[0] + e2[1] * e2[1] + e2[2] * e2[2],
+                                e3[0] * e3[0] + e3[1] * e3[1] + e3[2] * e3[2]));
+    return crossLength <= kZeroAreaTolerance * longestSq;
+}
+
+VROCleanupStats cleanupMesh(VROMeshData *mesh, const std::vector<bool> &doubleSidedElements) {
+    VROCleanupStats stats;
+
+    for (size_t e = 0; e < mesh->elements.size(); e++) {
+        std::vector<uint32_t> &element = mesh->elements[e];
+        bool doubleSided = e < doubleSidedElements.size() && doubleSidedElements[e];
+
+        /*
+         Triangles are identified by their indices rotated so the smallest comes first,
+         which preserves winding. For double-sided elements the indices are fully
+         sorted, so both windings share a key.
+         */
+        std::set<std::array<uint32_t, 3>> seen;
+        size_t kept = 0;
+
+        for (size_t t = 0; t < element.size() / 3; t++) {
+            const uint32_t *triangle = &element[t * 3];
+            if (triangle[0] == triangle[1] || triangle[1] == triangle[2] || triangle[2] == triangle[0]) {
+                ++stats.collapsedTriangles;
+                continue;
+            }
+            if (isZeroArea(mesh->positions, triangle)) {
+                ++stats.zeroAreaTriangles;
+                continue;
+            }
+
+            int first = (int) (std::min_element(triangle, triangle + 3) - triangle);
+            std::array<uint32_t, 3> key = {{ triangle[first], triangle[(first + 1) % 3], triangle[(first + 2) % 3] }};
+            if (doubleSided) {
+                std::sort(key.begin(), key.end());
+            }
+            if (!seen.insert(key).second) {
+                ++stats.duplicateTriangles;
+                continue;
+            }
+
+            if (kept != t) {
+                std::copy(triangle, triangle + 3, &element[kept * 3]);
+            }
+            ++kept;
+        }
+        element.resize(kept * 3);
+    }
+
+    int numVertices = mesh->getVertexCount();
+    std::vector<bool> referenced(numVertices, false);
+    for (const std::vector<uint32_t> &element : mesh->elements) {
+        for (uint32_t index : element) {
+            referenced[index] = true;
+        }
+    }
+
+    std::vector<uint32_t> remap(numVertices, kVertexUnused);
+    int next = 0;
+    for (int v = 0; v < numVertices; v++) {
+        if (referenced[v]) {
+            remap[v] = next++;
+        }
+    }
+    if (next < numVertices) {
+        mesh->remapVertices(remap, next);
+    }
+    stats.unreferencedVertices = numVertices - next;
+    return stats;
+}
+
+#pragma mark - Triangle Strips
+
+static uint64_t edgeKey(uint32_t from, uint32_t to) {
+    return ((uint64_t) from << 32) | to;
+}
+
+std::vector<uint32_t> stripify(const std::vector<uint32_t> &indices, bool primitiveRestart, uint32_t restartIndex) {
+    int numTriangles = (int) indices.size() / 3;
+
+    /*
+     Index each triangle by its three directed edges. A strip continues across the
+     edge shared with its last triangle, in the direction opposite to that triangle's
+     own winding of it.
+     */
+    std::vector<std::pair<uint64_t, uint32_t>> edges;
+    edges.reserve(numTriangles * 3);
+    std::vector<bool> used(numTriangles, false);
+
+    for (int t = 0; t < numTriangles; t++) {
+        const uint32_t *triangle = &indices[t * 3];
+        if (triangle[0] == triangle[1] || triangle[1] == triangle[2] || triangle[2] == triangle[0]) {
+            used[t] = true;
+            continue;
+        }
+        for (int i = 0; i < 3; i++) {
+            edges.push_back(std::make_pair(edgeKey(triangle[i], triangle[(i + 1) % 3]), t));
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+
+    /*
+     Return an unused triangle containing the directed edge (from, to), writing its
+     remaining vertex to outThird, or -1 if there is none.
+     */
+    auto findTriangle = [&](uint32_t from, uint32_t to, uint32_t *outThird) {
+        auto it = std::lower_bound(edges.begin(), edges.end(), std::make_pair(edgeKey(from, to), (uint32_t) 0));
+        for (; it != edges.end() && it->first == edgeKey(from, to); ++it) {
+            if (used[it->second]) {
+                continue;
+            }
+            const uint32_t *triangle = &indices[it->second * 3];
+            for (int i = 0; i < 3; i++) {
+                if (triangle[i] == to) {
+                    *outThird = triangle[(i + 1) % 3];
+                }
+            }
+            return (int) it->second;
+        }
+        return -1;
+    };
+
+    std::vector<uint32_t> output;
+    output.reserve(indices.size());
+
+    std::vector<uint32_t> strip;
+    for (int start = 0; start < numTriangles; start++) {
+        if (used[start]) {
+            continue;
+        }
+        used[start] = true;
+
+        /*
+         Begin with the rotation of the starting triangle that can be continued, if any.
+         The second triangle of a strip is wound opposite to the first, so it must share
+         the edge from the first triangle's third vertex back to its second.
+         */
+        const uint32_t *triangle = &indices[start * 3];
+        int rotation = 0;
+        for (int r = 0; r < 3; r++) {
+            uint32_t third;
+            if (findTriangle(triangle[(r + 2) % 3], triangle[(r + 1) % 3], &third) >= 0) {
+                rotation = r;
+                break;
+            }
+        }
+
+        strip.clear();
+        for (int i = 0; i < 3; i++) {
+            strip.push_back(triangle[(rotation + i) % 3]);
+        }
+
+        while (true) {
+            size_t n = strip.size() - 2;
+            uint32_t a = strip[n];
+            uint32_t b = strip[n + 1];
+
+            uint32_t third;
+            int next = (n % 2 == 0) ? findTriangle(a, b, &third) : findTriangle(b, a, &third);
+            if (next < 0) {
+                break;
+            }
+            used[next] = true;
+            strip.push_back(third);
+        }
+
+        /*
+         Join the strip to the output. Without primitive restart, the strip is stitched
+         on with degenerate triangles; its first vertex must land on an even position
+         so that its winding is preserved.
+         */
+        if (!output.empty()) {
+            if (primitiveRestart) {
+                output.push_back(restartIndex);
+            }
+            else {
+                uint32_t last = output.back();
+                if (output.size() % 2 != 0) {
+                    output.push_back(last);
+                }
+                output.push_back(last);
+                output.push_back(strip.front());
+            }
+        }
+        output.insert(output.end(), strip.begin(), strip.end());
+    }
+    return output;
+}
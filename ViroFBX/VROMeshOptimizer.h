@@ -0,0 +1,123 @@
+//
+//  VROMeshOptimizer.h
+//  ViroFBX
+//
+//  Copyright © 2017 Viro. All rights reserved.
+//
+
+#ifndef VROMeshOptimizer_h
+#define VROMeshOptimizer_h
+
+#include <stdio.h>
+#include <stdint.h>
+#include <vector>
+
+class VROMeshData;
+
+/*
+ Size of the FIFO post-transform cache that is simulated when analyzing an index
+ buffer. This is a conservative estimate of the cache size on mobile GPUs.
+ */
+static const int kVertexCacheAnalysisSize = 16;
+
+/*
+ Post-transform vertex cache efficiency of a triangle list. ACMR (average cache miss
+ ratio) is the number of vertices transformed per triangle; it ranges from 0.5 (ideal)
+ to 3.0 (no reuse). ATVR (average transform to vertex ratio) is the number of vertices
+ transformed per unique vertex referenced; it is 1.0 when each vertex is transformed
+ only once.
+ */
+class VROVertexCacheStats {
+public:
+    int verticesTransformed;
+    float acmr;
+    float atvr;
+
+    VROVertexCacheStats() :
+        verticesTransformed(0),
+        acmr(0),
+        atvr(0) {}
+};
+
+/*
+ Simulate a FIFO post-transform cache of the given size over the triangle list, and
+ return the resulting cache statistics.
+ */
+VROVertexCacheStats analyzeVertexCache(const std::vector<uint32_t> &indices, int numVertices,
+                                       int cacheSize = kVertexCacheAnalysisSize);
+
+/*
+ Reorder the triangles in the given triangle list for post-transform vertex cache
+ locality, using Tom Forsyth's linear-speed vertex cache optimization. The vertices
+ themselves are not moved.
+ */
+void optimizeVertexCache(std::vector<uint32_t> &indices, int numVertices);
+
+/*
+ Default for the ACMR threshold used when optimizing for overdraw: clusters may be
+ split as long as the cache miss ratio within them stays within this factor of the
+ cache-optimized ratio.
+ */
+static const float kDefaultOverdrawThreshold = 1.05f;
+
+/*
+ Reorder the triangles in the given (vertex cache optimized) triangle list to reduce
+ overdraw. The list is split into clusters along the boundaries of the cache optimized
+ order, and the clusters are sorted so that those facing outward from the center of the
+ mesh draw first; these are most likely to occlude the others. The threshold bounds the
+ vertex cache efficiency lost to the extra cluster splits. The result depends only on
+ the input, so repeated exports are identical.
+ */
+void optimizeOverdraw(std::vector<uint32_t> &indices, const std::vector<float> &positions,
+                      int numVertices, float threshold = kDefaultOverdrawThreshold);
+
+/*
+ Reorder the vertices of the mesh into the order in which they are first referenced
+ by its elements, so that vertex fetch is sequential. Vertices that are not referenced
+ by any element are removed. Returns the new vertex count.
+ */
+int optimizeVertexFetch(VROMeshData *mesh);
+
+/*
+ Triangles with an area below this fraction of their longest edge squared are
+ considered zero-area. This catches collinear corners up to floating point error.
+ */
+static const float kZeroAreaTolerance = 1e-6f;
+
+/*
+ Counts of the geometry removed by cleanupMesh().
+ */
+class VROCleanupStats {
+public:
+    int collapsedTriangles;
+    int zeroAreaTriangles;
+    int duplicateTriangles;
+    int unreferencedVertices;
+
+    VROCleanupStats() :
+        collapsedTriangles(0),
+        zeroAreaTriangles(0),
+        duplicateTriangles(0),
+        unreferencedVertices(0) {}
+};
+
+/*
+ Remove triangles that render nothing or render the same pixels twice: triangles
+ that reference a vertex more than once (typically collapsed by welding), zero-area
+ triangles, and repeats of a triangle already in the same element. For elements
+ marked double-sided, a triangle with the opposite winding of an earlier one is also
+ a repeat. Vertices no longer referenced by any element are then removed, with the
+ order of the remaining vertices retained.
+ */
+VROCleanupStats cleanupMesh(VROMeshData *mesh, const std::vector<bool> &doubleSidedElements);
+
+/*
+ Convert the given triangle list into a single triangle strip, preserving the winding
+ of every triangle. Strips are grown greedily across shared edges, starting from the
+ triangles in list order so that a cache-optimized order is largely retained. Separate
+ strips are joined with restartIndex if primitiveRestart is true, and otherwise are
+ stitched together with degenerate triangles. Degenerate input triangles are dropped.
+ */
+std::vector<uint32_t> stripify(const std::vector<uint32_t> &indices, bool primitiveRestart, uint32_t restartIndex);
+
+#endif /* VROMeshOptimizer_h */
@@ -0,0 +1,657 @@
+//
+//  VROMeshSimplifier.cpp
+//  ViroFBX
+//
+//  Copyright © 2017 Viro. All rights reserved.
+//
+
+#include "VROMeshSimplifier.h"
+#include "VROMeshData.h"
+#include "VROLog.h"
+#include "glm.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+/*
+ Weight of the planes that hold open borders in place, relative to the planes of
+ the faces themselves.
+ */
+static const double kBorderQuadricWeight = 10.0;
+
+enum class VROVertexKind {
+    Manifold, // May collapse onto any neighbor
+    Border,   // On an open border; may only collapse along the border
+    Locked,   // Never collapses, though other vertices may collapse onto it
+};
+
+#pragma mark - Quadrics
+
+/*
+ Symmetric 4x4 matrix accumulating the squared distance to a set of weighted planes,
+ as in Garland and Heckbert. The weight is the total weight of the planes, so that
+ the error can be reported as an average squared distance.
+ */
+class VROQuadric {
+public:
+    double a2, b2, c2, ab, ac, bc, ad, bd, cd, d2;
+    double weight;
+
+    VROQuadric() :
+        a2(0), b2(0), c2(0), ab(0), ac(0), bc(0), ad(0), bd(0), cd(0), d2(0), weight(0) {}
+
+    /*
+     Add the plane dot(normal, p) + d = 0. The normal must be unit length.
+     */
+    void addPlane(glm::dvec3 normal, double d, double w) {
+        a2 += w * normal.x * normal.x;
+        b2 += w * normal.y * normal.y;
+        c2 += w * normal.z * normal.z;
+        ab += w * normal.x * normal.y;
+        ac += w * normal.x * normal.z;
+        bc += w * normal.y * normal.z;
+        ad += w * normal.x * d;
+        bd += w * normal.y * d;
+        cd += w * normal.z * d;
+        d2 += w * d * d;
+        weight += w;
+    }
+
+    void add(const VROQuadric &q) {
+        a2 += q.a2; b2 += q.b2; c2 += q.c2;
+        ab += q.ab; ac += q.ac; bc += q.bc;
+        ad += q.ad; bd += q.bd; cd += q.cd;
+        d2 += q.d2;
+        weight += q.weight;
+    }
+
+    /*
+     Weighted average of the squared distances from p to the planes.
+     */
+    double evaluate(glm::dvec3 p) const {
+        if (weight <= 0) {
+            return 0;
+        }
+        double error = a2 * p.x * p.x + b2 * p.y * p.y + c2 * p.z * p.z +
+                       2 * (ab * p.x * p.y + ac * p.x * p.z + bc * p.y * p.z) +
+                       2 * (ad * p.x + bd * p.y + cd * p.z) + d2;
+        return std::max(0.0, error / weight);
+    }
+};
+
+#pragma mark - Topology
+
+static uint64_t getEdgeKey(uint32_t a, uint32_t b) {
+    return ((uint64_t) a << 32) | b;
+}
+
+static bool hasEdge(const std::vector<uint64_t> &sortedEdges, uint32_t a, uint32_t b) {
+    return std::binary_search(sortedEdges.begin(), sortedEdges.end(), getEdgeKey(a, b));
+}
+
+static std::vector<uint64_t> buildSortedEdges(const std::vector<uint32_t> &indices) {
+    std::vector<uint64_t> edges;
+    edges.reserve(indices.size());
+    for (size_t t = 0; t < indices.size() / 3; t++) {
+        for (int k = 0; k < 3; k++) {
+            edges.push_back(getEdgeKey(indices[t * 3 + k], indices[t * 3 + (k + 1) % 3]));
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+    return edges;
+}
+
+/*
+ Classify each vertex by how it may move. See simplifyMesh() for the rules.
+ */
+static std::vector<VROVertexKind> classifyVertices(const std::vector<uint32_t> &indices,
+                                                   const std::vector<int> &triangleElements,
+                                                   const std::vector<glm::dvec3> &positions) {
+    int numVertices = (int) positions.size();
+    std::vector<VROVertexKind> kinds(numVertices, VROVertexKind::Manifold);
+
+    /*
+     Material boundaries: vertices referenced by more than one element.
+     */
+    std::vector<int> vertexElements(numVertices, -1);
+    for (size_t i = 0; i < indices.size(); i++) {
+        uint32_t v = indices[i];
+        int element = triangleElements[i / 3];
+        if (vertexElements[v] < 0) {
+            vertexElements[v] = element;
+        }
+        else if (vertexElements[v] != element) {
+            kinds[v] = VROVertexKind::Locked;
+        }
+    }
+
+    /*
+     Attribute seams: referenced vertices that share a position with another.
+     */
+    std::vector<uint32_t> referenced;
+    for (uint32_t v = 0; v < numVertices; v++) {
+        if (vertexElements[v] >= 0) {
+            referenced.push_back(v);
+        }
+    }
+    auto comparePositions = [&positions](uint32_t a, uint32_t b) {
+        const glm::dvec3 &pa = positions[a];
+        const glm::dvec3 &pb = positions[b];
+        if (pa.x != pb.x) {
+            return pa.x < pb.x;
+        }
+        if (pa.y != pb.y) {
+            return pa.y < pb.y;
+        }
+        return pa.z < pb.z;
+    };
+    std::sort(referenced.begin(), referenced.end(), comparePositions);
+    for (size_t i = 1; i < referenced.size(); i++) {
+        if (positions[referenced[i]] == positions[referenced[i - 1]]) {
+            kinds[referenced[i]] = VROVertexKind::Locked;
+            kinds[referenced[i - 1]] = VROVertexKind::Locked;
+        }
+    }
+
+    /*
+     Borders: a directed edge without its opposite is open. A vertex with exactly one
+     open edge in and one out lies on a simple border; anything else (edges used twice
+     in the same direction, or several borders meeting) is locked.
+     */
+    std::vector<uint64_t> edges = buildSortedEdges(indices);
+    std::vector<int> openIn(numVertices, 0);
+    std::vector<int> openOut(numVertices, 0);
+    for (size_t i = 0; i < edges.size(); i++) {
+        uint32_t a = (uint32_t) (edges[i] >> 32);
+        uint32_t b = (uint32_t) (edges[i] & 0xFFFFFFFF);
+
+        if (i > 0 && edges[i] == edges[i - 1]) {
+            kinds[a] = VROVertexKind::Locked;
+            kinds[b] = VROVertexKind::Locked;
+        }
+        if (!hasEdge(edges, b, a)) {
+            openOut[a]++;
+            openIn[b]++;
+        }
+    }
+    for (int v = 0; v < numVertices; v++) {
+        if (kinds[v] != VROVertexKind::Manifold || (openIn[v] == 0 && openOut[v] == 0)) {
+            continue;
+        }
+        kinds[v] = (openIn[v] == 1 && openOut[v] == 1) ? VROVertexKind::Border : VROVertexKind::Locked;
+    }
+    return kinds;
+}
+
+static std::vector<VROQuadric> buildQuadrics(const std::vector<uint32_t> &indices,
+                                             const std::vector<glm::dvec3> &positions) {
+    std::vector<VROQuadric> quadrics(positions.size());
+    std::vector<uint64_t> edges = buildSortedEdges(indices);
+
+    for (size_t t = 0; t < indices.size() / 3; t++) {
+        const uint32_t *triangle = &indices[t * 3];
+        glm::dvec3 p0 = positions[triangle[0]];
+        glm::dvec3 normal = glm::cross(positions[triangle[1]] - p0, positions[triangle[2]] - p0);
+        double area = glm::length(normal);
+        if (area <= 0) {
+            continue;
+        }
+        normal /= area;
+
+        for (int k = 0; k < 3; k++) {
+            quadrics[triangle[k]].addPlane(normal, -glm::dot(normal, p0), area);
+        }
+
+        /*
+         Open borders have no face on the other side to hold them in place, so add a
+         plane through the edge, perpendicular to the face.
+         */
+        for (int k = 0; k < 3; k++) {
+            uint32_t a = triangle[k];
+            uint32_t b = triangle[(k + 1) % 3];
+            if (hasEdge(edges, b, a)) {
+                continue;
+            }
+
+            glm::dvec3 edge = positions[b] - positions[a];
+            double length = glm::length(edge);
+            glm::dvec3 borderNormal = glm::cross(edge, normal);
+            if (length <= 0 || glm::length(borderNormal) <= 0) {
+                continue;
+            }
+            borderNormal = glm::normalize(borderNormal);
+
+            double d = -glm::dot(borderNormal, positions[a]);
+            quadrics[a].addPlane(borderNormal, d, length * length * kBorderQuadricWeight);
+            quadrics[b].addPlane(borderNormal, d, length * length * kBorderQuadricWeight);
+        }
+    }
+    return quadrics;
+}
+
+#pragma mark - Edge Collapse
+
+class VROEdgeCollapse {
+public:
+    uint32_t from;
+    uint32_t to;
+    double cost;
+
+    VROEdgeCollapse(uint32_t f, uint32_t t, double c) :
+        from(f), to(t), cost(c) {}
+
+    bool operator<(const VROEdgeCollapse &other) const {
+        if (cost != other.cost) {
+            return cost < other.cost;
+        }
+        if (from != other.from) {
+            return from < other.from;
+        }
+        return to < other.to;
+    }
+};
+
+/*
+ Surviving triangles may not rotate by more than acos(kMaxNormalRotationCos), about
+ 75 degrees, in a single collapse. Near-perpendicular rotations are not strictly
+ flips, but leave folds in the surface.
+ */
+static const double kMaxNormalRotationCos = 0.25;
+
+/*
+ Returns true if moving vertex 'from' onto vertex 'to' would flip, fold, or collapse
+ to zero area any of the triangles around 'from' that survive the collapse.
+ */
+static bool collapseFlipsTriangle(uint32_t from, uint32_t to, const std::vector<uint32_t> &indices,
+                                  const std::vector<uint32_t> &adjacencyOffsets,
+                                  const std::vector<uint32_t> &adjacency,
+                                  const std::vector<glm::dvec3> &positions) {
+    for (uint32_t i = adjacencyOffsets[from]; i < adjacencyOffsets[from + 1]; i++) {
+        const uint32_t *triangle = &indices[adjacency[i] * 3];
+        if (triangle[0] == to || triangle[1] == to || triangle[2] == to) {
+            continue;
+        }
+
+        glm::dvec3 before[3];
+        glm::dvec3 after[3];
+        for (int k = 0; k < 3; k++) {
+            before[k] = positions[triangle[k]];
+            after[k] = triangle[k] == from ? positions[to] : before[k];
+        }
+
+        glm::dvec3 normalBefore = glm::cross(before[1] - before[0], before[2] - before[0]);
+        glm::dvec3 normalAfter = glm::cross(after[1] - after[0], after[2] - after[0]);
+        double rotationCos = glm::dot(normalBefore, normalAfter);
+        if (rotationCos <= kMaxNormalRotationCos * glm::length(normalBefore) * glm::length(normalAfter)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+#pragma mark - Simplification
+
+/*
+ The input of a simplification: every element's triangles in one list, so that the
+ vertices elements share are seen by all of them, with positions normalized by the
+ largest extent of the bounding box so that errors are relative to the size of the
+ mesh. Degenerate triangles are left out.
+ */
+class VROSimplifyInput {
+public:
+    std::vector<uint32_t> indices;
+    std::vector<int> triangleElements;
+    std::vector<int> triangleIds;
+    std::vector<glm::dvec3> positions;
+
+    VROSimplifyInput(const std::vector<std::vector<uint32_t>> &elements, const std::vector<float> &rawPositions,
+                     int numVertices) {
+        int id = 0;
+        for (int e = 0; e < elements.size(); e++) {
+            const std::vector<uint32_t> &element = elements[e];
+            for (size_t t = 0; t < element.size() / 3; t++, id++) {
+                uint32_t a = element[t * 3 + 0];
+                uint32_t b = element[t * 3 + 1];
+                uint32_t c = element[t * 3 + 2];
+                passert (a < numVertices && b < numVertices && c < numVertices);
+                if (a == b || b == c || a == c) {
+                    continue;
+                }
+                indices.insert(indices.end(), { a, b, c });
+                triangleElements.push_back(e);
+                triangleIds.push_back(id);
+            }
+        }
+
+        glm::dvec3 min(INFINITY);
+        glm::dvec3 max(-INFINITY);
+        for (uint32_t v : indices) {
+            glm::dvec3 p(rawPositions[v * 3 + 0], rawPositions[v * 3 + 1], rawPositions[v * 3 + 2]);
+            min = glm::min(min, p);
+            max = glm::max(max, p);
+        }
+        double extent = std::max(max.x - min.x, std::max(max.y - min.y, max.z - min.z));
+        if (indices.empty() || extent <= 0) {
+            min = glm::dvec3(0);
+            extent = 1;
+        }
+
+        positions.resize(numVertices);
+        for (int v = 0; v < numVertices; v++) {
+            glm::dvec3 p(rawPositions[v * 3 + 0], rawPositions[v * 3 + 1], rawPositions[v * 3 + 2]);
+            positions[v] = (p - min) / extent;
+        }
+    }
+};
+
+/*
+ Collapse edges of the input until it has at most targetTriangles triangles, or no
+ collapse within the error remains. The input's triangle lists are updated in place.
+ If outCollapses is not null, each collapse performed is appended to it; if
+ outRemovals is not null, it is indexed by triangle ID and receives the index of the
+ collapse that removed each triangle. Returns the squared error reached.
+ */
+static double collapseEdges(VROSimplifyInput &input, int targetTriangles, double maxErrorSquared,
+                            std::vector<VROVertexCollapse> *outCollapses, std::vector<int> *outRemovals) {
+    std::vector<uint32_t> &indices = input.indices;
+    const std::vector<glm::dvec3> &normalized = input.positions;
+    int numVertices = (int) normalized.size();
+    int numTriangles = (int) input.triangleElements.size();
+    if (numTriangles == 0) {
+        return 0;
+    }
+
+    std::vector<VROVertexKind> kinds = classifyVertices(indices, input.triangleElements, normalized);
+    std::vector<VROQuadric> quadrics = buildQuadrics(indices, normalized);
+    double errorSquared = 0;
+
+    std::vector<uint32_t> remap(numVertices);
+    std::vector<int> collapseIndices(numVertices, -1);
+    for (uint32_t v = 0; v < numVertices; v++) {
+        remap[v] = v;
+    }
+
+    /*
+     Each pass sorts every allowed collapse by cost, then performs the cheapest ones
+     whose neighborhoods do not overlap, so that the flip test for each collapse sees
+     the final positions of its neighbors. A manifold collapse removes two triangles,
+     so a pass stops after half of the triangles remaining to be removed.
+     */
+    while (numTriangles > targetTriangles) {
+        std::vector<uint64_t> edges = buildSortedEdges(indices);
+
+        std::vector<VROEdgeCollapse> collapses;
+        for (int t = 0; t < numTriangles; t++) {
+            for (int k = 0; k < 3; k++) {
+                uint32_t a = indices[t * 3 + k];
+                uint32_t b = indices[t * 3 + (k + 1) % 3];
+
+                // Interior edges appear once in each direction; consider each once
+                bool open = !hasEdge(edges, b, a);
+                if (!open && a > b) {
+                    continue;
+                }
+
+                uint32_t ends[2][2] = { { a, b }, { b, a } };
+                for (int d = 0; d < 2; d++) {
+                    uint32_t from = ends[d][0];
+                    uint32_t to = ends[d][1];
+                    if (kinds[from] == VROVertexKind::Manifold ||
+                            (kinds[from] == VROVertexKind::Border && open)) {
+                        collapses.push_back(VROEdgeCollapse(from, to, quadrics[from].evaluate(normalized[to])));
+                    }
+                }
+            }
+        }
+        std::sort(collapses.begin(), collapses.end());
+
+        std::vector<uint32_t> adjacencyOffsets(numVertices + 1, 0);
+        for (uint32_t v : indices) {
+            adjacencyOffsets[v + 1]++;
+        }
+        for (int v = 0; v < numVertices; v++) {
+            adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+        }
+        std::vector<uint32_t> adjacency(indices.size());
+        std::vector<uint32_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+        for (size_t i = 0; i < indices.size(); i++) {
+            adjacency[fill[indices[i]]++] = (uint32_t) (i / 3);
+        }
+
+        int collapseLimit = std::max(1, (numTriangles - targetTriangles) / 2);
+        std::vector<uint32_t> collapsed;
+        std::vector<bool> touched(numVertices, false);
+
+        for (const VROEdgeCollapse &collapse : collapses) {
+            if (collapse.cost > maxErrorSquared || collapsed.size() >= collapseLimit) {
+                break;
+            }
+            if (touched[collapse.from] || touched[collapse.to]) {
+                continue;
+            }
+            if (collapseFlipsTriangle(collapse.from, collapse.to, indices, adjacencyOffsets, adjacency, normalized)) {
+                continue;
+            }
+
+            remap[collapse.from] = collapse.to;
+            quadrics[collapse.to].add(quadrics[collapse.from]);
+            errorSquared = std::max(errorSquared, collapse.cost);
+            collapsed.push_back(collapse.from);
+
+            if (outCollapses != nullptr) {
+                collapseIndices[collapse.from] = (int) outCollapses->size();
+                outCollapses->push_back(VROVertexCollapse(collapse.from, collapse.to, (float) std::sqrt(errorSquared)));
+            }
+
+            touched[collapse.to] = true;
+            for (uint32_t i = adjacencyOffsets[collapse.from]; i < adjacencyOffsets[collapse.from + 1]; i++) {
+                const uint32_t *triangle = &indices[adjacency[i] * 3];
+                touched[triangle[0]] = true;
+                touched[triangle[1]] = true;
+                touched[triangle[2]] = true;
+            }
+        }
+
+        if (collapsed.empty()) {
+            break;
+        }
+
+        /*
+         Apply the collapses and drop the triangles that became degenerate. Collapses
+         in a pass have disjoint neighborhoods, so each dropped triangle was removed by
+         the single collapse of one of its vertices.
+         */
+        int remaining = 0;
+        for (int t = 0; t < numTriangles; t++) {
+            uint32_t a = remap[indices[t * 3 + 0]];
+            uint32_t b = remap[indices[t * 3 + 1]];
+            uint32_t c = remap[indices[t * 3 + 2]];
+            if (a == b || b == c || a == c) {
+                if (outRemovals != nullptr) {
+                    int removedBy = -1;
+                    for (int k = 0; k < 3; k++) {
+                        removedBy = std::max(removedBy, collapseIndices[indices[t * 3 + k]]);
+                    }
+                    (*outRemovals)[input.triangleIds[t]] = removedBy;
+                }
+                continue;
+            }
+            indices[remaining * 3 + 0] = a;
+            indices[remaining * 3 + 1] = b;
+            indices[remaining * 3 + 2] = c;
+            input.triangleElements[remaining] = input.triangleElements[t];
+            input.triangleIds[remaining] = input.triangleIds[t];
+            remaining++;
+        }
+        numTriangles = remaining;
+        indices.resize(numTriangles * 3);
+        input.triangleElements.resize(numTriangles);
+        input.triangleIds.resize(numTriangles);
+
+        for (uint32_t from : collapsed) {
+            remap[from] = from;
+        }
+    }
+    return errorSquared;
+}
+
+float simplifyMesh(const std::vector<std::vector<uint32_t>> &elements, const std::vector<float> &positions,
+                   int numVertices, float targetRatio, float maxError,
+                   std::vector<std::vector<uint32_t>> *outElements) {
+    outElements->clear();
+    outElements->resize(elements.size());
+
+    VROSimplifyInput input(elements, positions, numVertices);
+    int numTriangles = (int) input.triangleElements.size();
+    int targetTriangles = (int) (numTriangles * std::max(0.0f, std::min(1.0f, targetRatio)));
+
+    double errorSquared = collapseEdges(input, targetTriangles, (double) maxError * maxError, nullptr, nullptr);
+
+    for (int t = 0; t < input.triangleElements.size(); t++) {
+        std::vector<uint32_t> &element = (*outElements)[input.triangleElements[t]];
+        element.insert(element.end(), input.indices.begin() + t * 3, input.indices.begin() + t * 3 + 3);
+    }
+    return (float) std::sqrt(errorSquared);
+}
+
+#pragma mark - Progressive Meshes
+
+void buildProgressiveMesh(VROMeshData *mesh, float maxError, std::vector<uint32_t> *outParents,
+                          std::vector<VROProgressiveLevel> *outLevels) {
+    int numVertices = mesh->getVertexCount();
+    outParents->clear();
+    outLevels->clear();
+
+    int numInputTriangles = 0;
+    for (const std::vector<uint32_t> &element : mesh->elements) {
+        numInputTriangles += (int) element.size() / 3;
+    }
+
+    /*
+     Simplify as far as the error allows, recording the collapse that removes each
+     triangle. Triangles that are never removed get the collapse count (they belong to
+     the base mesh), and triangles that were degenerate to begin with get -1.
+     */
+    VROSimplifyInput input(mesh->elements, mesh->positions, numVertices);
+    std::vector<VROVertexCollapse> collapses;
+    std::vector<int> removals(numInputTriangles, -1);
+    for (int id : input.triangleIds) {
+        removals[id] = std::numeric_limits<int>::max();
+    }
+    collapseEdges(input, 0, (double) maxError * maxError, &collapses, &removals);
+
+    int numCollapses = (int) collapses.size();
+    for (int &removal : removals) {
+        removal = std::min(removal, numCollapses);
+    }
+
+    /*
+     Order the vertices with the base mesh first, followed by the collapsed vertices
+     in reverse collapse order, so that every vertex split appends one vertex. Each
+     collapsed vertex's parent is the vertex it collapsed onto, which is always
+     earlier in this order. Unreferenced vertices are dropped.
+     */
+    std::vector<bool> referenced(numVertices, false);
+    for (const std::vector<uint32_t> &element : mesh->elements) {
+        for (uint32_t index : element) {
+            referenced[index] = true;
+        }
+    }
+    std::vector<bool> collapsed(numVertices, false);
+    for (const VROVertexCollapse &collapse : collapses) {
+        collapsed[collapse.from] = true;
+    }
+
+    std::vector<uint32_t> remap(numVertices, kVertexUnused);
+    uint32_t next = 0;
+    for (int v = 0; v < numVertices; v++) {
+        if (referenced[v] && !collapsed[v]) {
+            remap[v] = next++;
+        }
+    }
+    int numBaseVertices = next;
+    for (int c = numCollapses - 1; c >= 0; c--) {
+        remap[collapses[c].from] = next++;
+    }
+
+    outParents->resize(next);
+    for (uint32_t v = 0; v < next; v++) {
+        (*outParents)[v] = v;
+    }
+    for (const VROVertexCollapse &collapse : collapses) {
+        (*outParents)[remap[collapse.from]] = remap[collapse.to];
+    }
+
+    /*
+     Order each element's triangles by decreasing removal index, so that the
+     triangles present after k vertex splits (those removed by one of the last k
+     collapses, or never) form a prefix. The sort is stable to retain as much of the
+     prior (cache optimized) order as possible within each split.
+     */
+    std::vector<std::vector<int>> elementRemovals(mesh->elements.size());
+    int id = 0;
+    for (int e = 0; e < mesh->elements.size(); e++) {
+        std::vector<uint32_t> &element = mesh->elements[e];
+        int numTriangles = (int) element.size() / 3;
+
+        std::vector<int> order(numTriangles);
+        for (int t = 0; t < numTriangles; t++) {
+            order[t] = t;
+        }
+        const int *elementRemoval = &removals[id];
+        std::stable_sort(order.begin(), order.end(), [elementRemoval](int a, int b) {
+            return elementRemoval[a] > elementRemoval[b];
+        });
+
+        std::vector<uint32_t> sorted(element.size());
+        for (int t = 0; t < numTriangles; t++) {
+            memcpy(&sorted[t * 3], &element[order[t] * 3], 3 * sizeof(uint32_t));
+            elementRemovals[e].push_back(elementRemoval[order[t]]);
+        }
+        element.swap(sorted);
+        id += numTriangles;
+    }
+    mesh->remapVertices(remap, next);
+
+    /*
+     Record a level at the base mesh and each time the triangle count doubles, and at
+     full detail. The level after k splits has had collapses [0, numCollapses - k)
+     applied, so its error is that of the last of these.
+     */
+    auto addLevel = [&](int splits) {
+        VROProgressiveLevel level;
+        level.vertexCount = numBaseVertices + splits;
+        level.error = (numCollapses - splits > 0) ? collapses[numCollapses - splits - 1].error : 0;
+        for (const std::vector<int> &elementRemoval : elementRemovals) {
+            int count = 0;
+            while (count < elementRemoval.size() && elementRemoval[count] >= numCollapses - splits) {
+                count++;
+            }
+            level.triangleCounts.push_back(count);
+        }
+        outLevels->push_back(level);
+    };
+
+    std::vector<int> numRemoved(numCollapses + 1, 0);
+    for (int removal : removals) {
+        if (removal >= 0) {
+            numRemoved[removal]++;
+        }
+    }
+    addLevel(0);
+
+    int numTriangles = numRemoved[numCollapses];
+    int nextLevelTriangles = std::max(1, numTriangles) * 2;
+    for (int k = 1; k < numCollapses; k++) {
+        // Split k undoes collapse numCollapses - k, restoring the triangles it removed
+        numTriangles += numRemoved[numCollapses - k];
+        if (numTriangles >= nextLevelTriangles) {
+            addLevel(k);
+            nextLevelTriangles = numTriangles * 2;
+        }
+    }
+    if (numCollapses > 0) {
+        addLevel(numCollapses);
+    }
+}
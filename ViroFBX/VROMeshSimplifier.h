@@ -0,0 +1,90 @@
+//
+//  VROMeshSimplifier.h
+//  ViroFBX
+//
+//  Copyright © 2017 Viro. All rights reserved.
+//
+
+#ifndef VROMeshSimplifier_h
+#define VROMeshSimplifier_h
+
+#include <stdio.h>
+#include <stdint.h>
+#include <vector>
+
+class VROMeshData;
+
+/*
+ Default for the maximum error a simplified mesh may deviate from the original,
+ relative to the largest extent of the mesh's bounding box.
+ */
+static const float kDefaultSimplifyMaxError = 0.01f;
+
+/*
+ Simplify the given elements (triangle lists sharing one vertex buffer) by quadric
+ error metric edge collapse, until the total triangle count reaches targetRatio of
+ the original or the next collapse would exceed maxError. Only the index buffers
+ change: each collapse moves a vertex onto one of its neighbors, so the simplified
+ elements index the same vertices as the originals.
+
+ Attribute discontinuities are preserved exactly. Vertices that share their position
+ with another vertex (UV seams and hard normal edges, which the welded vertex buffer
+ keeps as separate vertices), vertices referenced by more than one element (material
+ boundaries), and vertices on non-manifold edges never move. Vertices on open borders
+ only move along the border. Collapses that would flip a triangle are rejected.
+
+ The simplified elements are written to outElements, in the same order as the input.
+ Returns the error reached, relative to the largest extent of the bounding box.
+ */
+float simplifyMesh(const std::vector<std::vector<uint32_t>> &elements, const std::vector<float> &positions,
+                   int numVertices, float targetRatio, float maxError,
+                   std::vector<std::vector<uint32_t>> *outElements);
+
+/*
+ A single edge collapse: vertex 'from' moved onto its neighbor 'to'. The error is
+ the largest error reached by this or any earlier collapse.
+ */
+class VROVertexCollapse {
+public:
+    uint32_t from;
+    uint32_t to;
+    float error;
+
+    VROVertexCollapse(uint32_t f, uint32_t t, float e) :
+        from(f), to(t), error(e) {}
+};
+
+/*
+ A level of detail within a progressive mesh: drawing the first triangleCounts[e]
+ triangles of each element e, with every index at or beyond vertexCount replaced by
+ its parent (repeatedly) until it is below vertexCount, renders the mesh with the
+ given error.
+ */
+class VROProgressiveLevel {
+public:
+    int vertexCount;
+    std::vector<int> triangleCounts;
+    float error;
+
+    VROProgressiveLevel() :
+        vertexCount(0),
+        error(0) {}
+};
+
+/*
+ Reorder the vertices and triangles of the mesh into progressive mesh order. The
+ mesh is simplified as far as maxError allows, with the same rules as simplifyMesh();
+ the remaining vertices come first, followed by the collapsed vertices in reverse
+ collapse order, so that each vertex split appends a vertex. Each element's triangles
+ are ordered by the split that restores them. Any prefix of the vertices therefore
+ defines a coarser mesh, whose triangles are a prefix of each element.
+
+ outParents receives, for each vertex, the vertex it collapses onto (itself for the
+ vertices of the base mesh); parents always precede their children. outLevels
+ receives the base mesh, the levels at which the triangle count doubles, and the
+ full mesh.
+ */
+void buildProgressiveMesh(VROMeshData *mesh, float maxError, std::vector<uint32_t> *outParents,
+                          std::vector<VROProgressiveLevel> *outLevels);
+
+#endif /* VROMeshSimplifier_h */
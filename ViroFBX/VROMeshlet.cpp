@@ -0,0 +1,196 @@
+//
+//  VROMeshlet.cpp
+//  ViroFBX
+//
+//  Copyright © 2017 Viro. All rights reserved.
+//
+
+#include "VROMeshlet.h"
+#include "VROLog.h"
+#include "glm.hpp"
+#include <algorithm>
+#include <cmath>
+
+static glm::vec3 getPosition(const std::vector<float> &positions, uint32_t vertex) {
+    return glm::vec3(positions[vertex * 3 + 0], positions[vertex * 3 + 1], positions[vertex * 3 + 2]);
+}
+
+#pragma mark - Bounds
+
+/*
+ Compute the bounding sphere of the given vertices with Ritter's algorithm: start
+ from the sphere spanning two approximately farthest-apart vertices, then grow it to
+ include each vertex that lies outside.
+ */
+static void computeBoundingSphere(const std::vector<uint32_t> &vertices, const std::vector<float> &positions,
+                                  VROMeshlet *meshlet) {
+    glm::vec3 first = getPosition(positions, vertices[0]);
+    glm::vec3 a = first;
+    float maxDistance = 0;
+    for (uint32_t v : vertices) {
+        glm::vec3 p = getPosition(positions, v);
+        float distance = glm::dot(p - first, p - first);
+        if (distance > maxDistance) {
+            maxDistance = distance;
+            a = p;
+        }
+    }
+
+    glm::vec3 b = a;
+    maxDistance = 0;
+    for (uint32_t v : vertices) {
+        glm::vec3 p = getPosition(positions, v);
+        float distance = glm::dot(p - a, p - a);
+        if (distance > maxDistance) {
+            maxDistance = distance;
+            b = p;
+        }
+    }
+
+    glm::vec3 center = (a + b) * 0.5f;
+    float radius = glm::length(b - a) * 0.5f;
+    for (uint32_t v : vertices) {
+        glm::vec3 p = getPosition(positions, v);
+        float distance = glm::length(p - center);
+        if (distance > radius) {
+            float newRadius = (radius + distance) * 0.5f;
+            center += (p - center) * ((newRadius - radius) / distance);
+            radius = newRadius;
+        }
+    }
+
+    meshlet->center[0] = center.x;
+    meshlet->center[1] = center.y;
+    meshlet->center[2] = center.z;
+    meshlet->radius = radius;
+}
+
+/*
+ Compute the normal cone of the meshlet's triangles. The axis is the normalized
+ average of the unit face normals, and the cutoff is the sine of the angle between
+ the axis and the normal farthest from it. The apex is placed behind every triangle's
+ plane along the axis, so that the cull test holds for any point on the meshlet.
+ */
+static void computeNormalCone(const std::vector<uint32_t> &indices, const std::vector<float> &positions,
+                              VROMeshlet *meshlet) {
+    static const float kEpsilon = 1e-12f;
+
+    std::vector<glm::vec3> normals;
+    std::vector<glm::vec3> corners;
+    glm::vec3 sum(0, 0, 0);
+
+    for (int t = meshlet->triangleOffset; t < meshlet->triangleOffset + meshlet->triangleCount; t++) {
+        glm::vec3 p0 = getPosition(positions, indices[t * 3 + 0]);
+        glm::vec3 p1 = getPosition(positions, indices[t * 3 + 1]);
+        glm::vec3 p2 = getPosition(positions, indices[t * 3 + 2]);
+
+        // Degenerate triangles are never rasterized, so they do not constrain the cone
+        glm::vec3 normal = glm::cross(p1 - p0, p2 - p0);
+        float area = glm::length(normal);
+        if (area < kEpsilon) {
+            continue;
+        }
+        normal /= area;
+
+        normals.push_back(normal);
+        corners.push_back(p0);
+        sum += normal;
+    }
+
+    meshlet->coneCutoff = 1;
+    if (normals.empty() || glm::length(sum) < kEpsilon) {
+        return;
+    }
+
+    glm::vec3 axis = glm::normalize(sum);
+    meshlet->coneAxis[0] = axis.x;
+    meshlet->coneAxis[1] = axis.y;
+    meshlet->coneAxis[2] = axis.z;
+
+    float minDot = 1;
+    for (const glm::vec3 &normal : normals) {
+        minDot = std::min(minDot, glm::dot(normal, axis));
+    }
+
+    glm::vec3 center(meshlet->center[0], meshlet->center[1], meshlet->center[2]);
+    if (minDot <= 0) {
+        meshlet->coneApex[0] = center.x;
+        meshlet->coneApex[1] = center.y;
+        meshlet->coneApex[2] = center.z;
+        return;
+    }
+
+    float maxT = 0;
+    for (int i = 0; i < normals.size(); i++) {
+        float t = glm::dot(center - corners[i], normals[i]) / glm::dot(axis, normals[i]);
+        maxT = std::max(maxT, t);
+    }
+
+    glm::vec3 apex = center - axis * maxT;
+    meshlet->coneApex[0] = apex.x;
+    meshlet->coneApex[1] = apex.y;
+    meshlet->coneApex[2] = apex.z;
+    meshlet->coneCutoff = std::sqrt(1 - minDot * minDot);
+}
+
+#pragma mark - Meshlet Construction
+
+std::vector<VROMeshlet> buildMeshlets(const std::vector<uint32_t> &indices, const std::vector<float> &positions,
+                                      int numVertices, int maxVertices, int maxTriangles) {
+    passert (maxVertices >= 3 && maxTriangles >= 1);
+
+    std::vector<VROMeshlet> meshlets;
+    int numTriangles = (int) indices.size() / 3;
+    if (numTriangles == 0) {
+        return meshlets;
+    }
+
+    /*
+     Each vertex is stamped with the index of the last meshlet that used it, which
+     tells us in constant time whether a triangle's vertices are new to the current
+     meshlet.
+     */
+    std::vector<int> lastMeshlet(numVertices, -1);
+    std::vector<uint32_t> vertices;
+
+    VROMeshlet meshlet;
+    int meshletIndex = 0;
+
+    auto finish = [&]() {
+        meshlet.vertexCount = (int) vertices.size();
+        computeBoundingSphere(vertices, positions, &meshlet);
+        computeNormalCone(indices, positions, &meshlet);
+        meshlets.push_back(meshlet);
+
+        meshletIndex++;
+        meshlet = VROMeshlet();
+        vertices.clear();
+    };
+
+    for (int t = 0; t < numTriangles; t++) {
+        uint32_t a = indices[t * 3 + 0];
+        uint32_t b = indices[t * 3 + 1];
+        uint32_t c = indices[t * 3 + 2];
+
+        int newVertices = (lastMeshlet[a] != meshletIndex) +
+                          (lastMeshlet[b] != meshletIndex && b != a) +
+                          (lastMeshlet[c] != meshletIndex && c != a && c != b);
+
+        if (meshlet.triangleCount > 0 &&
+                (vertices.size() + newVertices > maxVertices || meshlet.triangleCount + 1 > maxTriangles)) {
+            finish();
+            meshlet.triangleOffset = t;
+        }
+
+        for (uint32_t v : { a, b, c }) {
+            if (lastMeshlet[v] != meshletIndex) {
+                lastMeshlet[v] = meshletIndex;
+                vertices.push_back(v);
+            }
+        }
+        meshlet.triangleCount++;
+    }
+    finish();
+
+    return meshlets;
+}
@@ -0,0 +1,74 @@
+//
+//  VROMeshlet.h
+//  ViroFBX
+//
+//  Copyright © 2017 Viro. All rights reserved.
+//
+
+#ifndef VROMeshlet_h
+#define VROMeshlet_h
+
+#include <stdio.h>
+#include <stdint.h>
+#include <vector>
+
+/*
+ Limits on the size of each meshlet. 64 vertices and 124 triangles fit the
+ per-workgroup output limits of mesh shaders on current GPUs, with the triangle
+ count chosen so that a meshlet's packed primitive indices fit in 512 bytes.
+ */
+static const int kMeshletMaxVertices = 64;
+static const int kMeshletMaxTriangles = 124;
+
+/*
+ A cluster of triangles covering the contiguous range [triangleOffset,
+ triangleOffset + triangleCount) of an element's triangles, with the bounds
+ needed to cull it as a unit.
+ */
+class VROMeshlet {
+public:
+    int triangleOffset;
+    int triangleCount;
+    int vertexCount;
+
+    /*
+     Sphere enclosing every vertex of the meshlet.
+     */
+    float center[3];
+    float radius;
+
+    /*
+     Cone enclosing the normals of every triangle of the meshlet. The meshlet faces
+     entirely away from a camera at position p, and can be culled, if:
+
+     dot(normalize(coneApex - p), coneAxis) >= coneCutoff
+
+     When the normals span a hemisphere or more, the cutoff is 1 and the test never
+     passes.
+     */
+    float coneApex[3];
+    float coneAxis[3];
+    float coneCutoff;
+
+    VROMeshlet() :
+        triangleOffset(0),
+        triangleCount(0),
+        vertexCount(0),
+        center{0, 0, 0},
+        radius(0),
+        coneApex{0, 0, 0},
+        coneAxis{0, 0, 0},
+        coneCutoff(1) {}
+};
+
+/*
+ Split the given triangle list into meshlets of at most maxVertices unique vertices
+ and maxTriangles triangles. Triangles are taken in their existing order, so each
+ meshlet covers a contiguous range of the list and the index buffer is unchanged;
+ running this after vertex cache optimization yields spatially coherent meshlets.
+ */
+std::vector<VROMeshlet> buildMeshlets(const std::vector<uint32_t> &indices, const std::vector<float> &positions,
+                                      int numVertices, int maxVertices = kMeshletMaxVertices,
+                                      int maxTriangles = kMeshletMaxTriangles);
+
+#endif /* VROMeshlet_h */
@@ -0,0 +1,469 @@
+//
+//  VROTangentSpace.cpp
+//  ViroFBX
+//
+//  Copyright © 2017 Viro. All rights reserved.
+//
+
+#include "VROTangentSpace.h"
+#include "VROMeshData.h"
+#include "VROThreadPool.h"
+#include "VROLog.h"
+#include <cmath>
+#include <cfloat>
+#include <cstring>
+#include <algorithm>
+
+/*
+ Orientation of a triangle's UV mapping. Triangles whose UVs have no area have no
+ orientation of their own.
+ */
+static const char kOrientationMirrored = 0;
+static const char kOrientationPreserved = 1;
+static const char kOrientationDegenerate = 2;
+
+#pragma mark - Vector Math
+
+static inline void subtract(const float *a, const float *b, float *out) {
+    out[0] = a[0] - b[0];
+    out[1] = a[1] - b[1];
+    out[2] = a[2] - b[2];
+}
+
+static inline float dot(const float *a, const float *b) {
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+static inline void cross(const float *a, const float *b, float *out) {
+    out[0] = a[1] * b[2] - a[2] * b[1];
+    out[1] = a[2] * b[0] - a[0] * b[2];
+    out[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+static bool normalize(float *v) {
+    float length = sqrtf(dot(v, v));
+    if (!(length > FLT_MIN)) {
+        return false;
+    }
+    v[0] /= length;
+    v[1] /= length;
+    v[2] /= length;
+    return true;
+}
+
+/*
+ Remove from v its component along the normalized vector n.
+ */
+static void projectOntoPlane(float *v, const float *n) {
+    float d = dot(v, n);
+    v[0] -= n[0] * d;
+    v[1] -= n[1] * d;
+    v[2] -= n[2] * d;
+}
+
+static bool isZero(const float *v, int components) {
+    for (int i = 0; i < components; i++) {
+        if (v[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+ Angle at corner k of the triangle p, between its two edges. If normal is non-null
+ the edges are first projected onto the plane of the normal, as MikkTSpace does.
+ Returns zero if either edge is degenerate.
+ */
+static float cornerAngle(const float *p[3], int k, const float *normal) {
+    float a[3], b[3];
+    subtract(p[(k + 1) % 3], p[k], a);
+    subtract(p[(k + 2) % 3], p[k], b);
+    if (normal != nullptr) {
+        projectOntoPlane(a, normal);
+        projectOntoPlane(b, normal);
+    }
+    if (!normalize(a) || !normalize(b)) {
+        return 0;
+    }
+    return acosf(std::max(-1.0f, std::min(1.0f, dot(a, b))));
+}
+
+/*
+ Any unit vector perpendicular to the normalized vector n.
+ */
+static void perpendicular(const float *n, float *out) {
+    float axis[3] = { 0, 0, 0 };
+    float ax = fabsf(n[0]), ay = fabsf(n[1]), az = fabsf(n[2]);
+    axis[ax <= ay && ax <= az ? 0 : (ay <= az ? 1 : 2)] = 1;
+    cross(n, axis, out);
+    if (!normalize(out)) {
+        out[0] = 1;
+        out[1] = 0;
+        out[2] = 0;
+    }
+}
+
+#pragma mark - Corner Grouping
+
+/*
+ Gather the corners of every element's triangles into a single list of vertex indices.
+ */
+static std::vector<uint32_t> gatherCorners(const VROMeshData &mesh) {
+    std::vector<uint32_t> corners;
+    for (const std::vector<uint32_t> &element : mesh.elements) {
+        corners.insert(corners.end(), element.begin(), element.end());
+    }
+    return corners;
+}
+
+/*
+ FNV-1a over the raw bytes of the given floats.
+ */
+static uint32_t hashFloats(uint32_t hash, const float *values, int count) {
+    const unsigned char *bytes = reinterpret_cast<const unsigned char *>(values);
+    for (size_t i = 0; i < sizeof(float) * count; i++) {
+        hash ^= bytes[i];
+        hash *= 16777619;
+    }
+    return hash;
+}
+
+/*
+ Assign each corner the index of its group, where corners a and b are in the same
+ group if isEqual(a, b). Groups are numbered in order of first appearance, using an
+ open-addressed table as in VROMeshData::weld(). Returns the number of groups.
+ */
+template <typename Hash, typename Equal>
+static int groupCorners(int numCorners, const Hash &hash, const Equal &isEqual, std::vector<int> *outGroups) {
+    size_t tableSize = 1;
+    while (tableSize < (size_t)numCorners + numCorners / 4) {
+        tableSize *= 2;
+    }
+    std::vector<int> table(tableSize, -1);
+    outGroups->resize(numCorners);
+
+    int numGroups = 0;
+    for (int c = 0; c < numCorners; c++) {
+        size_t bucket = hash(c) & (tableSize - 1);
+        while (true) {
+            int entry = table[bucket];
+            if (entry < 0) {
+                table[bucket] = c;
+                (*outGroups)[c] = numGroups++;
+                break;
+            }
+            if (isEqual(entry, c)) {
+                (*outGroups)[c] = (*outGroups)[entry];
+                break;
+            }
+            bucket = (bucket + 1) & (tableSize - 1);
+        }
+    }
+    return numGroups;
+}
+
+/*
+ List the members of each group: the corners of group g are members[offsets[g]]
+ through members[offsets[g + 1] - 1], in increasing order, so that sums over a group
+ are taken in the same order however the groups are divided among threads.
+ */
+static void buildGroupTable(const std::vector<int> &groups, int numGroups,
+                            std::vector<int> *offsets, std::vector<int> *members) {
+    offsets->assign(numGroups + 1, 0);
+    for (int group : groups) {
+        (*offsets)[group + 1]++;
+    }
+    for (int g = 0; g < numGroups; g++) {
+        (*offsets)[g + 1] += (*offsets)[g];
+    }
+
+    members->resize(groups.size());
+    std::vector<int> next(offsets->begin(), offsets->end() - 1);
+    for (int c = 0; c < groups.size(); c++) {
+        (*members)[next[groups[c]]++] = c;
+    }
+}
+
+#pragma mark - Normals
+
+int generateNormals(VROMeshData *mesh, VROThreadPool *pool) {
+    passert (mesh->hasNormals);
+
+    int numVertices = mesh->getVertexCount();
+    std::vector<char> missing(numVertices);
+    int numMissing = 0;
+    for (int v = 0; v < numVertices; v++) {
+        missing[v] = isZero(&mesh->normals[v * 3], 3);
+        numMissing += missing[v];
+    }
+    if (numMissing == 0) {
+        return 0;
+    }
+
+    std::vector<uint32_t> corners = gatherCorners(*mesh);
+    int numCorners = (int) corners.size();
+    int numTriangles = numCorners / 3;
+    const float *positions = mesh->positions.data();
+
+    std::vector<float> weighted(numCorners * 3, 0);
+    dispatchRanges(pool, numTriangles, [&](int range, int start, int end) {
+        for (int t = start; t < end; t++) {
+            const float *p[3];
+            for (int k = 0; k < 3; k++) {
+                p[k] = positions + corners[t * 3 + k] * 3;
+            }
+
+            float e1[3], e2[3], normal[3];
+            subtract(p[1], p[0], e1);
+            subtract(p[2], p[0], e2);
+            cross(e1, e2, normal);
+            if (!normalize(normal)) {
+                continue;
+            }
+
+            for (int k = 0; k < 3; k++) {
+                float angle = cornerAngle(p, k, nullptr);
+                for (int i = 0; i < 3; i++) {
+                    weighted[(t * 3 + k) * 3 + i] = normal[i] * angle;
+                }
+            }
+        }
+    });
+
+    std::vector<int> groups, offsets, members;
+    int numGroups = groupCorners(numCorners, [&](int c) {
+        return hashFloats(2166136261, positions + corners[c] * 3, 3);
+    }, [&](int a, int b) {
+        return memcmp(positions + corners[a] * 3, positions + corners[b] * 3, sizeof(float) * 3) == 0;
+    }, &groups);
+    buildGroupTable(groups, numGroups, &offsets, &members);
+
+    /*
+     Every corner of a vertex shares its position, so each vertex is written by a
+     single group.
+     */
+    dispatchRanges(pool, numGroups, [&](int range, int start, int end) {
+        for (int g = start; g < end; g++) {
+            float normal[3] = { 0, 0, 0 };
+            for (int m = offsets[g]; m < offsets[g + 1]; m++) {
+                const float *contribution = &weighted[members[m] * 3];
+                normal[0] += contribution[0];
+                normal[1] += contribution[1];
+                normal[2] += contribution[2];
+            }
+            if (!normalize(normal)) {
+                normal[0] = 0;
+                normal[1] = 0;
+                normal[2] = 1;
+            }
+
+            for (int m = offsets[g]; m < offsets[g + 1]; m++) {
+                uint32_t vertex = corners[members[m]];
+                if (missing[vertex]) {
+                    memcpy(&mesh->normals[vertex * 3], normal, sizeof(float) * 3);
+                }
+            }
+        }
+    });
+    return numMissing;
+}
+
+#pragma mark - Tangents
+
+int generateTangents(VROMeshData *mesh, VROThreadPool *pool) {
+    passert (mesh->hasTangents && mesh->hasNormals && mesh->hasTexcoords);
+
+    int numVertices = mesh->getVertexCount();
+    std::vector<char> missing(numVertices);
+    bool anyMissing = false;
+    for (int v = 0; v < numVertices; v++) {
+        missing[v] = isZero(&mesh->tangents[v * 4], 4);
+        anyMissing |= missing[v];
+    }
+    if (!anyMissing) {
+        return 0;
+    }
+
+    std::vector<uint32_t> corners = gatherCorners(*mesh);
+    int numCorners = (int) corners.size();
+    int numTriangles = numCorners / 3;
+    const float *positions = mesh->positions.data();
+    const float *normals = mesh->normals.data();
+    const float *texcoords = mesh->texcoords.data();
+
+    /*
+     The texcoords have V flipped from the FBX, so V is flipped back here: the
+     orientation (and so the bitangent sign) is that of the source UV space, which is
+     what MikkTSpace bakers use and what the FBX SDK generated.
+     */
+    std::vector<char> orientation(numTriangles);
+    std::vector<float> weighted(numCorners * 3, 0);
+    dispatchRanges(pool, numTriangles, [&](int range, int start, int end) {
+        for (int t = start; t < end; t++) {
+            const float *p[3];
+            float uv[3][2];
+            for (int k = 0; k < 3; k++) {
+                uint32_t vertex = corners[t * 3 + k];
+                p[k] = positions + vertex * 3;
+                uv[k][0] = texcoords[vertex * 2 + 0];
+                uv[k][1] = 1 - texcoords[vertex * 2 + 1];
+            }
+
+            float d1[3], d2[3];
+            subtract(p[1], p[0], d1);
+            subtract(p[2], p[0], d2);
+            float t21x = uv[1][0] - uv[0][0], t21y = uv[1][1] - uv[0][1];
+            float t31x = uv[2][0] - uv[0][0], t31y = uv[2][1] - uv[0][1];
+            float signedArea = t21x * t31y - t21y * t31x;
+
+            float tangent[3];
+            for (int i = 0; i < 3; i++) {
+                tangent[i] = t31y * d1[i] - t21y * d2[i];
+            }
+            if (!(fabsf(signedArea) > FLT_MIN) || !normalize(tangent)) {
+                orientation[t] = kOrientationDegenerate;
+                continue;
+            }
+
+            // Point the tangent along +U even where the mapping is mirrored
+            orientation[t] = signedArea > 0 ? kOrientationPreserved : kOrientationMirrored;
+            if (signedArea < 0) {
+                tangent[0] = -tangent[0];
+                tangent[1] = -tangent[1];
+                tangent[2] = -tangent[2];
+            }
+
+            for (int k = 0; k < 3; k++) {
+                float normal[3];
+                memcpy(normal, normals + corners[t * 3 + k] * 3, sizeof(float) * 3);
+                if (!normalize(normal)) {
+                    continue;
+                }
+
+                float projected[3] = { tangent[0], tangent[1], tangent[2] };
+                projectOntoPlane(projected, normal);
+                if (!normalize(projected)) {
+                    continue;
+                }
+
+                float angle = cornerAngle(p, k, normal);
+                for (int i = 0; i < 3; i++) {
+                    weighted[(t * 3 + k) * 3 + i] = projected[i] * angle;
+                }
+            }
+        }
+    });
+
+    /*
+     Group the corners that would weld into one vertex, then sum each group's
+     contributions separately for each orientation.
+     */
+    std::vector<int> groups, offsets, members;
+    int numGroups = groupCorners(numCorners, [&](int c) {
+        uint32_t vertex = corners[c];
+        uint32_t hash = hashFloats(2166136261, positions + vertex * 3, 3);
+        hash = hashFloats(hash, normals + vertex * 3, 3);
+        return hashFloats(hash, texcoords + vertex * 2, 2);
+    }, [&](int a, int b) {
+        uint32_t va = corners[a], vb = corners[b];
+        return memcmp(positions + va * 3, positions + vb * 3, sizeof(float) * 3) == 0 &&
+               memcmp(normals + va * 3, normals + vb * 3, sizeof(float) * 3) == 0 &&
+               memcmp(texcoords + va * 2, texcoords + vb * 2, sizeof(float) * 2) == 0;
+    }, &groups);
+    buildGroupTable(groups, numGroups, &offsets, &members);
+
+    std::vector<float> cornerTangents(numCorners * 4);
+    dispatchRanges(pool, numGroups, [&](int range, int start, int end) {
+        for (int g = start; g < end; g++) {
+            char fallback = kOrientationPreserved;
+            for (int m = offsets[g]; m < offsets[g + 1]; m++) {
+                if (orientation[members[m] / 3] != kOrientationDegenerate) {
+                    fallback = orientation[members[m] / 3];
+                    break;
+                }
+            }
+
+            float sums[2][3] = { { 0, 0, 0 }, { 0, 0, 0 } };
+            for (int m = offsets[g]; m < offsets[g + 1]; m++) {
+                int o = orientation[members[m] / 3];
+                o = (o == kOrientationDegenerate) ? fallback : o;
+
+                const float *contribution = &weighted[members[m] * 3];
+                sums[o][0] += contribution[0];
+                sums[o][1] += contribution[1];
+                sums[o][2] += contribution[2];
+            }
+
+            float normal[3];
+            memcpy(normal, normals + corners[members[offsets[g]]] * 3, sizeof(float) * 3);
+            if (!normalize(normal)) {
+                normal[0] = 0;
+                normal[1] = 0;
+                normal[2] = 1;
+            }
+            for (int o = 0; o < 2; o++) {
+                if (!normalize(sums[o])) {
+                    perpendicular(normal, sums[o]);
+                }
+            }
+
+            for (int m = offsets[g]; m < offsets[g + 1]; m++) {
+                int o = orientation[members[m] / 3];
+                o = (o == kOrientationDegenerate) ? fallback : o;
+
+                float *tangent = &cornerTangents[members[m] * 4];
+                memcpy(tangent, sums[o], sizeof(float) * 3);
+                tangent[3] = (o == kOrientationPreserved) ? 1 : -1;
+            }
+        }
+    });
+
+    /*
+     Every corner of a vertex is in the same group, so corners can only disagree on a
+     vertex's tangent by orientation. The first corner's tangent is kept, and corners
+     of the other orientation are moved to a copy of the vertex.
+     */
+    std::vector<char> written(numVertices, 0);
+    std::vector<uint32_t> copies(numVertices, kVertexUnused);
+    std::vector<uint32_t> sources;
+    std::vector<int> sourceCorners;
+
+    for (int c = 0; c < numCorners; c++) {
+        uint32_t vertex = corners[c];
+        if (!missing[vertex]) {
+            continue;
+        }
+        const float *tangent = &cornerTangents[c * 4];
+        if (!written[vertex]) {
+            memcpy(&mesh->tangents[vertex * 4], tangent, sizeof(float) * 4);
+            written[vertex] = 1;
+            continue;
+        }
+        if (mesh->tangents[vertex * 4 + 3] == tangent[3]) {
+            continue;
+        }
+
+        if (copies[vertex] == kVertexUnused) {
+            copies[vertex] = numVertices + (uint32_t) sources.size();
+            sources.push_back(vertex);
+            sourceCorners.push_back(c);
+        }
+        corners[c] = copies[vertex];
+    }
+
+    if (!sources.empty()) {
+        mesh->duplicateVertices(sources);
+        for (int i = 0; i < sources.size(); i++) {
+            memcpy(&mesh->tangents[(numVertices + i) * 4], &cornerTangents[sourceCorners[i] * 4], sizeof(float) * 4);
+        }
+
+        int c = 0;
+        for (std::vector<uint32_t> &element : mesh->elements) {
+            for (uint32_t &index : element) {
+                index = corners[c++];
+            }
+        }
+    }
+    return (int) sources.size();
+}
@@ -0,0 +1,45 @@
+//
+//  VROTangentSpace.h
+//  ViroFBX
+//
+//  Copyright © 2017 Viro. All rights reserved.
+//
+
+#ifndef VROTangentSpace_h
+#define VROTangentSpace_h
+
+#include <stdio.h>
+#include <stdint.h>
+#include <vector>
+
+class VROMeshData;
+class VROThreadPool;
+
+/*
+ Generate a normal for each vertex of the mesh whose normal is zero (i.e. was not
+ present in the FBX). Each corner contributes its triangle's face normal weighted by
+ the corner's angle, and the contributions are summed over every corner at the same
+ position, so the result is smooth across UV seams. Vertices with a normal keep it.
+ The triangles are processed in parallel on the pool, which may be null. Returns the
+ number of vertices given a normal.
+ */
+int generateNormals(VROMeshData *mesh, VROThreadPool *pool);
+
+/*
+ Generate a tangent for each vertex of the mesh whose tangent is zero, following
+ MikkTSpace: each triangle's tangent is derived from its UV gradient and normalized,
+ then at each corner projected onto the plane of the vertex normal and weighted by
+ the corner's angle. Contributions are summed over corners with identical position,
+ normal, and UV that share the same UV orientation, and the w component is the
+ bitangent sign (+1 where the UV mapping preserves orientation, -1 where it is
+ mirrored). Triangles with degenerate UVs contribute nothing and adopt the orientation
+ of their neighbors.
+
+ The mesh must have normals and texcoords. A vertex used by both orientations is
+ split in two, with the mirrored corners moved to the copy. The triangles and vertex
+ groups are processed in parallel on the pool, which may be null, and the result is
+ identical however the work is divided. Returns the number of vertices split.
+ */
+int generateTangents(VROMeshData *mesh, VROThreadPool *pool);
+
+#endif /* VROTangentSpace_h */
@@ -0,0 +1,121 @@
+//
+//  VROThreadPool.cpp
+//  ViroFBX
+//
+//  Copyright © 2017 Viro. All rights reserved.
+//
+
+#include "VROThreadPool.h"
+#include <algorithm>
+
+VROThreadPool::VROThreadPool(int numThreads) :
+    _stop(false),
+    _generation(0),
+    _function(nullptr),
+    _count(0),
+    _numRanges(0),
+    _nextRange(0),
+    _rangesDone(0) {
+
+    if (numThreads <= 0) {
+        numThreads = std::max(1, (int) std::thread::hardware_concurrency());
+    }
+    _numThreads = numThreads;
+
+    // The thread calling parallelFor() processes ranges as well
+    for (int i = 0; i < _numThreads - 1; i++) {
+        _workers.push_back(std::thread(&VROThreadPool::runWorker, this));
+    }
+}
+
+VROThreadPool::~VROThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _workCondition.notify_all();
+
+    for (std::thread &worker : _workers) {
+        worker.join();
+    }
+}
+
+int VROThreadPool::getRangeCount(int count) const {
+    return std::max(1, std::min(count, _numThreads));
+}
+
+void VROThreadPool::parallelFor(int count, const VRORangeFunction &function) {
+    int numRanges = getRangeCount(count);
+    if (numRanges == 1) {
+        function(0, 0, count);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _function = &function;
+        _count = count;
+        _numRanges = numRanges;
+        _nextRange = 0;
+        _rangesDone = 0;
+        _generation++;
+    }
+    _workCondition.notify_all();
+
+    runRanges();
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    _doneCondition.wait(lock, [this] { return _rangesDone == _numRanges; });
+    _function = nullptr;
+}
+
+void VROThreadPool::runWorker() {
+    uint64_t generation = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _workCondition.wait(lock, [this, generation] { return _stop || _generation != generation; });
+            if (_stop) {
+                return;
+            }
+            generation = _generation;
+        }
+        runRanges();
+    }
+}
+
+void VROThreadPool::runRanges() {
+    while (true) {
+        int range, count, numRanges;
+        const VRORangeFunction *function;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_function == nullptr || _nextRange >= _numRanges) {
+                return;
+            }
+            range = _nextRange++;
+            count = _count;
+            numRanges = _numRanges;
+            function = _function;
+        }
+
+        int start = (int) ((int64_t) count * range / numRanges);
+        int end = (int) ((int64_t) count * (range + 1) / numRanges);
+        (*function)(range, start, end);
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        _rangesDone++;
+        if (_rangesDone == _numRanges) {
+            _doneCondition.notify_all();
+        }
+    }
+}
+
+void dispatchRanges(VROThreadPool *pool, int count, const VRORangeFunction &function) {
+    if (pool != nullptr) {
+        pool->parallelFor(count, function);
+    }
+    else {
+        function(0, 0, count);
+    }
+}
@@ -0,0 +1,90 @@
+//
+//  VROThreadPool.h
+//  ViroFBX
+//
+//  Copyright © 2017 Viro. All rights reserved.
+//
+
+#ifndef VROThreadPool_h
+#define VROThreadPool_h
+
+#include <stdio.h>
+#include <stdint.h>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+/*
+ Function invoked on a contiguous range [start, end) of items. The range index
+ identifies the range among all ranges of the same job, from 0 to getRangeCount().
+ */
+typedef std::function<void(int range, int start, int end)> VRORangeFunction;
+
+/*
+ A fixed set of worker threads used to process large arrays in parallel. Work is
+ submitted with parallelFor(), which splits the items into contiguous ranges and
+ blocks until every range is processed. The split depends only on the item count
+ and the thread count, so callers can precompute per-range output offsets and
+ produce results identical to a serial pass.
+ */
+class VROThreadPool {
+public:
+
+    /*
+     Create a pool with the given number of threads, including the calling thread.
+     If numThreads is 0, one thread per hardware core is used.
+     */
+    VROThreadPool(int numThreads = 0);
+    virtual ~VROThreadPool();
+
+    int getNumThreads() const {
+        return _numThreads;
+    }
+
+    /*
+     Number of ranges parallelFor() splits the given number of items into.
+     */
+    int getRangeCount(int count) const;
+
+    /*
+     Split [0, count) into getRangeCount(count) contiguous ranges of nearly equal
+     size, and invoke the function on each in parallel. Returns when all ranges are
+     complete. Must not be called from within a range function.
+     */
+    void parallelFor(int count, const VRORangeFunction &function);
+
+private:
+
+    int _numThreads;
+    std::vector<std::thread> _workers;
+
+    std::mutex _mutex;
+    std::condition_variable _workCondition;
+    std::condition_variable _doneCondition;
+    bool _stop;
+
+    /*
+     The job in progress. The generation is incremented for each job so that
+     workers can tell a new job from the one they last worked on.
+     */
+    uint64_t _generation;
+    const VRORangeFunction *_function;
+    int _count;
+    int _numRanges;
+    int _nextRange;
+    int _rangesDone;
+
+    void runWorker();
+    void runRanges();
+
+};
+
+/*
+ Invoke the function on the ranges of [0, count) using the given pool, or on the
+ single range [0, count) on the calling thread if the pool is null.
+ */
+void dispatchRanges(VROThreadPool *pool, int count, const VRORangeFunction &function);
+
+#endif /* VROThreadPool_h */
@@ -0,0 +1,319 @@
+//
+//  VROVertexLayout.cpp
+//  ViroFBX
+//
+//  Copyright © 2017 Viro. All rights reserved.
+//
+
+#include "VROVertexLayout.h"
+#include "VROLog.h"
+#include "glm.hpp"
+#include "gtc/packing.hpp"
+#include "gtc/quaternion.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+int getBytesPerComponent(VROVertexFormat format) {
+    switch (format) {
+        case VROVertexFormat::Float:
+            return 4;
+        case VROVertexFormat::Half:
+        case VROVertexFormat::SNorm16:
+        case VROVertexFormat::UNorm16:
+            return 2;
+    }
+    return 4;
+}
+
+#pragma mark - Quantization
+
+/*
+ Encode a single component into the given format, writing getBytesPerComponent() bytes.
+ */
+static void encodeComponent(float value, VROVertexFormat format, float scale, float offset, char *out) {
+    float normalized = (value - offset) / scale;
+
+    switch (format) {
+        case VROVertexFormat::Float: {
+            memcpy(out, &value, sizeof(float));
+            break;
+        }
+        case VROVertexFormat::Half: {
+            uint16_t packed = glm::packHalf1x16(normalized);
+            memcpy(out, &packed, sizeof(uint16_t));
+            break;
+        }
+        case VROVertexFormat::SNorm16: {
+            uint16_t packed = glm::packSnorm1x16(normalized);
+            memcpy(out, &packed, sizeof(uint16_t));
+            break;
+        }
+        case VROVertexFormat::UNorm16: {
+            uint16_t packed = glm::packUnorm1x16(normalized);
+            memcpy(out, &packed, sizeof(uint16_t));
+            break;
+        }
+    }
+}
+
+/*
+ Decode a single component encoded by encodeComponent(), as the renderer would.
+ */
+static float decodeComponent(const char *in, VROVertexFormat format, float scale, float offset) {
+    if (format == VROVertexFormat::Float) {
+        float value;
+        memcpy(&value, in, sizeof(float));
+        return value;
+    }
+
+    uint16_t packed;
+    memcpy(&packed, in, sizeof(uint16_t));
+
+    float normalized = 0;
+    if (format == VROVertexFormat::Half) {
+        normalized = glm::unpackHalf1x16(packed);
+    }
+    else if (format == VROVertexFormat::SNorm16) {
+        normalized = glm::unpackSnorm1x16(packed);
+    }
+    else {
+        normalized = glm::unpackUnorm1x16(packed);
+    }
+    return normalized * scale + offset;
+}
+
+void fitQuantizationRange(const float *data, int numVertices, int components, VROVertexFormat format,
+                          std::vector<float> *outScale, std::vector<float> *outOffset) {
+    outScale->assign(components, 1);
+    outOffset->assign(components, 0);
+    if (numVertices == 0) {
+        return;
+    }
+
+    for (int c = 0; c < components; c++) {
+        float min = data[c];
+        float max = data[c];
+        for (int v = 1; v < numVertices; v++) {
+            min = std::min(min, data[v * components + c]);
+            max = std::max(max, data[v * components + c]);
+        }
+
+        float extent = max - min;
+        if (format == VROVertexFormat::SNorm16) {
+            (*outOffset)[c] = (min + max) / 2;
+            (*outScale)[c] = extent > 0 ? extent / 2 : 1;
+        }
+        else if (format == VROVertexFormat::UNorm16) {
+            (*outOffset)[c] = min;
+            (*outScale)[c] = extent > 0 ? extent : 1;
+        }
+    }
+}
+
+float measureQuantizationError(const float *data, int numVertices, int components, VROVertexFormat format,
+                               const std::vector<float> &scale, const std::vector<float> &offset) {
+    float maxError = 0;
+    char encoded[sizeof(float)];
+
+    for (int v = 0; v < numVertices; v++) {
+        for (int c = 0; c < components; c++) {
+            float value = data[v * components + c];
+            float s = scale.empty() ? 1 : scale[c];
+            float o = offset.empty() ? 0 : offset[c];
+
+            encodeComponent(value, format, s, o, encoded);
+            float error = std::abs(decodeComponent(encoded, format, s, o) - value);
+
+            // Non-finite round trips (e.g. half overflow) can never be within tolerance
+            if (!std::isfinite(error)) {
+                return INFINITY;
+            }
+            maxError = std::max(maxError, error);
+        }
+    }
+    return maxError;
+}
+
+#pragma mark - QTangents
+
+void encodeQTangents(const float *normals, const float *tangents, int numVertices,
+                     std::vector<float> *outQTangents) {
+    static const float kEpsilon = 1e-6f;
+    static const float kMinW = 1.0f / 32767.0f;
+
+    outQTangents->resize(numVertices * 4);
+    for (int v = 0; v < numVertices; v++) {
+        glm::vec3 n(normals[v * 3 + 0], normals[v * 3 + 1], normals[v * 3 + 2]);
+        glm::vec3 t(tangents[v * 4 + 0], tangents[v * 4 + 1], tangents[v * 4 + 2]);
+        float handedness = tangents[v * 4 + 3] < 0 ? -1 : 1;
+
+        /*
+         Orthonormalize the frame. Missing normals default to +Z, and missing (or
+         degenerate) tangents to any axis perpendicular to the normal.
+         */
+        if (glm::length(n) < kEpsilon) {
+            n = glm::vec3(0, 0, 1);
+        }
+        n = glm::normalize(n);
+        t = t - n * glm::dot(n, t);
+        if (glm::length(t) < kEpsilon) {
+            t = glm::cross(n, std::abs(n.x) < 0.9f ? glm::vec3(1, 0, 0) : glm::vec3(0, 1, 0));
+        }
+        t = glm::normalize(t);
+        glm::vec3 b = glm::cross(n, t);
+
+        glm::quat q = glm::normalize(glm::quat_cast(glm::mat3(t, b, n)));
+        if (q.w < 0) {
+            q = -q;
+        }
+        if (q.w < kMinW) {
+            float xyzScale = std::sqrt(1 - kMinW * kMinW) / glm::length(glm::vec3(q.x, q.y, q.z));
+            q = glm::quat(kMinW, q.x * xyzScale, q.y * xyzScale, q.z * xyzScale);
+        }
+        if (handedness < 0) {
+            q = -q;
+        }
+
+        float *out = &(*outQTangents)[v * 4];
+        out[0] = q.x;
+        out[1] = q.y;
+        out[2] = q.z;
+        out[3] = q.w;
+    }
+}
+
+#pragma mark - Skin
+
+std::string packBoneIndices(const int *indices, int count, int bytesPerComponent) {
+    passert (bytesPerComponent == 1 || bytesPerComponent == 2 || bytesPerComponent == 4);
+
+    std::string data(count * bytesPerComponent, 0);
+    for (int i = 0; i < count; i++) {
+        uint32_t index = (uint32_t) indices[i];
+        passert (bytesPerComponent == 4 || index < (1u << (bytesPerComponent * 8)));
+
+        // Little-endian, as the rest of the vertex data
+        for (int b = 0; b < bytesPerComponent; b++) {
+            data[i * bytesPerComponent + b] = (char) ((index >> (b * 8)) & 0xFF);
+        }
+    }
+    return data;
+}
+
+std::string quantizeBoneWeights(const float *weights, int numVertices, int influences, int bytesPerComponent) {
+    passert (bytesPerComponent == 1 || bytesPerComponent == 2);
+
+    int range = (1 << (bytesPerComponent * 8)) - 1;
+    std::string data(numVertices * influences * bytesPerComponent, 0);
+    std::vector<int> quantized(influences);
+
+    for (int v = 0; v < numVertices; v++) {
+        const float *vertexWeights = weights + v * influences;
+
+        float sum = 0;
+        int quantizedSum = 0;
+        int largest = 0;
+        for (int i = 0; i < influences; i++) {
+            float weight = std::max(0.0f, std::min(1.0f, vertexWeights[i]));
+            sum += weight;
+            quantized[i] = (int) std::lround(weight * range);
+            quantizedSum += quantized[i];
+            if (vertexWeights[i] > vertexWeights[largest]) {
+                largest = i;
+            }
+        }
+
+        int target = (int) std::min<long>(std::lround(sum * range), (long) range * influences);
+        quantized[largest] = std::max(0, std::min(range, quantized[largest] + target - quantizedSum));
+
+        for (int i = 0; i < influences; i++) {
+            for (int b = 0; b < bytesPerComponent; b++) {
+                data[(v * influences + i) * bytesPerComponent + b] = (char) ((quantized[i] >> (b * 8)) & 0xFF);
+            }
+        }
+    }
+    return data;
+}
+
+#pragma mark - Layout
+
+VROVertexLayout::VROVertexLayout(int numVertices) :
+    _numVertices(numVertices),
+    _stride(0) {
+
+}
+
+VROVertexLayout::~VROVertexLayout() {
+
+}
+
+VROVertexAttribute &VROVertexLayout::addAttribute(viro::Node_Geometry_Source_Semantic semantic, int components,
+                                                  VROVertexFormat format, const float *data, bool separate) {
+    VROVertexAttribute attribute(semantic, components, format, data, separate);
+    if (!separate) {
+        attribute.dataOffset = _stride;
+        _stride += attribute.getAlignedSize();
+    }
+
+    _attributes.push_back(attribute);
+    return _attributes.back();
+}
+
+void VROVertexLayout::writeAttribute(const VROVertexAttribute &attribute, int stride, char *out) const {
+    int bytesPerComponent = getBytesPerComponent(attribute.format);
+
+    for (int v = 0; v < _numVertices; v++) {
+        char *vertex = out + v * stride + attribute.dataOffset;
+        for (int c = 0; c < attribute.components; c++) {
+            float scale = attribute.scale.empty() ? 1 : attribute.scale[c];
+            float offset = attribute.offset.empty() ? 0 : attribute.offset[c];
+            encodeComponent(attribute.data[v * attribute.components + c], attribute.format, scale, offset,
+                            vertex + c * bytesPerComponent);
+        }
+    }
+}
+
+void VROVertexLayout::exportGeometry(viro::Node::Geometry *geo) const {
+    std::string data(_numVertices * _stride, 0);
+    for (const VROVertexAttribute &attribute : _attributes) {
+        if (!attribute.separate && !data.empty()) {
+            writeAttribute(attribute, _stride, &data[0]);
+        }
+    }
+    geo->set_data(data);
+
+    for (const VROVertexAttribute &attribute : _attributes) {
+        viro::Node::Geometry::Source *source = geo->add_source();
+        source->set_semantic(attribute.semantic);
+        source->set_vertex_count(_numVertices);
+        source->set_float_components(attribute.format == VROVertexFormat::Float ||
+                                     attribute.format == VROVertexFormat::Half);
+        source->set_components_per_vertex(attribute.components);
+        source->set_bytes_per_component(getBytesPerComponent(attribute.format));
+        source->set_data_offset(attribute.dataOffset);
+
+        if (attribute.separate) {
+            std::string separateData(_numVertices * attribute.getAlignedSize(), 0);
+            if (!separateData.empty()) {
+                writeAttribute(attribute, attribute.getAlignedSize(), &separateData[0]);
+            }
+            source->set_data_stride(attribute.getAlignedSize());
+            source->set_data(separateData);
+        }
+        else {
+            source->set_data_stride(_stride);
+        }
+
+        if (attribute.format == VROVertexFormat::SNorm16) {
+            source->set_normalization(viro::Node_Geometry_Source_Normalization_SNorm);
+        }
+        else if (attribute.format == VROVertexFormat::UNorm16) {
+            source->set_normalization(viro::Node_Geometry_Source_Normalization_UNorm);
+        }
+        for (int c = 0; c < (int) attribute.scale.size(); c++) {
+            source->add_dequantize_scale(attribute.scale[c]);
+            source->add_dequantize_offset(attribute.offset[c]);
+        }
+    }
+}
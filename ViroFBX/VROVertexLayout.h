@@ -0,0 +1,173 @@
+//
+//  VROVertexLayout.h
+//  ViroFBX
+//
+//  Copyright © 2017 Viro. All rights reserved.
+//
+
+#ifndef VROVertexLayout_h
+#define VROVertexLayout_h
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include "Nodes.pb.h"
+
+/*
+ Storage format of each component of a vertex attribute.
+ */
+enum class VROVertexFormat {
+    Float,    // 32-bit float
+    Half,     // 16-bit float
+    SNorm16,  // 16-bit signed integer, normalized to [-1, 1]
+    UNorm16,  // 16-bit unsigned integer, normalized to [0, 1]
+};
+
+/*
+ Default for the largest position error allowed when quantizing, relative to the
+ largest extent of the mesh's bounding box.
+ */
+static const float kDefaultQuantizeTolerance = 1e-4f;
+
+/*
+ Default for the largest texture coordinate error allowed when quantizing, in UV
+ units. This is a quarter texel at 1024x1024.
+ */
+static const float kDefaultQuantizeUVTolerance = 1.0f / 4096.0f;
+
+/*
+ Number of bytes used to store each component in the given format.
+ */
+int getBytesPerComponent(VROVertexFormat format);
+
+/*
+ A single attribute in a vertex buffer. The attribute reads its values from a float
+ stream of (numVertices * components) floats, and stores them in the given format.
+ If the dequantization scale and offset are non-empty (one entry per component),
+ each component is stored as (value - offset) / scale, and recovered by the renderer
+ as normalized * scale + offset.
+
+ Attributes are interleaved in the geometry's data unless they are separate, in
+ which case they are tightly packed in their own source's data.
+ */
+class VROVertexAttribute {
+public:
+    viro::Node_Geometry_Source_Semantic semantic;
+    int components;
+    VROVertexFormat format;
+    const float *data;
+    std::vector<float> scale;
+    std::vector<float> offset;
+
+    bool separate;
+
+    /*
+     Byte offset of the attribute within each vertex; assigned by the layout.
+     */
+    int dataOffset;
+
+    VROVertexAttribute(viro::Node_Geometry_Source_Semantic semantic, int components, VROVertexFormat format,
+                       const float *data, bool separate) :
+        semantic(semantic),
+        components(components),
+        format(format),
+        data(data),
+        separate(separate),
+        dataOffset(0) {}
+
+    /*
+     Size of the attribute in bytes, padded to a 4-byte boundary.
+     */
+    int getAlignedSize() const {
+        return (components * getBytesPerComponent(format) + 3) & ~3;
+    }
+};
+
+/*
+ Fit the dequantization scale and offset of a normalized format to the bounds of the
+ given stream, so that the full integer range covers the stream's AABB. Components
+ with zero extent receive a scale of 1.
+ */
+void fitQuantizationRange(const float *data, int numVertices, int components, VROVertexFormat format,
+                          std::vector<float> *outScale, std::vector<float> *outOffset);
+
+/*
+ Returns the largest absolute error, over all components of all vertices, between the
+ given stream and its round trip through the given format (and scale and offset, if
+ non-empty).
+ */
+float measureQuantizationError(const float *data, int numVertices, int components, VROVertexFormat format,
+                               const std::vector<float> &scale, const std::vector<float> &offset);
+
+/*
+ Encode the tangent frame of each vertex as a QTangent: a unit quaternion (x, y, z, w)
+ that rotates the X axis to the tangent and the Z axis to the normal, with the sign of
+ w holding the handedness of the bitangent. The normals stream has 3 components per
+ vertex and the tangents stream 4 (the fourth being handedness); the output has 4.
+ The magnitude of w is kept at or above one snorm16 step so that its sign survives
+ quantization.
+ */
+void encodeQTangents(const float *normals, const float *tangents, int numVertices,
+                     std::vector<float> *outQTangents);
+
+/*
+ Pack the given bone indices as unsigned integers of bytesPerComponent bytes (1, 2,
+ or 4). The indices must fit in that many bytes.
+ */
+std::string packBoneIndices(const int *indices, int count, int bytesPerComponent);
+
+/*
+ Quantize bone weights (influences per vertex) to unsigned normalized integers of
+ bytesPerComponent bytes (1 or 2). Each weight is rounded to the nearest step, then
+ the rounding error of each vertex is pushed onto its largest weight, so that the
+ quantized weights sum exactly to the rounded sum of the originals: the full integer
+ range for normalized weights.
+ */
+std::string quantizeBoneWeights(const float *weights, int numVertices, int influences, int bytesPerComponent);
+
+/*
+ Builds an interleaved vertex buffer from a set of attributes, plus a tightly packed
+ buffer for each separate attribute. Each attribute starts on a 4-byte boundary, as
+ required by the vertex fetch of most GPUs.
+ */
+class VROVertexLayout {
+public:
+
+    VROVertexLayout(int numVertices);
+    virtual ~VROVertexLayout();
+
+    /*
+     Append an attribute to the layout, interleaved unless separate is true. Returns
+     the attribute so that its scale and offset may be set; the reference is valid
+     until the next attribute is added.
+     */
+    VROVertexAttribute &addAttribute(viro::Node_Geometry_Source_Semantic semantic, int components,
+                                     VROVertexFormat format, const float *data, bool separate = false);
+
+    /*
+     Stride of the interleaved buffer, which excludes the separate attributes.
+     */
+    int getStride() const {
+        return _stride;
+    }
+    const std::vector<VROVertexAttribute> &getAttributes() const {
+        return _attributes;
+    }
+
+    /*
+     Write the interleaved data and a source for each attribute to the geometry.
+     Separate attributes carry their data in their source.
+     */
+    void exportGeometry(viro::Node::Geometry *geo) const;
+
+private:
+
+    int _numVertices;
+    int _stride;
+    std::vector<VROVertexAttribute> _attributes;
+
+    void writeAttribute(const VROVertexAttribute &attribute, int stride, char *out) const;
+
+};
+
+#endif /* VROVertexLayout_h */
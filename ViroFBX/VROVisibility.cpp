@@ -0,0 +1,316 @@
+//
+//  VROVisibility.cpp
+//  ViroFBX
+//
+//  Copyright © 2017 Viro. All rights reserved.
+//
+
+#include "VROVisibility.h"
+#include "VROThreadPool.h"
+#include "VROLog.h"
+#include <cmath>
+#include <algorithm>
+#include <limits>
+
+static const int kBVHMaxLeafTriangles = 4;
+
+/*
+ Rays within this angle (in radians, approximately) of a triangle's plane are treated
+ as missing it. The test is relative to the triangle's edge lengths, so it applies
+ equally at any scale.
+ */
+static const float kRayEpsilon = 1e-6f;
+
+/*
+ Sample points are scaled by the inset about their triangle's centroid, and hits
+ nearer the sample point than the offset (a fraction of the triangle's longest edge)
+ are ignored, so that neighbors touching the triangle do not occlude it.
+ */
+static const float kSampleInset = 0.99f;
+static const float kSampleOffset = 1e-4f;
+
+#pragma mark - BVH
+
+/*
+ Node of a bounding volume hierarchy over triangles. Interior nodes have their
+ children at index left and left + 1; leaves cover the triangle range [first,
+ first + count) of the hierarchy's triangle order.
+ */
+class VROBVHNode {
+public:
+    float min[3];
+    float max[3];
+    int left;
+    int first;
+    int count;
+};
+
+/*
+ Bounding volume hierarchy over the given triangles for which the include flag is
+ set. Triangles are identified by their index in the full list.
+ */
+class VROBVH {
+public:
+    VROBVH(const std::vector<float> &triangles, const std::vector<bool> &include) :
+        _triangles(triangles) {
+        int numTriangles = (int) triangles.size() / 9;
+        _centroids.resize(numTriangles * 3);
+        for (int t = 0; t < numTriangles; t++) {
+            if (!include[t]) {
+                continue;
+            }
+            _order.push_back(t);
+            for (int i = 0; i < 3; i++) {
+                _centroids[t * 3 + i] = (triangles[t * 9 + i] + triangles[t * 9 + 3 + i] + triangles[t * 9 + 6 + i]) / 3;
+            }
+        }
+
+        int numIncluded = (int) _order.size();
+        _nodes.reserve(std::max(1, 2 * numIncluded / kBVHMaxLeafTriangles + 1));
+        _nodes.emplace_back();
+        build(0, 0, numIncluded);
+    }
+
+    /*
+     Return true if the ray hits any triangle other than the ignored one, from either
+     side, at a distance greater than minT.
+     */
+    bool isOccluded(const float *origin, const float *direction, float minT, int ignore) const {
+        float inverse[3];
+        for (int i = 0; i < 3; i++) {
+            inverse[i] = 1.0f / direction[i];
+        }
+
+        int stack[64];
+        int stackSize = 0;
+        stack[stackSize++] = 0;
+
+        while (stackSize > 0) {
+            const VROBVHNode &node = _nodes[stack[--stackSize]];
+            if (!intersectBounds(node, origin, inverse, std::numeric_limits<float>::max())) {
+                continue;
+            }
+
+            if (node.count > 0) {
+                for (int i = node.first; i < node.first + node.count; i++) {
+                    float t;
+                    if (_order[i] != ignore && intersectTriangle(_order[i], origin, direction, &t) && t > minT) {
+                        return true;
+                    }
+                }
+            }
+            else {
+                stack[stackSize++] = node.left;
+                stack[stackSize++] = node.left + 1;
+            }
+        }
+        return false;
+    }
+
+private:
+    const std::vector<float> &_triangles;
+    std::vector<int> _order;
+    std::vector<float> _centroids;
+    std::vector<VROBVHNode> _nodes;
+
+    /*
+     Build the node at the given index over the triangles [first, first + count),
+     splitting at the median centroid along the longest axis of the centroid bounds.
+     The hierarchy is balanced, so its depth stays within the traversal stack.
+     */
+    void build(int index, int first, int count) {
+        float centroidMin[3], centroidMax[3];
+        for (int i = 0; i < 3; i++) {
+            _nodes[index].min[i] = centroidMin[i] = std::numeric_limits<float>::max();
+            _nodes[index].max[i] = centroidMax[i] = -std::numeric_limits<float>::max();
+        }
+        for (int o = first; o < first + count; o++) {
+            int t = _order[o];
+            for (int i = 0; i < 3; i++) {
+                for (int c = 0; c < 3; c++) {
+                    _nodes[index].min[i] = std::min(_nodes[index].min[i], _triangles[t * 9 + c * 3 + i]);
+                    _nodes[index].max[i] = std::max(_nodes[index].max[i], _triangles[t * 9 + c * 3 + i]);
+                }
+                centroidMin[i] = std::min(centroidMin[i], _centroids[t * 3 + i]);
+                centroidMax[i] = std::max(centroidMax[i], _centroids[t * 3 + i]);
+            }
+        }
+
+        _nodes[index].first = first;
+        _nodes[index].count = count;
+        _nodes[index].left = -1;
+        if (count <= kBVHMaxLeafTriangles) {
+            return;
+        }
+
+        int axis = 0;
+        for (int i = 1; i < 3; i++) {
+            if (centroidMax[i] - centroidMin[i] > centroidMax[axis] - centroidMin[axis]) {
+                axis = i;
+            }
+        }
+
+        int half = count / 2;
+        std::nth_element(_order.begin() + first, _order.begin() + first + half, _order.begin() + first + count,
+                         [this, axis](int a, int b) {
+                             float ca = _centroids[a * 3 + axis];
+                             float cb = _centroids[b * 3 + axis];
+                             return ca < cb || (ca == cb && a < b);
+                         });
+
+        int left = (int) _nodes.size();
+        _nodes.emplace_back();
+        _nodes.emplace_back();
+        _nodes[index].left = left;
+        _nodes[index].count = 0;
+
+        build(left, first, half);
+        build(left + 1, first + half, count - half);
+    }
+
+    static bool intersectBounds(const VROBVHNode &node, const float *origin, const float *inverse, float maxT) {
+        float tmin = 0;
+        float tmax = maxT;
+        for (int i = 0; i < 3; i++) {
+            float t0 = (node.min[i] - origin[i]) * inverse[i];
+            float t1 = (node.max[i] - origin[i]) * inverse[i];
+            if (t0 > t1) {
+                std::swap(t0, t1);
+            }
+            tmin = std::max(tmin, t0);
+            tmax = std::min(tmax, t1);
+            if (tmin > tmax) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /*
+     Möller-Trumbore ray-triangle intersection, accepting hits on either side. The
+     direction must be unit length, so that |det| is |e1||e2| scaled by the sines of
+     the triangle's angle and of the ray's angle to its plane.
+     */
+    bool intersectTriangle(int triangle, const float *origin, const float *direction, float *outT) const {
+        const float *p0 = &_triangles[triangle * 9];
+        const float *p1 = p0 + 3;
+        const float *p2 = p0 + 6;
+
+        float e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+        float e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+        float p[3] = { direction[1] * e2[2] - direction[2] * e2[1],
+                       direction[2] * e2[0] - direction[0] * e2[2],
+                       direction[0] * e2[1] - direction[1] * e2[0] };
+        float det = e1[0] * p[0] + e1[1] * p[1] + e1[2] * p[2];
+        float e1Length = sqrt(e1[0] * e1[0] + e1[1] * e1[1] + e1[2] * e1[2]);
+        float e2Length = sqrt(e2[0] * e2[0] + e2[1] * e2[1] + e2[2] * e2[2]);
+        if (fabs(det) <= kRayEpsilon * e1Length * e2Length) {
+            return false;
+        }
+
+        float inverseDet = 1.0f / det;
+        float s[3] = { origin[0] - p0[0], origin[1] - p0[1], origin[2] - p0[2] };
+        float u = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) * inverseDet;
+        if (u < 0 || u > 1) {
+            return false;
+        }
+
+        float q[3] = { s[1] * e1[2] - s[2] * e1[1],
+                       s[2] * e1[0] - s[0] * e1[2],
+                       s[0] * e1[1] - s[1] * e1[0] };
+        float v = (direction[0] * q[0] + direction[1] * q[1] + direction[2] * q[2]) * inverseDet;
+        if (v < 0 || u + v > 1) {
+            return false;
+        }
+
+        float t = (e2[0] * q[0] + e2[1] * q[1] + e2[2] * q[2]) * inverseDet;
+        if (t <= 0) {
+            return false;
+        }
+        *outT = t;
+        return true;
+    }
+};
+
+#pragma mark - Visibility
+
+/*
+ SplitMix64, used so that the ray pattern for a seed is identical on every platform.
+ */
+static uint64_t nextRandom(uint64_t *state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+static float nextUniform(uint64_t *state) {
+    return (nextRandom(state) >> 40) * (1.0f / 16777216.0f);
+}
+
+std::vector<bool> computeTriangleVisibility(const std::vector<float> &triangles, const std::vector<bool> &occluders,
+                                            int samplesPerTriangle, uint32_t seed, VROThreadPool *pool) {
+    int numTriangles = (int) triangles.size() / 9;
+    passert (occluders.size() == numTriangles);
+    passert_msg (samplesPerTriangle > 0, "At least one sample per triangle is required, or all are hidden");
+    VROBVH bvh(triangles, occluders);
+
+    /*
+     Each byte is written by the one range that owns its triangle (unlike the bits of
+     a std::vector<bool>).
+     */
+    std::vector<uint8_t> visible(numTriangles, 0);
+
+    dispatchRanges(pool, numTriangles, [&](int range, int start, int end) {
+        for (int t = start; t < end; t++) {
+            const float *p0 = &triangles[t * 9];
+            const float *p1 = p0 + 3;
+            const float *p2 = p0 + 6;
+
+            float centroid[3];
+            float edgeLengths[3] = { 0, 0, 0 };
+            for (int i = 0; i < 3; i++) {
+                centroid[i] = (p0[i] + p1[i] + p2[i]) / 3;
+                edgeLengths[0] += (p1[i] - p0[i]) * (p1[i] - p0[i]);
+                edgeLengths[1] += (p2[i] - p1[i]) * (p2[i] - p1[i]);
+                edgeLengths[2] += (p0[i] - p2[i]) * (p0[i] - p2[i]);
+            }
+            float minT = sqrt(*std::max_element(edgeLengths, edgeLengths + 3)) * kSampleOffset;
+
+            uint64_t state = ((uint64_t) seed << 32) ^ (uint64_t) t;
+            for (int sample = 0; sample < samplesPerTriangle && !visible[t]; sample++) {
+                /*
+                 The first sample is the centroid, the rest uniform over the triangle,
+                 inset toward the centroid so that they do not lie on edges shared with
+                 neighbors.
+                 */
+                float point[3];
+                if (sample == 0) {
+                    std::copy(centroid, centroid + 3, point);
+                }
+                else {
+                    float a = sqrt(nextUniform(&state));
+                    float b = nextUniform(&state);
+                    float b1 = a * (1 - b);
+                    float b2 = a * b;
+                    for (int i = 0; i < 3; i++) {
+                        float onTriangle = p0[i] + b1 * (p1[i] - p0[i]) + b2 * (p2[i] - p0[i]);
+                        point[i] = centroid[i] + (onTriangle - centroid[i]) * kSampleInset;
+                    }
+                }
+
+                // Directions are stratified in z, which is equal-area on the sphere
+                float z = 1 - 2 * (sample + nextUniform(&state)) / samplesPerTriangle;
+                float phi = 2 * (float) M_PI * nextUniform(&state);
+                float r = sqrt(std::max(0.0f, 1 - z * z));
+                float direction[3] = { r * cosf(phi), r * sinf(phi), z };
+
+                if (!bvh.isOccluded(point, direction, minT, t)) {
+                    visible[t] = 1;
+                }
+            }
+        }
+    });
+
+    return std::vector<bool>(visible.begin(), visible.end());
+}
@@ -0,0 +1,43 @@
+//
+//  VROVisibility.h
+//  ViroFBX
+//
+//  Copyright © 2017 Viro. All rights reserved.
+//
+
+#ifndef VROVisibility_h
+#define VROVisibility_h
+
+#include <stdio.h>
+#include <stdint.h>
+#include <vector>
+
+class VROThreadPool;
+
+/*
+ Default number of rays cast at each triangle when determining visibility.
+ */
+static const int kDefaultVisibilitySamples = 64;
+
+/*
+ Determine which of the given triangles are visible from outside the scene. The
+ triangles hold 9 floats each (three corners), all in the same space. Each triangle
+ is sampled on its own, however small: up to samplesPerTriangle (at least 1) rays
+ are cast at it from outside the scene, each at a point on the triangle (its
+ centroid, then jittered points) from a direction stratified over the sphere. The triangle is
+ visible (from either side) once a ray reaches it without passing through an
+ occluder. Each ray is traced from the sample point outward, which tests the same
+ segment with the precision of the point on the triangle.
+
+ Only triangles whose occluder flag is set block rays; the rest (e.g. those with
+ transparent or alpha tested materials, which can be seen through) are still tested
+ for visibility themselves.
+
+ The rays are derived from the seed and the triangle's index alone, so the result
+ is deterministic for a given seed and input, however the work is divided among the
+ pool's threads (the pool may be null).
+ */
+std::vector<bool> computeTriangleVisibility(const std::vector<float> &triangles, const std::vector<bool> &occluders,
+                                            int samplesPerTriangle, uint32_t seed, VROThreadPool *pool);
+
+#endif /* VROVisibility_h */
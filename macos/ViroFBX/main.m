@@ -14,7 +14,50 @@
 const bool kTestMode = NO;
 
 void printUsage() {
-    pinfo("Usage: ViroFBX [--compress-textures] [source FBX file] [destination VRX file]");
+    pinfo("Usage: ViroFBX [options] [source FBX file] [destination VRX file]");
+    pinfo("Options:");
+    pinfo("   --compress-textures   Compress textures");
+    pinfo("   --no-weld             Do not weld identical vertices; each triangle corner gets its own vertex");
+    pinfo("   --no-cleanup          Keep collapsed, zero-area, and duplicate triangles");
+    pinfo("   --no-vertex-cache     Do not reorder triangles and vertices for the GPU vertex cache");
+    pinfo("   --optimize-overdraw   Sort triangles so outward-facing clusters draw first");
+    pinfo("   --overdraw-threshold [value]");
+    pinfo("                         Vertex cache miss ratio allowed for overdraw sorting (default 1.05)");
+    pinfo("   --quantize            Store positions and UVs as 16-bit values where within tolerance");
+    pinfo("   --quantize-tolerance [value]");
+    pinfo("                         Position error allowed, relative to the bounding box (default 0.0001)");
+    pinfo("   --quantize-uv-tolerance [value]");
+    pinfo("                         UV error allowed, in UV units (default 0.000244)");
+    pinfo("   --qtangents           Encode normals and tangents as a single snorm16 quaternion");
+    pinfo("   --max-influences [count]");
+    pinfo("                         Bones that can influence each vertex: 1, 2, 4, or 8 (default 4)");
+    pinfo("   --min-bone-weight [value]");
+    pinfo("                         Drop bone influences below this weight and report the displacement (default 0)");
+    pinfo("   --influence-tiers     Sort skinned vertices into 1, 2, 4, and 8 influence tiers");
+    pinfo("   --dual-quaternions    Write rigid skin and bone transforms as dual quaternions instead of matrices");
+    pinfo("   --compact-skin        Store bone indices as 8-bit integers and bone weights as unorm8");
+    pinfo("   --skin-weight-bits [8|16]");
+    pinfo("                         Precision of compact bone weights (default 8)");
+    pinfo("   --separate-positions  Write positions to their own buffer, apart from the other attributes");
+    pinfo("   --mesh-codec          Compress vertex and index data with the delta and FIFO mesh codecs");
+    pinfo("   --no-prune-attributes Export UVs, normals, and tangents even if no material uses them");
+    pinfo("   --parallel-threshold [triangles]");
+    pinfo("                         Read meshes with at least this many triangles in parallel (default 250000, 0 disables)");
+    pinfo("   --threads [count]     Number of threads used for parallel reads (default one per core)");
+    pinfo("   --meshlets            Split elements into meshlets with culling bounds");
+    pinfo("   --lod [ratios]        Generate LODs of static geometry with these triangle ratios (e.g. 0.5,0.25,0.1)");
+    pinfo("   --lod-max-error [value]");
+    pinfo("                         LOD error allowed, relative to the geometry's size (default 0.01)");
+    pinfo("   --progressive         Write static geometry in progressive mesh order, down to the LOD max error");
+    pinfo("   --strips              Write elements as triangle strips stitched with degenerates, where smaller");
+    pinfo("   --strips-restart      Write elements as triangle strips joined with a restart index, where smaller");
+    pinfo("   --batch-static        Merge the static subtrees under each node into a single geometry");
+    pinfo("   --instance            Export meshes shared by several nodes, or identical meshes, only once");
+    pinfo("   --remove-hidden       Remove static triangles that cannot be seen from outside the scene");
+    pinfo("   --visibility-samples [count]");
+    pinfo("                         Rays cast at each triangle to find hidden triangles, at least 1 (default 64)");
+    pinfo("   --visibility-seed [value]");
+    pinfo("                         Seed for the visibility rays (default 0)");
 }
 
 int main(int argc, const char * argv[]) {
@@ -98,27 +141,150 @@ int main(int argc, const char * argv[]) {
            */
       }
       else {
-          if (argc != 3 && argc != 4) {
-              printUsage();
-              return 1;
-          }
-          
-          if (argc == 3) {
-              VROFBXExporter *exporter = new VROFBXExporter();
-              exporter->exportFBX(std::string(argv[1]), std::string(argv[2]), false);
-          }
-          else if (argc == 4) {
-              std::string firstArg = argv[1];
-              
-              if (firstArg == "--compress-textures") {
-                  VROFBXExporter *exporter = new VROFBXExporter();
-                  exporter->exportFBX(std::string(argv[2]), std::string(argv[3]), true);
+          /*
+           Options precede the source and destination files.
+           */
+          bool compressTextures = false;
+          VROFBXExportOptions options;
+
+          int argIndex = 1;
+          for (; argIndex < argc - 2; argIndex++) {
+              std::string arg = argv[argIndex];
+
+              if (arg == "--compress-textures") {
+                  compressTextures = true;
+              }
+              else if (arg == "--no-weld") {
+                  options.weldVertices = false;
+              }
+              else if (arg == "--no-cleanup") {
+                  options.cleanupTriangles = false;
+              }
+              else if (arg == "--no-vertex-cache") {
+                  options.optimizeVertexCache = false;
+              }
+              else if (arg == "--optimize-overdraw") {
+                  options.optimizeOverdraw = true;
+              }
+              else if (arg == "--overdraw-threshold" && argIndex + 1 < argc - 2) {
+                  options.optimizeOverdraw = true;
+                  options.overdrawThreshold = atof(argv[++argIndex]);
+              }
+              else if (arg == "--quantize") {
+                  options.quantizeVertices = true;
+              }
+              else if (arg == "--quantize-tolerance" && argIndex + 1 < argc - 2) {
+                  options.quantizeVertices = true;
+                  options.quantizeTolerance = atof(argv[++argIndex]);
+              }
+              else if (arg == "--quantize-uv-tolerance" && argIndex + 1 < argc - 2) {
+                  options.quantizeVertices = true;
+                  options.quantizeUVTolerance = atof(argv[++argIndex]);
+              }
+              else if (arg == "--qtangents") {
+                  options.encodeQTangents = true;
+              }
+              else if (arg == "--max-influences" && argIndex + 1 < argc - 2) {
+                  options.maxBoneInfluences = atoi(argv[++argIndex]);
+              }
+              else if (arg == "--min-bone-weight" && argIndex + 1 < argc - 2) {
+                  options.minBoneWeight = atof(argv[++argIndex]);
+              }
+              else if (arg == "--influence-tiers") {
+                  options.boneInfluenceTiers = true;
+              }
+              else if (arg == "--dual-quaternions") {
+                  options.dualQuaternionSkinning = true;
+              }
+              else if (arg == "--compact-skin") {
+                  options.compactSkin = true;
+              }
+              else if (arg == "--skin-weight-bits" && argIndex + 1 < argc - 2) {
+                  options.compactSkin = true;
+                  options.skinWeightBytes = atoi(argv[++argIndex]) > 8 ? 2 : 1;
+              }
+              else if (arg == "--separate-positions") {
+                  options.separatePositions = true;
+              }
+              else if (arg == "--mesh-codec") {
+                  options.encodeMeshData = true;
+              }
+              else if (arg == "--no-prune-attributes") {
+                  options.pruneVertexAttributes = false;
+              }
+              else if (arg == "--parallel-threshold" && argIndex + 1 < argc - 2) {
+                  options.parallelTriangleThreshold = atoi(argv[++argIndex]);
+              }
+              else if (arg == "--threads" && argIndex + 1 < argc - 2) {
+                  options.numThreads = atoi(argv[++argIndex]);
+              }
+              else if (arg == "--meshlets") {
+                  options.buildMeshlets = true;
+              }
+              else if (arg == "--lod" && argIndex + 1 < argc - 2) {
+                  const char *ratios = argv[++argIndex];
+                  char *end;
+                  while (*ratios != 0) {
+                      float ratio = strtof(ratios, &end);
+                      if (end == ratios) {
+                          break;
+                      }
+                      options.lodRatios.push_back(ratio);
+                      ratios = (*end == ',') ? end + 1 : end;
+                  }
+              }
+              else if (arg == "--lod-max-error" && argIndex + 1 < argc - 2) {
+                  options.lodMaxError = atof(argv[++argIndex]);
+              }
+              else if (arg == "--progressive") {
+                  options.progressiveMesh = true;
+              }
+              else if (arg == "--strips") {
+                  options.stripifyElements = true;
+              }
+              else if (arg == "--strips-restart") {
+                  options.stripifyElements = true;
+                  options.stripPrimitiveRestart = true;
+              }
+              else if (arg == "--batch-static") {
+                  options.batchStaticMeshes = true;
+              }
+              else if (arg == "--instance") {
+                  options.instanceGeometry = true;
+              }
+              else if (arg == "--remove-hidden") {
+                  options.removeHiddenGeometry = true;
+              }
+              else if (arg == "--visibility-samples" && argIndex + 1 < argc - 2) {
+                  // With no samples no triangle is found visible, so all would be removed
+                  const char *samples = argv[++argIndex];
+                  char *end;
+                  long value = strtol(samples, &end, 10);
+                  if (end == samples || *end != 0 || value < 1 || value > INT_MAX) {
+                      pinfo("Invalid --visibility-samples [%s]: must be a positive integer", samples);
+                      printUsage();
+                      return 1;
+                  }
+                  options.removeHiddenGeometry = true;
+                  options.visibilitySamples = (int) value;
+              }
+              else if (arg == "--visibility-seed" && argIndex + 1 < argc - 2) {
+                  options.removeHiddenGeometry = true;
+                  options.visibilitySeed = (uint32_t) strtoul(argv[++argIndex], nullptr, 10);
               }
               else {
                   printUsage();
                   return 1;
               }
           }
+
+          if (argc - argIndex != 2 || std::string(argv[argIndex]).find("--") == 0) {
+              printUsage();
+              return 1;
+          }
+
+          VROFBXExporter *exporter = new VROFBXExporter();
+          exporter->exportFBX(std::string(argv[argIndex]), std::string(argv[argIndex + 1]), compressTextures, options);
           
           return 0;
       }